@@ -0,0 +1,101 @@
+#pragma once
+
+#include <graaflib/execution_policy.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief Options of betweenness_centrality.
+ */
+struct betweenness_centrality_options {
+  // Whether to take the edge weights into account. Otherwise, and for edges
+  // without a weight, every edge counts as one and shortest paths are found by
+  // breadth first search.
+  bool weighted{true};
+
+  // Whether to divide the scores by the number of pairs of other vertices,
+  // which scales them to [0, 1]
+  bool normalized{false};
+
+  // The number of source vertices to sample uniformly, or zero to use every
+  // vertex as a source. See betweenness_sample_count.
+  std::size_t sample_count{0};
+
+  // Sampling with the same seed yields the same sources
+  std::uint64_t seed{0};
+};
+
+/**
+ * Computes the betweenness centrality of every vertex with the algorithm of
+ * Brandes. The betweenness of a vertex is the sum over all pairs of other
+ * vertices of the fraction of the shortest paths between them which pass
+ * through the vertex.
+ *
+ * From every source, one Dijkstra search, or a breadth first search when
+ * unweighted, counts the shortest paths to every vertex. The dependencies of
+ * the source on the vertices are then accumulated in reverse order of
+ * distance. This takes O(|V||E| + |V|^2 log|V|) time and O(|V| + |E|) memory,
+ * without materializing any paths.
+ *
+ * With a sample_count, only that many sources are searched and the scores are
+ * scaled up, which gives an unbiased estimate. In undirected graphs every
+ * pair of vertices is counted once.
+ *
+ * @param graph The graph to compute the betweenness centrality of.
+ * @param options Whether to use weights, normalize or sample sources.
+ * @return An unordered_map from every vertex to its betweenness centrality.
+ * @throws invalid_argument - If a negative edge weight is encountered.
+ */
+template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> betweenness_centrality(
+    const graph<V, E, T>& graph,
+    const betweenness_centrality_options& options = {});
+
+/**
+ * Computes the betweenness centrality of every vertex with the given
+ * execution policy.
+ *
+ * With a parallel policy, the sources are searched in parallel on the
+ * default_executor. Every thread accumulates the dependencies into buffers of
+ * its own, which are summed at the end, so up to rounding the result equals
+ * that of the sequential algorithm.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see betweenness_centrality
+ */
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> betweenness_centrality(
+    POLICY_T&& policy, const graph<V, E, T>& graph,
+    const betweenness_centrality_options& options = {});
+
+/**
+ * The number of sampled sources for which, with probability at least
+ * 1 - delta, the normalized betweenness centrality estimated by
+ * betweenness_centrality is within epsilon of the exact one, for every vertex
+ * at once.
+ *
+ * The dependency of a sampled source on a vertex lies in [0, |V| - 2], so the
+ * bound follows from Hoeffding's inequality and a union bound over the
+ * vertices: about ln(2|V| / delta) / (2 epsilon^2) sources suffice,
+ * regardless of the structure of the graph.
+ *
+ * @param vertex_count The number of vertices of the graph.
+ * @param epsilon The maximum absolute error of the normalized scores.
+ * @param delta The probability with which the error may be exceeded.
+ * @return The number of sources to sample.
+ */
+[[nodiscard]] inline std::size_t betweenness_sample_count(
+    std::size_t vertex_count, double epsilon, double delta);
+
+}  // namespace graaf::algorithm
+
+#include "betweenness_centrality.tpp"
@@ -0,0 +1,410 @@
+#pragma once
+
+#include <graaflib/algorithm/dense_graph.h>
+#include <graaflib/algorithm/shortest_path/monotone_queue.h>
+#include <graaflib/executor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graaf::algorithm {
+
+namespace detail {
+
+/**
+ * @brief The edges of a graph in compressed sparse row format, both grouped
+ * by their source and by their target, with the length of every edge stored
+ * next to it. The searches from every source hence read the edges
+ * sequentially, without following pointers to them. Without lengths, every
+ * edge has a length of one.
+ */
+template <typename DISTANCE_T>
+struct brandes_graph {
+  struct adjacency {
+    std::vector<std::size_t> offsets{};
+    std::vector<std::size_t> vertices{};
+    std::vector<DISTANCE_T> lengths{};
+  };
+
+  adjacency outgoing{};
+  adjacency incoming{};
+};
+
+template <typename DISTANCE_T, typename E, typename EDGE_LENGTH_T>
+[[nodiscard]] brandes_graph<DISTANCE_T> make_brandes_graph(
+    const dense_graph<E>& graph, const EDGE_LENGTH_T& edge_length,
+    bool with_lengths) {
+  const auto vertex_count{graph.vertex_count()};
+  brandes_graph<DISTANCE_T> brandes{};
+  auto& outgoing{brandes.outgoing};
+  auto& incoming{brandes.incoming};
+
+  outgoing.offsets.assign(vertex_count + 1, 0);
+  incoming.offsets.assign(vertex_count + 1, 0);
+  for (std::size_t source{0}; source < vertex_count; ++source) {
+    const auto neighbors{graph.neighbors(source)};
+    outgoing.offsets[source + 1] = outgoing.offsets[source] + neighbors.size();
+    for (const auto target : neighbors) {
+      ++incoming.offsets[target + 1];
+    }
+  }
+  std::partial_sum(incoming.offsets.begin(), incoming.offsets.end(),
+                   incoming.offsets.begin());
+
+  const auto edge_count{outgoing.offsets.back()};
+  for (auto* adjacency : {&outgoing, &incoming}) {
+    adjacency->vertices.resize(edge_count);
+    adjacency->lengths.resize(with_lengths ? edge_count : 0);
+  }
+
+  auto next_slot{incoming.offsets};
+  for (std::size_t source{0}; source < vertex_count; ++source) {
+    const auto neighbors{graph.neighbors(source)};
+    const auto edges{graph.edges(source)};
+    for (std::size_t position{0}; position < neighbors.size(); ++position) {
+      const auto target{neighbors[position]};
+      const auto outgoing_slot{outgoing.offsets[source] + position};
+      const auto incoming_slot{next_slot[target]++};
+      outgoing.vertices[outgoing_slot] = target;
+      incoming.vertices[incoming_slot] = source;
+
+      if (with_lengths) {
+        const DISTANCE_T length = edge_length(source, target, *edges[position]);
+        outgoing.lengths[outgoing_slot] = length;
+        incoming.lengths[incoming_slot] = length;
+      }
+    }
+  }
+  return brandes;
+}
+
+/**
+ * @brief The buffers of the searches from one source at a time, reused for
+ * every source, along with the dependencies accumulated so far.
+ */
+template <typename DISTANCE_T>
+struct brandes_state {
+  static constexpr std::size_t unsettled{
+      std::numeric_limits<std::size_t>::max()};
+
+  // Kept together, such that visiting a vertex touches a single cache line
+  struct vertex_state {
+    DISTANCE_T distance{};
+    // The position of the vertex in the order once it is settled
+    std::size_t position{unsettled};
+    // The number of shortest paths from the source, zero if not reached
+    double path_count{0};
+    double dependency{0};
+  };
+
+  explicit brandes_state(std::size_t vertex_count)
+      : vertices(vertex_count), centrality(vertex_count, 0) {}
+
+  std::vector<vertex_state> vertices;
+  // The settled vertices in order of non-decreasing distance
+  std::vector<std::size_t> order{};
+
+  std::vector<double> centrality;
+};
+
+template <typename DISTANCE_T>
+void count_shortest_paths_unweighted(const brandes_graph<DISTANCE_T>& graph,
+                                     std::size_t source,
+                                     brandes_state<DISTANCE_T>& state) {
+  const auto& outgoing{graph.outgoing};
+  state.vertices[source] = {0, 0, 1, 0};
+  state.order.push_back(source);
+
+  // The order of a breadth first search doubles as its queue
+  for (std::size_t position{0}; position < state.order.size(); ++position) {
+    const auto current{state.order[position]};
+    const auto& current_state{state.vertices[current]};
+    const auto neighbor_distance{current_state.distance + 1};
+    for (auto edge{outgoing.offsets[current]};
+         edge < outgoing.offsets[current + 1]; ++edge) {
+      const auto neighbor{outgoing.vertices[edge]};
+      auto& neighbor_state{state.vertices[neighbor]};
+      if (neighbor_state.position == state.unsettled) {
+        neighbor_state.distance = neighbor_distance;
+        neighbor_state.position = state.order.size();
+        state.order.push_back(neighbor);
+      }
+      if (neighbor_state.distance == neighbor_distance) {
+        neighbor_state.path_count += current_state.path_count;
+      }
+    }
+  }
+}
+
+template <typename DISTANCE_T, typename QUEUE_T>
+void count_shortest_paths_weighted(const brandes_graph<DISTANCE_T>& graph,
+                                   std::size_t source,
+                                   brandes_state<DISTANCE_T>& state,
+                                   QUEUE_T& to_explore) {
+  const auto& outgoing{graph.outgoing};
+  state.vertices[source].distance = 0;
+  state.vertices[source].path_count = 1;
+  to_explore.push({source, 0, source});
+
+  while (!to_explore.empty()) {
+    const auto current{to_explore.top().id};
+    to_explore.pop();
+    auto& current_state{state.vertices[current]};
+    if (current_state.position != state.unsettled) {
+      continue;
+    }
+    current_state.position = state.order.size();
+    state.order.push_back(current);
+
+    for (auto edge{outgoing.offsets[current]};
+         edge < outgoing.offsets[current + 1]; ++edge) {
+      const auto neighbor{outgoing.vertices[edge]};
+      auto& neighbor_state{state.vertices[neighbor]};
+      if (neighbor_state.position != state.unsettled) {
+        continue;
+      }
+
+      const DISTANCE_T neighbor_distance =
+          current_state.distance + outgoing.lengths[edge];
+      if (neighbor_state.path_count == 0 ||
+          neighbor_distance < neighbor_state.distance) {
+        neighbor_state.distance = neighbor_distance;
+        neighbor_state.path_count = current_state.path_count;
+        to_explore.push({neighbor, neighbor_distance, current});
+      } else if (neighbor_distance == neighbor_state.distance) {
+        neighbor_state.path_count += current_state.path_count;
+      }
+    }
+  }
+}
+
+/**
+ * Adds the dependencies of the source on every vertex to the centrality and
+ * resets the buffers for the next source.
+ *
+ * Rather than keeping a list of predecessors per vertex, the predecessors on
+ * shortest paths are found again among the incoming neighbors: those which
+ * were settled earlier and whose distance plus the edge length is the
+ * distance of the vertex. This saves an allocation per vertex and source.
+ */
+template <typename DISTANCE_T>
+void accumulate_dependencies(const brandes_graph<DISTANCE_T>& graph,
+                             std::size_t source,
+                             brandes_state<DISTANCE_T>& state) {
+  const auto& incoming{graph.incoming};
+  const auto edge_length{[&incoming](std::size_t edge) -> DISTANCE_T {
+    return incoming.lengths.empty() ? 1 : incoming.lengths[edge];
+  }};
+
+  for (auto position{state.order.size()}; position-- > 0;) {
+    const auto current{state.order[position]};
+    const auto& current_state{state.vertices[current]};
+    const auto share{(1 + current_state.dependency) /
+                     current_state.path_count};
+
+    for (auto edge{incoming.offsets[current]};
+         edge < incoming.offsets[current + 1]; ++edge) {
+      auto& predecessor_state{state.vertices[incoming.vertices[edge]]};
+      if (predecessor_state.position < position &&
+          predecessor_state.distance + edge_length(edge) ==
+              current_state.distance) {
+        predecessor_state.dependency += predecessor_state.path_count * share;
+      }
+    }
+    if (current != source) {
+      state.centrality[current] += current_state.dependency;
+    }
+  }
+
+  for (const auto vertex : state.order) {
+    state.vertices[vertex] = {};
+  }
+  state.order.clear();
+}
+
+// Runs the function, which accumulates the dependencies of one source, for
+// every source
+template <typename DISTANCE_T, typename FUNCTION_T>
+[[nodiscard]] std::vector<double> brandes_centrality(
+    std::size_t vertex_count, const std::vector<std::size_t>& sources,
+    const FUNCTION_T& from_source, bool parallel) {
+  if (!parallel) {
+    brandes_state<DISTANCE_T> state{vertex_count};
+    for (const auto source : sources) {
+      from_source(source, state);
+    }
+    return std::move(state.centrality);
+  }
+
+  // States are handed out to one chunk of sources at a time, so there are
+  // at most as many as there are concurrent chunks
+  std::mutex states_mutex{};
+  std::vector<std::unique_ptr<brandes_state<DISTANCE_T>>> states{};
+  std::vector<brandes_state<DISTANCE_T>*> idle_states{};
+
+  parallel_for(
+      default_executor(), 0, sources.size(),
+      [&](std::size_t begin, std::size_t end) {
+        brandes_state<DISTANCE_T>* state{nullptr};
+        {
+          const std::lock_guard lock{states_mutex};
+          if (idle_states.empty()) {
+            states.push_back(
+                std::make_unique<brandes_state<DISTANCE_T>>(vertex_count));
+            state = states.back().get();
+          } else {
+            state = idle_states.back();
+            idle_states.pop_back();
+          }
+        }
+
+        for (auto position{begin}; position < end; ++position) {
+          from_source(sources[position], *state);
+        }
+
+        const std::lock_guard lock{states_mutex};
+        idle_states.push_back(state);
+      },
+      {.grain_size = 4});
+
+  std::vector<double> centrality(vertex_count, 0);
+  for (const auto& state : states) {
+    std::transform(centrality.begin(), centrality.end(),
+                   state->centrality.begin(), centrality.begin(),
+                   std::plus<>{});
+  }
+  return centrality;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> betweenness_centrality(
+    const graph<V, E, T>& graph, const betweenness_centrality_options& options,
+    bool parallel) {
+  const auto dense_graph{make_dense_graph(graph)};
+  const auto vertex_count{dense_graph.vertex_count()};
+
+  std::vector<std::size_t> sources(vertex_count);
+  std::iota(sources.begin(), sources.end(), 0);
+  if (options.sample_count > 0 && options.sample_count < vertex_count) {
+    std::vector<std::size_t> sampled_sources{};
+    sampled_sources.reserve(options.sample_count);
+    std::sample(sources.begin(), sources.end(),
+                std::back_inserter(sampled_sources), options.sample_count,
+                std::mt19937_64{options.seed});
+    sources = std::move(sampled_sources);
+  }
+
+  std::vector<double> centrality{};
+  if (graaf::detail::has_edge_weight<E> && options.weighted) {
+    const auto brandes{make_brandes_graph<WEIGHT_T>(
+        dense_graph,
+        [&dense_graph](std::size_t source, std::size_t target, const E& edge) {
+          const WEIGHT_T edge_weight = get_weight(edge);
+          if (edge_weight < 0) {
+            std::ostringstream error_msg;
+            error_msg << "Negative edge weight [" << edge_weight
+                      << "] between vertices ["
+                      << dense_graph.vertex_id(source) << "] -> ["
+                      << dense_graph.vertex_id(target) << "].";
+            throw std::invalid_argument{error_msg.str()};
+          }
+          return edge_weight;
+        },
+        true)};
+
+    centrality = with_dijkstra_queue<WEIGHT_T>(
+        graph, true, [&](const auto& empty_queue) {
+          return brandes_centrality<WEIGHT_T>(
+              vertex_count, sources,
+              [&](std::size_t source, brandes_state<WEIGHT_T>& state) {
+                auto to_explore{empty_queue};
+                count_shortest_paths_weighted(brandes, source, state,
+                                              to_explore);
+                accumulate_dependencies(brandes, source, state);
+              },
+              parallel);
+        });
+  } else {
+    const auto brandes{make_brandes_graph<std::size_t>(
+        dense_graph,
+        [](std::size_t /*source*/, std::size_t /*target*/,
+           const E& /*edge*/) { return std::size_t{1}; },
+        false)};
+
+    centrality = brandes_centrality<std::size_t>(
+        vertex_count, sources,
+        [&brandes](std::size_t source, brandes_state<std::size_t>& state) {
+          count_shortest_paths_unweighted(brandes, source, state);
+          accumulate_dependencies(brandes, source, state);
+        },
+        parallel);
+  }
+
+  // Sampled sources stand in for all sources, and in undirected graphs every
+  // pair of vertices is counted from both of its ends
+  double scale{sources.empty() ? 0.0
+                               : static_cast<double>(vertex_count) /
+                                     static_cast<double>(sources.size())};
+  if constexpr (T == graph_type::UNDIRECTED) {
+    scale /= 2;
+  }
+  if (options.normalized && vertex_count > 2) {
+    const auto other_pairs{static_cast<double>(vertex_count - 1) *
+                           static_cast<double>(vertex_count - 2)};
+    scale /= T == graph_type::UNDIRECTED ? other_pairs / 2 : other_pairs;
+  }
+
+  std::unordered_map<vertex_id_t, double> vertex_centrality{};
+  vertex_centrality.reserve(vertex_count);
+  for (std::size_t index{0}; index < vertex_count; ++index) {
+    vertex_centrality.emplace(dense_graph.vertex_id(index),
+                              centrality[index] * scale);
+  }
+  return vertex_centrality;
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::unordered_map<vertex_id_t, double> betweenness_centrality(
+    const graph<V, E, T>& graph,
+    const betweenness_centrality_options& options) {
+  return detail::betweenness_centrality<V, E, T, WEIGHT_T>(graph, options,
+                                                           false);
+}
+
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename WEIGHT_T>
+std::unordered_map<vertex_id_t, double> betweenness_centrality(
+    POLICY_T&& /*policy*/, const graph<V, E, T>& graph,
+    const betweenness_centrality_options& options) {
+  return detail::betweenness_centrality<V, E, T, WEIGHT_T>(
+      graph, options,
+      graaf::detail::is_parallel_execution_policy_v<POLICY_T>);
+}
+
+std::size_t betweenness_sample_count(std::size_t vertex_count, double epsilon,
+                                     double delta) {
+  if (vertex_count < 3) {
+    return vertex_count;
+  }
+  // The normalized estimate is the mean of the sampled dependencies divided
+  // by |V| - 2, times |V| / (|V| - 1)
+  const auto vertices{static_cast<double>(vertex_count)};
+  const auto mean_epsilon{epsilon * (vertices - 1) / vertices};
+  const auto sample_count{std::ceil(std::log(2 * vertices / delta) /
+                                    (2 * mean_epsilon * mean_epsilon))};
+  return std::min(vertex_count, static_cast<std::size_t>(sample_count));
+}
+
+}  // namespace graaf::algorithm
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <graaflib/csr_graph.h>
+#include <graaflib/execution_policy.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief Options of pagerank.
+ */
+struct pagerank_options {
+  // The probability of following an edge rather than teleporting to a random
+  // vertex
+  double damping_factor{0.85};
+
+  // Iteration stops once the ranks change by less than this in the L1 norm
+  double tolerance{1e-6};
+
+  std::size_t max_iterations{100};
+};
+
+/**
+ * Computes the PageRank of every vertex of a graph by power iteration.
+ *
+ * Each iteration pulls the rank of every vertex from its incoming edges,
+ * which are laid out contiguously in compressed sparse row format, such that
+ * the inner loop is a branch-free sum over consecutive memory. The rank of
+ * dangling vertices, which have no outgoing edges, is spread evenly over all
+ * vertices. Edge weights are ignored; in undirected graphs every edge is
+ * followed in both directions.
+ *
+ * @param graph The graph to rank.
+ * @param options The damping factor and the convergence criteria.
+ * @return An unordered_map from every vertex to its rank. The ranks sum to 1.
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> pagerank(
+    const graph<V, E, T>& graph, const pagerank_options& options = {});
+
+/**
+ * Computes the PageRank of every vertex of a graph with the given execution
+ * policy.
+ *
+ * With a parallel policy, the ranks of the vertices are pulled in parallel on
+ * the default_executor. Up to rounding, the result equals that of the
+ * sequential algorithm.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see pagerank
+ */
+template <execution_policy POLICY_T, typename V, typename E, graph_type T>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> pagerank(
+    POLICY_T&& policy, const graph<V, E, T>& graph,
+    const pagerank_options& options = {});
+
+/**
+ * Computes the PageRank of every vertex of a graph in compressed sparse row
+ * format, without converting it to a graph first.
+ *
+ * @return The rank of every vertex, indexed by the index of the vertex in the
+ * csr_graph. The ranks sum to 1.
+ * @see pagerank
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] std::vector<double> pagerank(
+    const csr_graph<V, E, T>& graph, const pagerank_options& options = {});
+
+/**
+ * @see pagerank
+ */
+template <execution_policy POLICY_T, typename V, typename E, graph_type T>
+[[nodiscard]] std::vector<double> pagerank(
+    POLICY_T&& policy, const csr_graph<V, E, T>& graph,
+    const pagerank_options& options = {});
+
+/**
+ * @brief Options of personalized_pagerank.
+ */
+struct personalized_pagerank_options {
+  // The probability of following an edge rather than teleporting back to the
+  // teleport vertices. Must be in [0, 1).
+  double damping_factor{0.85};
+
+  // A vertex is only pushed while its residual rank is at least epsilon times
+  // its out-degree. The rank of every vertex is underestimated by at most
+  // epsilon times its out-degree. Must be positive.
+  double epsilon{1e-7};
+};
+
+/**
+ * Approximates the personalized PageRank of a graph, in which random surfers
+ * teleport to a few given vertices rather than to any vertex, e.g. to rank
+ * vertices by their relevance to those vertices.
+ *
+ * Uses the forward push algorithm of Andersen, Chung and Lang. Rank is pushed
+ * from the teleport vertices along the outgoing edges until the residual of
+ * every vertex is small, so only vertices near the teleport vertices are
+ * visited. Dangling vertices teleport back. Edge weights are ignored.
+ *
+ * The graph is first converted to compressed sparse row format. For repeated
+ * queries on the same graph, convert it once with make_csr_graph and use the
+ * overload for csr_graph, whose cost depends only on the visited vertices.
+ *
+ * @param graph The graph to rank.
+ * @param teleport The teleport weight of each teleport vertex, which are
+ * normalized to sum to 1.
+ * @param options The damping factor and the precision.
+ * @return An unordered_map from every visited vertex to its approximate rank.
+ * Vertices which are not present have a rank of zero.
+ * @throws invalid_argument - If a teleport vertex is not in the graph, a
+ * teleport weight is negative, all teleport weights are zero, or the damping
+ * factor or epsilon is out of range.
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> personalized_pagerank(
+    const graph<V, E, T>& graph,
+    const std::unordered_map<vertex_id_t, double>& teleport,
+    const personalized_pagerank_options& options = {});
+
+/**
+ * @see personalized_pagerank
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> personalized_pagerank(
+    const csr_graph<V, E, T>& graph,
+    const std::unordered_map<vertex_id_t, double>& teleport,
+    const personalized_pagerank_options& options = {});
+
+}  // namespace graaf::algorithm
+
+#include "pagerank.tpp"
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <graaflib/algorithm/dense_graph.h>
+#include <graaflib/executor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graaf::algorithm {
+
+namespace detail {
+
+// The incoming edges of every vertex in compressed sparse row format, along
+// with the out-degree of every vertex
+struct pagerank_layout {
+  std::vector<std::size_t> offsets{};
+  std::vector<std::size_t> sources{};
+  std::vector<std::size_t> out_degrees{};
+};
+
+template <typename ADJACENCY_T>
+[[nodiscard]] pagerank_layout make_pagerank_layout(
+    const ADJACENCY_T& adjacency) {
+  const auto vertex_count{adjacency.vertex_count()};
+  pagerank_layout layout{std::vector<std::size_t>(vertex_count + 1, 0), {},
+                         std::vector<std::size_t>(vertex_count, 0)};
+
+  for (std::size_t source{0}; source < vertex_count; ++source) {
+    const auto neighbors{adjacency.neighbors(source)};
+    layout.out_degrees[source] = neighbors.size();
+    for (const auto target : neighbors) {
+      ++layout.offsets[target + 1];
+    }
+  }
+  std::partial_sum(layout.offsets.begin(), layout.offsets.end(),
+                   layout.offsets.begin());
+
+  // Filling in order of the sources keeps the sources of every vertex sorted
+  layout.sources.resize(layout.offsets.back());
+  auto next_position{layout.offsets};
+  for (std::size_t source{0}; source < vertex_count; ++source) {
+    for (const auto target : adjacency.neighbors(source)) {
+      layout.sources[next_position[target]++] = source;
+    }
+  }
+  return layout;
+}
+
+[[nodiscard]] inline std::vector<double> pagerank_iterate(
+    const pagerank_layout& layout, const pagerank_options& options,
+    executor& executor) {
+  const auto vertex_count{layout.out_degrees.size()};
+  if (vertex_count == 0) {
+    return {};
+  }
+
+  const double damping{options.damping_factor};
+  const double uniform_rank{1.0 / static_cast<double>(vertex_count)};
+  std::vector<double> ranks(vertex_count, uniform_rank);
+  std::vector<double> next_ranks(vertex_count);
+  // The rank which every vertex passes along each of its outgoing edges
+  std::vector<double> contributions(vertex_count);
+
+  std::mutex sum_mutex{};
+  const parallel_for_options chunking{.grain_size = 1024};
+
+  for (std::size_t iteration{0}; iteration < options.max_iterations;
+       ++iteration) {
+    double dangling_rank{0};
+    parallel_for(
+        executor, 0, vertex_count,
+        [&](std::size_t begin, std::size_t end) {
+          double local_dangling_rank{0};
+          for (auto vertex{begin}; vertex < end; ++vertex) {
+            const auto out_degree{layout.out_degrees[vertex]};
+            if (out_degree == 0) {
+              local_dangling_rank += ranks[vertex];
+              contributions[vertex] = 0;
+            } else {
+              contributions[vertex] =
+                  ranks[vertex] / static_cast<double>(out_degree);
+            }
+          }
+          const std::lock_guard lock{sum_mutex};
+          dangling_rank += local_dangling_rank;
+        },
+        chunking);
+
+    // Teleports and the rank of dangling vertices reach every vertex alike
+    const double base_rank{(1 - damping + damping * dangling_rank) *
+                           uniform_rank};
+    double change{0};
+    parallel_for(
+        executor, 0, vertex_count,
+        [&](std::size_t begin, std::size_t end) {
+          double local_change{0};
+          for (auto vertex{begin}; vertex < end; ++vertex) {
+            double incoming_rank{0};
+            for (auto position{layout.offsets[vertex]};
+                 position < layout.offsets[vertex + 1]; ++position) {
+              incoming_rank += contributions[layout.sources[position]];
+            }
+            next_ranks[vertex] = base_rank + damping * incoming_rank;
+            local_change += std::abs(next_ranks[vertex] - ranks[vertex]);
+          }
+          const std::lock_guard lock{sum_mutex};
+          change += local_change;
+        },
+        chunking);
+
+    ranks.swap(next_ranks);
+    if (change < options.tolerance) {
+      break;
+    }
+  }
+  return ranks;
+}
+
+// Validates the teleport weights and normalizes them to sum to 1, keyed by
+// the index of the vertex in the adjacency
+template <typename GRAPH_T, typename ADJACENCY_T>
+[[nodiscard]] std::vector<std::pair<std::size_t, double>> normalize_teleport(
+    const GRAPH_T& graph, const ADJACENCY_T& adjacency,
+    const std::unordered_map<vertex_id_t, double>& teleport) {
+  std::vector<std::pair<std::size_t, double>> normalized{};
+  normalized.reserve(teleport.size());
+  double total_weight{0};
+
+  for (const auto& [vertex_id, weight] : teleport) {
+    if (!graph.has_vertex(vertex_id)) {
+      throw std::invalid_argument{"Vertex with ID [" +
+                                  std::to_string(vertex_id) +
+                                  "] not found in graph."};
+    }
+    if (weight < 0) {
+      std::ostringstream error_msg;
+      error_msg << "Negative teleport weight [" << weight << "] of vertex ["
+                << vertex_id << "].";
+      throw std::invalid_argument{error_msg.str()};
+    }
+    normalized.emplace_back(adjacency.index(vertex_id), weight);
+    total_weight += weight;
+  }
+
+  if (total_weight <= 0) {
+    throw std::invalid_argument{"Teleport weights must not all be zero."};
+  }
+  for (auto& [_, weight] : normalized) {
+    weight /= total_weight;
+  }
+  return normalized;
+}
+
+template <typename ADJACENCY_T>
+[[nodiscard]] std::unordered_map<vertex_id_t, double> forward_push(
+    const ADJACENCY_T& adjacency,
+    const std::vector<std::pair<std::size_t, double>>& teleport,
+    const personalized_pagerank_options& options) {
+  struct push_state {
+    double residual{0};
+    bool queued{false};
+  };
+
+  // Otherwise the residuals never drop below the threshold and pushing does
+  // not terminate
+  if (!(options.damping_factor >= 0 && options.damping_factor < 1)) {
+    std::ostringstream error_msg;
+    error_msg << "Damping factor [" << options.damping_factor
+              << "] must be in [0, 1).";
+    throw std::invalid_argument{error_msg.str()};
+  }
+  if (!(options.epsilon > 0)) {
+    std::ostringstream error_msg;
+    error_msg << "Epsilon [" << options.epsilon << "] must be positive.";
+    throw std::invalid_argument{error_msg.str()};
+  }
+
+  const double damping{options.damping_factor};
+  std::unordered_map<std::size_t, double> ranks{};
+  std::unordered_map<std::size_t, push_state> states{};
+  std::queue<std::size_t> to_push{};
+
+  const auto add_residual{[&](std::size_t vertex, double rank) {
+    auto& state{states[vertex]};
+    state.residual += rank;
+    const auto out_degree{
+        std::max<std::size_t>(adjacency.neighbors(vertex).size(), 1)};
+    if (!state.queued &&
+        state.residual >= options.epsilon * static_cast<double>(out_degree)) {
+      state.queued = true;
+      to_push.push(vertex);
+    }
+  }};
+
+  for (const auto& [vertex, weight] : teleport) {
+    add_residual(vertex, weight);
+  }
+
+  while (!to_push.empty()) {
+    const auto vertex{to_push.front()};
+    to_push.pop();
+    const double residual{std::exchange(states[vertex], {}).residual};
+    ranks[vertex] += (1 - damping) * residual;
+
+    const auto neighbors{adjacency.neighbors(vertex)};
+    if (neighbors.empty()) {
+      // Dangling vertices teleport back
+      for (const auto& [target, weight] : teleport) {
+        add_residual(target, damping * residual * weight);
+      }
+    } else {
+      const double share{damping * residual /
+                         static_cast<double>(neighbors.size())};
+      for (const auto neighbor : neighbors) {
+        add_residual(neighbor, share);
+      }
+    }
+  }
+
+  std::unordered_map<vertex_id_t, double> vertex_ranks{};
+  vertex_ranks.reserve(ranks.size());
+  for (const auto& [vertex, rank] : ranks) {
+    vertex_ranks.emplace(adjacency.vertex_id(vertex), rank);
+  }
+  return vertex_ranks;
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T>
+std::unordered_map<vertex_id_t, double> pagerank(
+    const graph<V, E, T>& graph, const pagerank_options& options) {
+  return pagerank(execution::seq, graph, options);
+}
+
+template <execution_policy POLICY_T, typename V, typename E, graph_type T>
+std::unordered_map<vertex_id_t, double> pagerank(
+    POLICY_T&& /*policy*/, const graph<V, E, T>& graph,
+    const pagerank_options& options) {
+  const auto dense_graph{detail::make_dense_graph(graph)};
+  const auto ranks{detail::pagerank_iterate(
+      detail::make_pagerank_layout(dense_graph), options,
+      graaf::detail::policy_executor<POLICY_T>())};
+
+  std::unordered_map<vertex_id_t, double> vertex_ranks{};
+  vertex_ranks.reserve(ranks.size());
+  for (std::size_t index{0}; index < ranks.size(); ++index) {
+    vertex_ranks.emplace(dense_graph.vertex_id(index), ranks[index]);
+  }
+  return vertex_ranks;
+}
+
+template <typename V, typename E, graph_type T>
+std::vector<double> pagerank(const csr_graph<V, E, T>& graph,
+                             const pagerank_options& options) {
+  return pagerank(execution::seq, graph, options);
+}
+
+template <execution_policy POLICY_T, typename V, typename E, graph_type T>
+std::vector<double> pagerank(POLICY_T&& /*policy*/,
+                             const csr_graph<V, E, T>& graph,
+                             const pagerank_options& options) {
+  return detail::pagerank_iterate(
+      detail::make_pagerank_layout(graph), options,
+      graaf::detail::policy_executor<POLICY_T>());
+}
+
+template <typename V, typename E, graph_type T>
+std::unordered_map<vertex_id_t, double> personalized_pagerank(
+    const graph<V, E, T>& graph,
+    const std::unordered_map<vertex_id_t, double>& teleport,
+    const personalized_pagerank_options& options) {
+  const auto dense_graph{detail::make_dense_graph(graph)};
+  return detail::forward_push(
+      dense_graph, detail::normalize_teleport(graph, dense_graph, teleport),
+      options);
+}
+
+template <typename V, typename E, graph_type T>
+std::unordered_map<vertex_id_t, double> personalized_pagerank(
+    const csr_graph<V, E, T>& graph,
+    const std::unordered_map<vertex_id_t, double>& teleport,
+    const personalized_pagerank_options& options) {
+  return detail::forward_push(
+      graph, detail::normalize_teleport(graph, graph, teleport), options);
+}
+
+}  // namespace graaf::algorithm
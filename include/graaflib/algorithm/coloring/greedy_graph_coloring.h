@@ -1,5 +1,6 @@
 #pragma once
 
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
@@ -21,6 +22,22 @@ namespace graaf::algorithm {
 template <typename GRAPH>
 std::unordered_map<vertex_id_t, int> greedy_graph_coloring(const GRAPH& graph);
 
+/**
+ * @brief Greedy Graph Coloring Algorithm with the given execution policy.
+ *
+ * With a parallel policy, the vertices are colored speculatively in parallel
+ * on the default_executor. Adjacent vertices which picked the same color are
+ * detected afterwards, and one of each pair is colored again until no such
+ * conflicts remain. Edges are considered regardless of their direction. The
+ * number of colors may differ from that of the sequential algorithm.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see greedy_graph_coloring
+ */
+template <execution_policy POLICY_T, typename GRAPH>
+std::unordered_map<vertex_id_t, int> greedy_graph_coloring(POLICY_T&& policy,
+                                                           const GRAPH& graph);
+
 }  // namespace graaf::algorithm
 
 #include "greedy_graph_coloring.tpp"
\ No newline at end of file
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <graaflib/algorithm/coloring/greedy_graph_coloring.h>
+#include <graaflib/algorithm/dense_graph.h>
+#include <graaflib/executor.h>
 
+#include <atomic>
+#include <mutex>
+#include <numeric>
 #include <unordered_map>
+#include <vector>
 
 namespace graaf::algorithm {
 
@@ -35,4 +41,99 @@ std::unordered_map<vertex_id_t, int> greedy_graph_coloring(const GRAPH& graph) {
   return coloring;
 }
 
+namespace detail {
+
+template <typename GRAPH>
+std::unordered_map<vertex_id_t, int> parallel_greedy_graph_coloring(
+    const GRAPH& graph) {
+  const auto dense_graph{
+      make_dense_graph(graph, dense_adjacency::SYMMETRIC)};
+  const auto vertex_count{dense_graph.vertex_count()};
+  constexpr int uncolored{-1};
+
+  std::vector<std::atomic<int>> colors(vertex_count);
+  for (auto& color : colors) {
+    color.store(uncolored, std::memory_order_relaxed);
+  }
+
+  std::vector<std::size_t> worklist(vertex_count);
+  std::iota(worklist.begin(), worklist.end(), std::size_t{0});
+
+  while (!worklist.empty()) {
+    // Neighbors may be colored concurrently, so two of them can pick the same
+    // color. Such conflicts are resolved in the next step.
+    parallel_for(
+        default_executor(), 0, worklist.size(),
+        [&](std::size_t begin, std::size_t end) {
+          std::vector<bool> taken{};
+          for (auto position{begin}; position < end; ++position) {
+            const auto vertex{worklist[position]};
+            const auto neighbors{dense_graph.neighbors(vertex)};
+            taken.assign(neighbors.size() + 1, false);
+            for (const auto neighbor : neighbors) {
+              const auto color{
+                  colors[neighbor].load(std::memory_order_relaxed)};
+              if (neighbor != vertex && color != uncolored &&
+                  static_cast<std::size_t>(color) < taken.size()) {
+                taken[static_cast<std::size_t>(color)] = true;
+              }
+            }
+            int color{0};
+            while (taken[static_cast<std::size_t>(color)]) {
+              ++color;
+            }
+            colors[vertex].store(color, std::memory_order_relaxed);
+          }
+        },
+        {.grain_size = 64});
+
+    // Of two adjacent vertices with the same color, the one with the higher
+    // index is colored again
+    std::mutex conflicts_mutex{};
+    std::vector<std::size_t> conflicts{};
+    parallel_for(
+        default_executor(), 0, worklist.size(),
+        [&](std::size_t begin, std::size_t end) {
+          std::vector<std::size_t> local_conflicts{};
+          for (auto position{begin}; position < end; ++position) {
+            const auto vertex{worklist[position]};
+            const auto color{colors[vertex].load(std::memory_order_relaxed)};
+            for (const auto neighbor : dense_graph.neighbors(vertex)) {
+              if (neighbor < vertex &&
+                  colors[neighbor].load(std::memory_order_relaxed) == color) {
+                local_conflicts.push_back(vertex);
+                break;
+              }
+            }
+          }
+          const std::lock_guard lock{conflicts_mutex};
+          conflicts.insert(conflicts.end(), local_conflicts.begin(),
+                           local_conflicts.end());
+        },
+        {.grain_size = 64});
+
+    worklist = std::move(conflicts);
+  }
+
+  std::unordered_map<vertex_id_t, int> coloring{};
+  coloring.reserve(vertex_count);
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    coloring.emplace(dense_graph.vertex_id(vertex),
+                     colors[vertex].load(std::memory_order_relaxed));
+  }
+  return coloring;
+}
+
+}  // namespace detail
+
+template <execution_policy POLICY_T, typename GRAPH>
+std::unordered_map<vertex_id_t, int> greedy_graph_coloring(
+    POLICY_T&& /*policy*/, const GRAPH& graph) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_greedy_graph_coloring(graph);
+  } else {
+    return greedy_graph_coloring(graph);
+  }
+}
+
 }  // namespace graaf::algorithm
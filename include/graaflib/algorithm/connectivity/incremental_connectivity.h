@@ -0,0 +1,117 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief An index answering whether two vertices of an undirected graph are
+ * connected, which is kept up to date as the graph grows.
+ *
+ * The connected components are kept in a disjoint set union with union by
+ * size and path halving, so a query takes amortized near-constant time
+ * instead of a traversal of the graph.
+ *
+ * When attached to the graph with graph::set_observer, every vertex and edge
+ * added to the graph is merged into the index in near-constant time. Removing
+ * a vertex or an edge may split a component, which a disjoint set union
+ * cannot undo, so the index is instead rebuilt from the graph on the next
+ * query, as it is after the graph is assigned to. Changes made while the
+ * index was not attached are detected through graph::version and handled the
+ * same way.
+ *
+ * The graph must outlive the index, and the index must be detached from the
+ * graph before it is destroyed. Like the graph, the index is not safe to use
+ * from several threads at once.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph.
+ */
+template <typename V, typename E>
+class incremental_connectivity : public graph_observer {
+ public:
+  using graph_t = graph<V, E, graph_type::UNDIRECTED>;
+
+  explicit incremental_connectivity(const graph_t& graph);
+
+  // The graph refers to its observer by address
+  incremental_connectivity(const incremental_connectivity&) = delete;
+  incremental_connectivity& operator=(const incremental_connectivity&) =
+      delete;
+
+  /**
+   * Checks whether a path exists between two vertices.
+   *
+   * @param vertex_id_lhs The ID of the first vertex.
+   * @param vertex_id_rhs The ID of the second vertex.
+   * @return bool - True if both vertices are in the same component.
+   * @throws invalid_argument - If either vertex is not in the graph.
+   */
+  [[nodiscard]] bool connected(vertex_id_t vertex_id_lhs,
+                               vertex_id_t vertex_id_rhs);
+
+  /**
+   * Checks for every pair of vertices whether a path exists between them. The
+   * index is brought up to date once for the whole batch.
+   *
+   * @param vertex_pairs The pairs of vertices to check.
+   * @return A vector holding for every pair whether its vertices are
+   * connected, in the order of the pairs.
+   * @throws invalid_argument - If any vertex is not in the graph.
+   */
+  [[nodiscard]] std::vector<bool> connected(
+      const std::vector<std::pair<vertex_id_t, vertex_id_t>>& vertex_pairs);
+
+  // The number of connected components of the graph
+  [[nodiscard]] std::size_t component_count();
+
+  // The number of times the index was rebuilt from the graph after it was
+  // built initially
+  [[nodiscard]] std::size_t rebuild_count() const noexcept {
+    return rebuild_count_;
+  }
+
+  void on_vertex_added(vertex_id_t vertex_id) override;
+  void on_vertex_removed(vertex_id_t vertex_id) override;
+  void on_edge_added(vertex_id_t vertex_id_lhs,
+                     vertex_id_t vertex_id_rhs) override;
+  void on_edge_removed(vertex_id_t vertex_id_lhs,
+                       vertex_id_t vertex_id_rhs) override;
+  void on_graph_replaced() noexcept override { stale_ = true; }
+
+ private:
+  struct disjoint_set {
+    vertex_id_t parent;
+    std::size_t size;
+  };
+
+  // Whether the notified change is the only one since the index was last in
+  // sync with the graph, such that it can be applied incrementally
+  [[nodiscard]] bool follows_last_sync() const noexcept;
+
+  void rebuild();
+  void sync();
+
+  [[nodiscard]] vertex_id_t find(vertex_id_t vertex_id);
+  void merge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs);
+
+  const graph_t& graph_;
+
+  std::unordered_map<vertex_id_t, disjoint_set> sets_{};
+  std::size_t component_count_{0};
+
+  std::uint64_t version_{0};
+  bool stale_{false};
+  std::size_t rebuild_count_{0};
+};
+
+}  // namespace graaf::algorithm
+
+#include "incremental_connectivity.tpp"
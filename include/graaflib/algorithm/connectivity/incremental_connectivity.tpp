@@ -0,0 +1,143 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace graaf::algorithm {
+
+template <typename V, typename E>
+incremental_connectivity<V, E>::incremental_connectivity(const graph_t& graph)
+    : graph_{graph} {
+  rebuild();
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::rebuild() {
+  sets_.clear();
+  sets_.reserve(graph_.vertex_count());
+  component_count_ = 0;
+  for (const auto& [vertex_id, _] : graph_.get_vertices()) {
+    sets_.emplace(vertex_id, disjoint_set{vertex_id, 1});
+    ++component_count_;
+  }
+  for (const auto& [edge_id, _] : graph_.get_edges()) {
+    merge(edge_id.first, edge_id.second);
+  }
+
+  version_ = graph_.version();
+  stale_ = false;
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::sync() {
+  if (stale_ || version_ != graph_.version()) {
+    rebuild();
+    ++rebuild_count_;
+  }
+}
+
+template <typename V, typename E>
+bool incremental_connectivity<V, E>::follows_last_sync() const noexcept {
+  // Additions are notified right after the version of the graph is increased
+  return !stale_ && version_ + 1 == graph_.version();
+}
+
+template <typename V, typename E>
+vertex_id_t incremental_connectivity<V, E>::find(vertex_id_t vertex_id) {
+  const auto set{sets_.find(vertex_id)};
+  if (set == sets_.end()) {
+    throw std::invalid_argument{"Vertex with ID [" +
+                                std::to_string(vertex_id) +
+                                "] not found in graph."};
+  }
+
+  auto* current{&set->second};
+  while (current->parent != vertex_id) {
+    auto& parent{sets_.at(current->parent)};
+    current->parent = parent.parent;
+    vertex_id = current->parent;
+    current = &sets_.at(vertex_id);
+  }
+  return vertex_id;
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::merge(vertex_id_t vertex_id_lhs,
+                                           vertex_id_t vertex_id_rhs) {
+  auto root_lhs{find(vertex_id_lhs)};
+  auto root_rhs{find(vertex_id_rhs)};
+  if (root_lhs == root_rhs) {
+    return;
+  }
+
+  auto* set_lhs{&sets_.at(root_lhs)};
+  auto* set_rhs{&sets_.at(root_rhs)};
+  if (set_lhs->size < set_rhs->size) {
+    std::swap(root_lhs, root_rhs);
+    std::swap(set_lhs, set_rhs);
+  }
+  set_rhs->parent = root_lhs;
+  set_lhs->size += set_rhs->size;
+  --component_count_;
+}
+
+template <typename V, typename E>
+bool incremental_connectivity<V, E>::connected(vertex_id_t vertex_id_lhs,
+                                               vertex_id_t vertex_id_rhs) {
+  sync();
+  return find(vertex_id_lhs) == find(vertex_id_rhs);
+}
+
+template <typename V, typename E>
+std::vector<bool> incremental_connectivity<V, E>::connected(
+    const std::vector<std::pair<vertex_id_t, vertex_id_t>>& vertex_pairs) {
+  sync();
+  std::vector<bool> connected_pairs{};
+  connected_pairs.reserve(vertex_pairs.size());
+  for (const auto& [vertex_id_lhs, vertex_id_rhs] : vertex_pairs) {
+    connected_pairs.push_back(find(vertex_id_lhs) == find(vertex_id_rhs));
+  }
+  return connected_pairs;
+}
+
+template <typename V, typename E>
+std::size_t incremental_connectivity<V, E>::component_count() {
+  sync();
+  return component_count_;
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::on_vertex_added(vertex_id_t vertex_id) {
+  if (!follows_last_sync()) {
+    stale_ = true;
+    return;
+  }
+  sets_.emplace(vertex_id, disjoint_set{vertex_id, 1});
+  ++component_count_;
+  version_ = graph_.version();
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::on_vertex_removed(
+    vertex_id_t /*vertex_id*/) {
+  stale_ = true;
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::on_edge_added(vertex_id_t vertex_id_lhs,
+                                                   vertex_id_t vertex_id_rhs) {
+  if (!follows_last_sync()) {
+    stale_ = true;
+    return;
+  }
+  merge(vertex_id_lhs, vertex_id_rhs);
+  version_ = graph_.version();
+}
+
+template <typename V, typename E>
+void incremental_connectivity<V, E>::on_edge_removed(
+    vertex_id_t /*vertex_id_lhs*/, vertex_id_t /*vertex_id_rhs*/) {
+  stale_ = true;
+}
+
+}  // namespace graaf::algorithm
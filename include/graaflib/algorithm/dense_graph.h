@@ -0,0 +1,97 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace graaf::algorithm::detail {
+
+/**
+ * @brief Which edges a dense_graph holds for every vertex.
+ */
+enum class dense_adjacency {
+  // The neighbors of graph::get_neighbors
+  OUTGOING,
+  // The vertices of which the vertex is a neighbor
+  INCOMING,
+  // The union of both, i.e. the edges regardless of their direction
+  SYMMETRIC,
+  // The edges in the direction of their edge_id as stored by
+  // graph::get_edges, also for undirected graphs
+  STORED
+};
+
+/**
+ * @brief A read-only snapshot of a graph in compressed sparse row format.
+ *
+ * Vertices are numbered densely from zero, such that per-vertex state of the
+ * parallel algorithms can be kept in vectors instead of hash maps, and the
+ * neighbors of a vertex are contiguous. Unlike graph::get_neighbors, reading
+ * the neighbors does not copy them, which would serialize the threads of a
+ * parallel algorithm on the allocator.
+ */
+template <typename EDGE_T>
+class dense_graph {
+ public:
+  [[nodiscard]] std::size_t vertex_count() const noexcept {
+    return vertex_ids_.size();
+  }
+
+  [[nodiscard]] std::size_t edge_count() const noexcept {
+    return targets_.size();
+  }
+
+  [[nodiscard]] vertex_id_t vertex_id(std::size_t index) const noexcept {
+    return vertex_ids_[index];
+  }
+
+  [[nodiscard]] std::size_t index(vertex_id_t vertex_id) const {
+    return indices_.at(vertex_id);
+  }
+
+  [[nodiscard]] bool contains(vertex_id_t vertex_id) const {
+    return indices_.contains(vertex_id);
+  }
+
+  // The indices of the neighbors of the vertex with the given index
+  [[nodiscard]] std::span<const std::size_t> neighbors(
+      std::size_t index) const noexcept {
+    return {targets_.data() + offsets_[index],
+            offsets_[index + 1] - offsets_[index]};
+  }
+
+  // The edges to the neighbors, in the same order as the neighbors
+  [[nodiscard]] std::span<const EDGE_T* const> edges(
+      std::size_t index) const noexcept {
+    return {edges_.data() + offsets_[index],
+            offsets_[index + 1] - offsets_[index]};
+  }
+
+  template <typename V, typename E, graph_type T>
+  friend dense_graph<E> make_dense_graph(const graph<V, E, T>& graph,
+                                         dense_adjacency adjacency);
+
+ private:
+  std::vector<vertex_id_t> vertex_ids_{};
+  std::unordered_map<vertex_id_t, std::size_t> indices_{};
+  std::vector<std::size_t> offsets_{};
+  std::vector<std::size_t> targets_{};
+  std::vector<const EDGE_T*> edges_{};
+};
+
+/**
+ * @brief Creates a dense_graph of the graph. For undirected graphs, all
+ * adjacencies but STORED are the same.
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] dense_graph<E> make_dense_graph(
+    const graph<V, E, T>& graph,
+    dense_adjacency adjacency = dense_adjacency::OUTGOING);
+
+}  // namespace graaf::algorithm::detail
+
+#include "dense_graph.tpp"
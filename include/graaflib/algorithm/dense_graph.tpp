@@ -0,0 +1,64 @@
+#pragma once
+
+namespace graaf::algorithm::detail {
+
+template <typename V, typename E, graph_type T>
+dense_graph<E> make_dense_graph(const graph<V, E, T>& graph,
+                                dense_adjacency adjacency) {
+  dense_graph<E> dense{};
+
+  dense.vertex_ids_.reserve(graph.vertex_count());
+  dense.indices_.reserve(graph.vertex_count());
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    dense.indices_.emplace(vertex_id, dense.vertex_ids_.size());
+    dense.vertex_ids_.push_back(vertex_id);
+  }
+
+  // Undirected edges are stored once, but are adjacent to both vertices unless
+  // only the stored direction is requested. A self loop is a single adjacency.
+  const bool outgoing{T == graph_type::UNDIRECTED ||
+                      adjacency != dense_adjacency::INCOMING};
+  const bool incoming{adjacency != dense_adjacency::STORED &&
+                      (T == graph_type::UNDIRECTED ||
+                       adjacency != dense_adjacency::OUTGOING)};
+
+  const auto for_each_adjacency{[&](const auto& add) {
+    for (const auto& [edge_id, edge] : graph.get_edges()) {
+      const auto source{dense.indices_.at(edge_id.first)};
+      const auto target{dense.indices_.at(edge_id.second)};
+      if (outgoing) {
+        add(source, target, edge);
+      }
+      if (incoming && source != target) {
+        add(target, source, edge);
+      }
+    }
+  }};
+
+  // Counting sort of the adjacencies by their source
+  const auto vertex_count{dense.vertex_ids_.size()};
+  dense.offsets_.assign(vertex_count + 1, 0);
+  for_each_adjacency(
+      [&dense](std::size_t source, std::size_t /*target*/, const E& /*edge*/) {
+        ++dense.offsets_[source + 1];
+      });
+  for (std::size_t index{0}; index < vertex_count; ++index) {
+    dense.offsets_[index + 1] += dense.offsets_[index];
+  }
+
+  dense.targets_.resize(dense.offsets_.back());
+  dense.edges_.resize(dense.offsets_.back());
+  std::vector<std::size_t> next_slot(dense.offsets_.begin(),
+                                     dense.offsets_.end() - 1);
+  for_each_adjacency(
+      [&dense, &next_slot](std::size_t source, std::size_t target,
+                           const E& edge) {
+        const auto slot{next_slot[source]++};
+        dense.targets_[slot] = target;
+        dense.edges_[slot] = &edge;
+      });
+
+  return dense;
+}
+
+}  // namespace graaf::algorithm::detail
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <graaflib/types.h>
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <stop_token>
+#include <string_view>
+#include <utility>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief Limits on the execution of one or more algorithm invocations.
+ */
+struct execution_limits {
+  // Algorithms stop when a stop is requested on the associated stop source
+  std::stop_token stop_token{};
+
+  // Wall clock time, measured from the construction of the execution_budget
+  std::optional<std::chrono::steady_clock::duration> time_budget{};
+
+  // Number of edge relaxations, summed over all algorithm invocations
+  std::optional<std::size_t> max_edge_relaxations{};
+};
+
+/**
+ * @brief The reason why the algorithms using an execution_budget stopped.
+ */
+enum class execution_status {
+  COMPLETED,
+  CANCELLED,
+  DEADLINE_EXCEEDED,
+  WORK_BUDGET_EXHAUSTED
+};
+
+/**
+ * @brief A stoppable_observer which stops algorithms on cancellation, after a
+ * deadline or after a number of edge relaxations.
+ *
+ * The budget is shared by all algorithms it is passed to. Once exhausted, all
+ * subsequent algorithms return immediately. An algorithm which is stopped
+ * returns the partial result it computed so far, e.g. upper bounds on the
+ * distances for the shortest path algorithms, and does not perform checks
+ * which require a complete run, such as the negative cycle detection of
+ * Bellman-Ford. Whether the result is complete is given by status().
+ *
+ * The work budget is checked every time the algorithm polls the budget, the
+ * stop token and the clock only every poll_interval polls. Hence an algorithm
+ * may overshoot the work budget by the degree of a vertex, or the time budget
+ * by the work of poll_interval iterations of its main loop.
+ */
+class execution_budget {
+ public:
+  static constexpr std::size_t poll_interval{64};
+
+  explicit execution_budget(execution_limits limits)
+      : limits_{std::move(limits)} {
+    if (limits_.time_budget) {
+      deadline_ = std::chrono::steady_clock::now() + *limits_.time_budget;
+    }
+  }
+
+  void on_begin(std::string_view /*algorithm*/) noexcept {}
+  void on_end(std::string_view /*algorithm*/) noexcept {}
+  void on_vertex_settled(vertex_id_t /*vertex_id*/) noexcept {}
+
+  void on_edge_relaxed(const edge_id_t& /*edge_id*/) noexcept {
+    ++edges_relaxed_;
+  }
+
+  void on_queue_push(std::size_t /*queue_size*/) noexcept {}
+  void on_queue_pop(std::size_t /*queue_size*/) noexcept {}
+
+  [[nodiscard]] bool stop_requested() noexcept {
+    if (status_ != execution_status::COMPLETED) {
+      return true;
+    }
+
+    if (limits_.max_edge_relaxations &&
+        edges_relaxed_ >= *limits_.max_edge_relaxations) {
+      status_ = execution_status::WORK_BUDGET_EXHAUSTED;
+      return true;
+    }
+
+    // Reading the clock costs about as much as an iteration of a hot loop
+    if (polls_until_check_ > 0) {
+      --polls_until_check_;
+      return false;
+    }
+    polls_until_check_ = poll_interval - 1;
+
+    if (limits_.stop_token.stop_requested()) {
+      status_ = execution_status::CANCELLED;
+    } else if (deadline_ && std::chrono::steady_clock::now() >= *deadline_) {
+      status_ = execution_status::DEADLINE_EXCEEDED;
+    }
+    return status_ != execution_status::COMPLETED;
+  }
+
+  /**
+   * @brief COMPLETED if the budget did not stop any algorithm, otherwise the
+   * reason why it did.
+   */
+  [[nodiscard]] execution_status status() const noexcept { return status_; }
+
+  [[nodiscard]] std::size_t edges_relaxed() const noexcept {
+    return edges_relaxed_;
+  }
+
+ private:
+  execution_limits limits_;
+  std::optional<std::chrono::steady_clock::time_point> deadline_{};
+  std::size_t edges_relaxed_{0};
+  // The first poll checks the stop token and the clock
+  std::size_t polls_until_check_{0};
+  execution_status status_{execution_status::COMPLETED};
+};
+
+}  // namespace graaf::algorithm
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <graaflib/algorithm/graph_traversal/common.h>
+#include <graaflib/algorithm/observer.h>
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
 #include <concepts>
+#include <type_traits>
 
 namespace graaf::algorithm {
 
@@ -19,16 +22,50 @@ namespace graaf::algorithm {
  * @param search_termination_strategy A unary predicate to indicate whether we
  * should continue the traversal or not. Traversal continues while this
  * predicate returns false.
+ * @param observer An algorithm_observer notified of the visited vertices,
+ * examined edges and the queue of vertices to explore, or a
+ * stoppable_observer to end the traversal early.
  */
 template <
     typename V, typename E, graph_type T,
     typename EDGE_CALLBACK_T = detail::noop_callback,
+    typename SEARCH_TERMINATION_STRATEGY_T = detail::exhaustive_search_strategy,
+    typename OBSERVER_T = detail::noop_observer>
+  requires std::invocable<EDGE_CALLBACK_T &, edge_id_t &> &&
+           std::is_invocable_r_v<bool, SEARCH_TERMINATION_STRATEGY_T &,
+                                 vertex_id_t> &&
+           algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+void breadth_first_traverse(
+    const graph<V, E, T> &graph, vertex_id_t start_vertex,
+    const EDGE_CALLBACK_T &edge_callback,
+    const SEARCH_TERMINATION_STRATEGY_T &search_termination_strategy =
+        SEARCH_TERMINATION_STRATEGY_T{},
+    OBSERVER_T &&observer = OBSERVER_T{});
+
+/**
+ * @brief Traverses the graph in a BFS manner with the given execution policy.
+ *
+ * With a parallel policy, the vertices are expanded level by level and the
+ * vertices of a level are expanded in parallel on the default_executor. Every
+ * reachable vertex is still reached through exactly one traversed edge, but
+ * which one depends on the scheduling, as does the order of the callbacks.
+ * The edge callback and the search termination strategy are invoked
+ * concurrently. Once the search termination strategy returns true, no further
+ * vertices are expanded, although vertices of the same level which are being
+ * expanded concurrently may still report edges.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see breadth_first_traverse
+ */
+template <
+    execution_policy POLICY_T, typename V, typename E, graph_type T,
+    typename EDGE_CALLBACK_T = detail::noop_callback,
     typename SEARCH_TERMINATION_STRATEGY_T = detail::exhaustive_search_strategy>
   requires std::invocable<EDGE_CALLBACK_T &, edge_id_t &> &&
            std::is_invocable_r_v<bool, SEARCH_TERMINATION_STRATEGY_T &,
                                  vertex_id_t>
 void breadth_first_traverse(
-    const graph<V, E, T> &graph, vertex_id_t start_vertex,
+    POLICY_T &&policy, const graph<V, E, T> &graph, vertex_id_t start_vertex,
     const EDGE_CALLBACK_T &edge_callback,
     const SEARCH_TERMINATION_STRATEGY_T &search_termination_strategy =
         SEARCH_TERMINATION_STRATEGY_T{});
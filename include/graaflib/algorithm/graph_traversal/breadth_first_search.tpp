@@ -1,41 +1,139 @@
 #pragma once
 
+#include <graaflib/algorithm/dense_graph.h>
+#include <graaflib/executor.h>
+
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <queue>
 #include <unordered_set>
+#include <vector>
 
 namespace graaf::algorithm {
 
+namespace detail {
+
 template <typename V, typename E, graph_type T, typename EDGE_CALLBACK_T,
           typename SEARCH_TERMINATION_STRATEGY_T>
+void parallel_breadth_first_traverse(
+    const graph<V, E, T>& graph, vertex_id_t start_vertex,
+    const EDGE_CALLBACK_T& edge_callback,
+    const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy) {
+  const auto dense_graph{make_dense_graph(graph)};
+  if (!dense_graph.contains(start_vertex)) {
+    [[maybe_unused]] const auto terminated{
+        search_termination_strategy(start_vertex)};
+    return;
+  }
+
+  const auto start_index{dense_graph.index(start_vertex)};
+  std::vector<std::atomic<bool>> seen(dense_graph.vertex_count());
+  seen[start_index] = true;
+
+  std::atomic<bool> terminated{false};
+  std::vector<std::size_t> frontier{start_index};
+  std::mutex next_frontier_mutex{};
+
+  while (!frontier.empty() && !terminated) {
+    std::vector<std::size_t> next_frontier{};
+
+    const auto expand{[&](std::size_t begin, std::size_t end) {
+      std::vector<std::size_t> discovered{};
+      for (auto position{begin}; position < end && !terminated; ++position) {
+        const auto current{frontier[position]};
+        const auto current_id{dense_graph.vertex_id(current)};
+        if (search_termination_strategy(current_id)) {
+          terminated = true;
+          break;
+        }
+
+        for (const auto neighbor : dense_graph.neighbors(current)) {
+          // Reading first avoids contended writes to vertices seen before
+          if (!seen[neighbor].load(std::memory_order_relaxed) &&
+              !seen[neighbor].exchange(true, std::memory_order_relaxed)) {
+            edge_callback(
+                edge_id_t{current_id, dense_graph.vertex_id(neighbor)});
+            discovered.push_back(neighbor);
+          }
+        }
+      }
+
+      const std::lock_guard lock{next_frontier_mutex};
+      next_frontier.insert(next_frontier.end(), discovered.begin(),
+                           discovered.end());
+    }};
+
+    parallel_for(default_executor(), 0, frontier.size(), expand,
+                 {.grain_size = 64});
+    frontier = std::move(next_frontier);
+  }
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T, typename EDGE_CALLBACK_T,
+          typename SEARCH_TERMINATION_STRATEGY_T, typename OBSERVER_T>
   requires std::invocable<EDGE_CALLBACK_T&, edge_id_t&> &&
            std::is_invocable_r_v<bool, SEARCH_TERMINATION_STRATEGY_T&,
-                                 vertex_id_t>
+                                 vertex_id_t> &&
+           algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 void breadth_first_traverse(
     const graph<V, E, T>& graph, vertex_id_t start_vertex,
     const EDGE_CALLBACK_T& edge_callback,
-    const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy) {
-  std::unordered_set<vertex_id_t> seen_vertices{};
+    const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy,
+    OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "breadth_first_traverse"};
+
+  // Vertices are marked as seen when they are queued, such that every vertex
+  // is queued at most once
+  std::unordered_set<vertex_id_t> seen_vertices{start_vertex};
   std::queue<vertex_id_t> to_explore{};
 
   to_explore.push(start_vertex);
+  observer.on_queue_push(to_explore.size());
 
   while (!to_explore.empty()) {
+    if (detail::stop_requested(observer)) {
+      return;
+    }
+
     const auto current{to_explore.front()};
     to_explore.pop();
+    observer.on_queue_pop(to_explore.size());
 
     if (search_termination_strategy(current)) {
       return;
     }
+    observer.on_vertex_settled(current);
 
-    seen_vertices.insert(current);
     for (const auto neighbor_vertex : graph.get_neighbors(current)) {
-      if (!seen_vertices.contains(neighbor_vertex)) {
+      observer.on_edge_relaxed(edge_id_t{current, neighbor_vertex});
+      if (seen_vertices.insert(neighbor_vertex).second) {
         edge_callback(edge_id_t{current, neighbor_vertex});
         to_explore.push(neighbor_vertex);
+        observer.on_queue_push(to_explore.size());
       }
     }
   }
 }
 
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename EDGE_CALLBACK_T, typename SEARCH_TERMINATION_STRATEGY_T>
+  requires std::invocable<EDGE_CALLBACK_T&, edge_id_t&> &&
+           std::is_invocable_r_v<bool, SEARCH_TERMINATION_STRATEGY_T&,
+                                 vertex_id_t>
+void breadth_first_traverse(
+    POLICY_T&& /*policy*/, const graph<V, E, T>& graph,
+    vertex_id_t start_vertex, const EDGE_CALLBACK_T& edge_callback,
+    const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    detail::parallel_breadth_first_traverse(graph, start_vertex, edge_callback,
+                                            search_termination_strategy);
+  } else {
+    breadth_first_traverse(graph, start_vertex, edge_callback,
+                           search_termination_strategy);
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <graaflib/algorithm/graph_traversal/common.h>
+#include <graaflib/algorithm/observer.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
 #include <concepts>
+#include <type_traits>
 
 namespace graaf::algorithm {
 
@@ -19,19 +21,25 @@ namespace graaf::algorithm {
  * @param search_termination_strategy A unary predicate to indicate whether we
  * should continue the traversal or not. Traversal continues while this
  * predicate returns false.
+ * @param observer An algorithm_observer notified of the visited vertices,
+ * examined edges and the depth of the search as queue size, or a
+ * stoppable_observer to end the traversal early.
  */
 template <
     typename V, typename E, graph_type T,
     typename EDGE_CALLBACK_T = detail::noop_callback,
-    typename SEARCH_TERMINATION_STRATEGY_T = detail::exhaustive_search_strategy>
+    typename SEARCH_TERMINATION_STRATEGY_T = detail::exhaustive_search_strategy,
+    typename OBSERVER_T = detail::noop_observer>
   requires std::invocable<EDGE_CALLBACK_T &, edge_id_t &> &&
            std::is_invocable_r_v<bool, SEARCH_TERMINATION_STRATEGY_T &,
-                                 vertex_id_t>
+                                 vertex_id_t> &&
+           algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 void depth_first_traverse(
     const graph<V, E, T> &graph, vertex_id_t start_vertex,
     const EDGE_CALLBACK_T &edge_callback,
     const SEARCH_TERMINATION_STRATEGY_T &search_termination_strategy =
-        SEARCH_TERMINATION_STRATEGY_T{});
+        SEARCH_TERMINATION_STRATEGY_T{},
+    OBSERVER_T &&observer = OBSERVER_T{});
 
 }  // namespace graaf::algorithm
 
@@ -9,22 +9,33 @@ namespace graaf::algorithm {
 namespace detail {
 
 template <typename V, typename E, graph_type T, typename EDGE_CALLBACK_T,
-          typename SEARCH_TERMINATION_STRATEGY_T>
+          typename SEARCH_TERMINATION_STRATEGY_T, typename OBSERVER_T>
 bool do_dfs(const graph<V, E, T>& graph,
             std::unordered_set<vertex_id_t>& seen_vertices, vertex_id_t current,
             const EDGE_CALLBACK_T& edge_callback,
-            const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy) {
+            const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy,
+            OBSERVER_T& observer, std::size_t depth) {
   seen_vertices.insert(current);
 
-  if (search_termination_strategy(current)) {
+  if (search_termination_strategy(current) ||
+      detail::stop_requested(observer)) {
     return false;
   }
+  observer.on_vertex_settled(current);
 
   for (auto neighbor_vertex : graph.get_neighbors(current)) {
+    observer.on_edge_relaxed(edge_id_t{current, neighbor_vertex});
     if (!seen_vertices.contains(neighbor_vertex)) {
       edge_callback(edge_id_t{current, neighbor_vertex});
-      if (!do_dfs(graph, seen_vertices, neighbor_vertex, edge_callback,
-                  search_termination_strategy)) {
+
+      // The call stack acts as the queue of pending vertices
+      observer.on_queue_push(depth + 1);
+      const auto continue_search{do_dfs(graph, seen_vertices, neighbor_vertex,
+                                        edge_callback,
+                                        search_termination_strategy, observer,
+                                        depth + 1)};
+      observer.on_queue_pop(depth);
+      if (!continue_search) {
         // Further down the call stack we have hit the search termination point.
         // Bubble this up the call stack.
         return false;
@@ -39,17 +50,23 @@ bool do_dfs(const graph<V, E, T>& graph,
 }  // namespace detail
 
 template <typename V, typename E, graph_type T, typename EDGE_CALLBACK_T,
-          typename SEARCH_TERMINATION_STRATEGY_T>
+          typename SEARCH_TERMINATION_STRATEGY_T, typename OBSERVER_T>
   requires std::invocable<EDGE_CALLBACK_T&, edge_id_t&> &&
            std::is_invocable_r_v<bool, SEARCH_TERMINATION_STRATEGY_T&,
-                                 vertex_id_t>
+                                 vertex_id_t> &&
+           algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 void depth_first_traverse(
     const graph<V, E, T>& graph, vertex_id_t start_vertex,
     const EDGE_CALLBACK_T& edge_callback,
-    const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy) {
+    const SEARCH_TERMINATION_STRATEGY_T& search_termination_strategy,
+    OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "depth_first_traverse"};
+
   std::unordered_set<vertex_id_t> seen_vertices{};
+  observer.on_queue_push(1);
   detail::do_dfs(graph, seen_vertices, start_vertex, edge_callback,
-                 search_termination_strategy);
+                 search_termination_strategy, observer, 1);
+  observer.on_queue_pop(0);
 }
 
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
+#include <type_traits>
 #include <vector>
 
 namespace graaf::algorithm {
@@ -13,11 +16,31 @@ namespace graaf::algorithm {
  * @tparam V The vertex type of the graph.
  * @tparam E The edge type of the graph.
  * @param graph The input graph.
+ * @param observer An algorithm_observer notified of every edge which is
+ * considered for the MST, in order of increasing weight.
  * @return A vector of edges forming the MST or minimum spanning forest.
  */
-template <typename V, typename E>
+template <typename V, typename E, typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 [[nodiscard]] std::vector<edge_id_t> kruskal_minimum_spanning_tree(
-    const graph<V, E, graph_type::UNDIRECTED>& graph);
+    const graph<V, E, graph_type::UNDIRECTED>& graph,
+    OBSERVER_T&& observer = OBSERVER_T{});
+
+/**
+ * Computes the minimum spanning tree (MST) or minimum spanning forest of a
+ * graph using Kruskal's algorithm with the given execution policy.
+ *
+ * With a parallel policy, the edges are sorted by weight in parallel on the
+ * default_executor; the union-find pass over the sorted edges is sequential.
+ * The total weight equals that of the sequential algorithm, but when several
+ * minimum spanning trees exist another one may be returned.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see kruskal_minimum_spanning_tree
+ */
+template <execution_policy POLICY_T, typename V, typename E>
+[[nodiscard]] std::vector<edge_id_t> kruskal_minimum_spanning_tree(
+    POLICY_T&& policy, const graph<V, E, graph_type::UNDIRECTED>& graph);
 
 }  // namespace graaf::algorithm
 
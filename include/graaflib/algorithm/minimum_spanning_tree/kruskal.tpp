@@ -1,10 +1,13 @@
 #pragma once
 
+#include <graaflib/executor.h>
 #include <graaflib/types.h>
 
 #include <algorithm>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace graaf::algorithm {
 
@@ -63,9 +66,12 @@ struct edge_to_process : public weighted_edge<T> {
 
 };  // namespace detail
 
-template <typename V, typename E>
+template <typename V, typename E, typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::vector<edge_id_t> kruskal_minimum_spanning_tree(
-    const graph<V, E, graph_type::UNDIRECTED>& graph) {
+    const graph<V, E, graph_type::UNDIRECTED>& graph, OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "kruskal_minimum_spanning_tree"};
+
   // unordered_map in case of deletion of vertices
   std::unordered_map<vertex_id_t, vertex_id_t> rank, parent;
   std::vector<detail::edge_to_process<E>> edges_to_process{};
@@ -82,10 +88,12 @@ std::vector<edge_id_t> kruskal_minimum_spanning_tree(
   std::sort(edges_to_process.begin(), edges_to_process.end(),
             [](detail::edge_to_process<E>& e1, detail::edge_to_process<E>& e2) {
               if (e1 != e2) return e1.get_weight() < e2.get_weight();
-              return e1.vertex_a < e2.vertex_a || e1.vertex_b < e2.vertex_b;
+              return std::tie(e1.vertex_a, e1.vertex_b) <
+                     std::tie(e2.vertex_a, e2.vertex_b);
             });
 
   for (const auto& edge : edges_to_process) {
+    observer.on_edge_relaxed(edge_id_t{edge.vertex_a, edge.vertex_b});
     if (detail::do_find_set(edge.vertex_a, parent) !=
         detail::do_find_set(edge.vertex_b, parent)) {
       mst_edges.push_back({edge.vertex_a, edge.vertex_b});
@@ -98,4 +106,89 @@ std::vector<edge_id_t> kruskal_minimum_spanning_tree(
   return mst_edges;
 }
 
+namespace detail {
+
+// Sorts the range by sorting chunks in parallel and merging pairs of sorted
+// runs in parallel rounds
+template <typename ELEMENT_T>
+void parallel_sort(std::vector<ELEMENT_T>& elements) {
+  auto& executor{default_executor()};
+  const auto size{elements.size()};
+  const auto chunk_count{std::max<std::size_t>(executor.concurrency(), 1)};
+  const auto run_size{std::max<std::size_t>((size + chunk_count - 1) /
+                                                chunk_count,
+                                            1)};
+  const auto run_begin{[&elements, size](std::size_t offset) {
+    return elements.begin() +
+           static_cast<std::ptrdiff_t>(std::min(offset, size));
+  }};
+
+  parallel_for(
+      executor, 0, chunk_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto chunk{begin}; chunk < end; ++chunk) {
+          std::sort(run_begin(chunk * run_size),
+                    run_begin((chunk + 1) * run_size));
+        }
+      },
+      {.grain_size = 1});
+
+  for (auto width{run_size}; width < size; width *= 2) {
+    const auto merge_count{(size + 2 * width - 1) / (2 * width)};
+    parallel_for(
+        executor, 0, merge_count,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto merge{begin}; merge < end; ++merge) {
+            const auto first{merge * 2 * width};
+            std::inplace_merge(run_begin(first), run_begin(first + width),
+                               run_begin(first + 2 * width));
+          }
+        },
+        {.grain_size = 1});
+  }
+}
+
+template <typename V, typename E>
+std::vector<edge_id_t> parallel_kruskal_minimum_spanning_tree(
+    const graph<V, E, graph_type::UNDIRECTED>& graph) {
+  using weight_t = decltype(get_weight(std::declval<E>()));
+
+  std::unordered_map<vertex_id_t, vertex_id_t> rank, parent;
+  std::vector<std::tuple<weight_t, vertex_id_t, vertex_id_t>>
+      edges_to_process{};
+  std::vector<edge_id_t> mst_edges{};
+
+  for (const auto& vertex : graph.get_vertices()) {
+    do_make_set(vertex.first, parent, rank);
+  }
+  edges_to_process.reserve(graph.edge_count());
+  for (const auto& [edge_id, edge] : graph.get_edges()) {
+    edges_to_process.emplace_back(get_weight(edge), edge_id.first,
+                                  edge_id.second);
+  }
+
+  parallel_sort(edges_to_process);
+
+  for (const auto& [weight, vertex_a, vertex_b] : edges_to_process) {
+    if (do_find_set(vertex_a, parent) != do_find_set(vertex_b, parent)) {
+      mst_edges.push_back({vertex_a, vertex_b});
+      do_merge_sets(vertex_a, vertex_b, parent, rank);
+    }
+    if (mst_edges.size() == graph.vertex_count() - 1) return mst_edges;
+  }
+  return mst_edges;
+}
+
+}  // namespace detail
+
+template <execution_policy POLICY_T, typename V, typename E>
+std::vector<edge_id_t> kruskal_minimum_spanning_tree(
+    POLICY_T&& /*policy*/, const graph<V, E, graph_type::UNDIRECTED>& graph) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_kruskal_minimum_spanning_tree(graph);
+  } else {
+    return kruskal_minimum_spanning_tree(graph);
+  }
+}
+
 };  // namespace graaf::algorithm
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 namespace graaf::algorithm {
@@ -15,13 +17,17 @@ namespace graaf::algorithm {
  * @tparam E The edge type of the graph.
  * @param graph The input graph. Should be undirected.
  * @param start_vertex The starting vertex for the MST construction.
+ * @param observer An algorithm_observer notified of the vertices added to the
+ * MST and of the candidate edges examined to select each MST edge.
  * @return An optional containing a vector of edges forming the MST if it
  * exists, or an empty optional if the MST doesn't exist (e.g., graph is not
  * connected).
  */
-template <typename V, typename E>
+template <typename V, typename E, typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 [[nodiscard]] std::optional<std::vector<edge_id_t> > prim_minimum_spanning_tree(
-    const graph<V, E, graph_type::UNDIRECTED>& graph, vertex_id_t start_vertex);
+    const graph<V, E, graph_type::UNDIRECTED>& graph, vertex_id_t start_vertex,
+    OBSERVER_T&& observer = OBSERVER_T{});
 
 }  // namespace graaf::algorithm
 
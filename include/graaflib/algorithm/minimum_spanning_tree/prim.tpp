@@ -29,15 +29,19 @@ template <class GRAPH_T>
 
 };  // namespace detail
 
-template <typename V, typename E>
+template <typename V, typename E, typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::optional<std::vector<edge_id_t>> prim_minimum_spanning_tree(
-    const graph<V, E, graph_type::UNDIRECTED>& graph,
-    vertex_id_t start_vertex) {
+    const graph<V, E, graph_type::UNDIRECTED>& graph, vertex_id_t start_vertex,
+    OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "prim_minimum_spanning_tree"};
+
   std::vector<edge_id_t> edges_in_mst{};
   edges_in_mst.reserve(
       graph.edge_count());  // Reserve the upper bound of edges in the mst
 
   std::unordered_set<vertex_id_t> fringe_vertices{start_vertex};
+  observer.on_vertex_settled(start_vertex);
 
   while (fringe_vertices.size() < graph.vertex_count()) {
     const auto candidates{detail::find_candidate_edges(graph, fringe_vertices)};
@@ -46,6 +50,9 @@ std::optional<std::vector<edge_id_t>> prim_minimum_spanning_tree(
       // The graph is not connected
       return std::nullopt;
     }
+    for (const auto& candidate : candidates) {
+      observer.on_edge_relaxed(candidate);
+    }
 
     const edge_id_t mst_edge{*std::ranges::min_element(
         candidates,
@@ -56,6 +63,7 @@ std::optional<std::vector<edge_id_t>> prim_minimum_spanning_tree(
 
     edges_in_mst.emplace_back(mst_edge);
     fringe_vertices.insert(mst_edge.second);
+    observer.on_vertex_settled(mst_edge.second);
   }
 
   return edges_in_mst;
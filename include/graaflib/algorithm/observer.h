@@ -0,0 +1,220 @@
+#pragma once
+
+#include <graaflib/types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief Counts the work performed by one or more algorithm invocations.
+ */
+struct algorithm_statistics {
+  // Vertices which were expanded, i.e. whose outgoing edges were examined
+  std::size_t vertices_settled{0};
+  // Edges which were examined, whether or not they improved a result
+  std::size_t edges_relaxed{0};
+  // Operations on the queue, heap or stack of pending vertices
+  std::size_t queue_pushes{0};
+  std::size_t queue_pops{0};
+  std::size_t peak_queue_size{0};
+};
+
+/**
+ * @brief An observer which algorithms notify of the work they perform.
+ *
+ * The shortest path, traversal, minimum spanning tree and strongly connected
+ * components algorithms accept an observer as their last argument. By default
+ * a no-op observer is used, whose calls are optimized away entirely.
+ *
+ * - on_begin and on_end are called when an algorithm starts and finishes,
+ *   with the name of the algorithm. Algorithms which call other algorithms
+ *   produce nested begin and end calls. on_end is also called when an
+ *   algorithm exits through an exception, hence it should not throw.
+ * - on_vertex_settled is called when a vertex is expanded.
+ * - on_edge_relaxed is called when an edge is examined.
+ * - on_queue_push and on_queue_pop are called with the size of the queue of
+ *   pending vertices after the push or pop.
+ */
+template <typename T>
+concept algorithm_observer =
+    requires(T& observer, std::string_view algorithm, vertex_id_t vertex_id,
+             const edge_id_t& edge_id, std::size_t queue_size) {
+      observer.on_begin(algorithm);
+      observer.on_end(algorithm);
+      observer.on_vertex_settled(vertex_id);
+      observer.on_edge_relaxed(edge_id);
+      observer.on_queue_push(queue_size);
+      observer.on_queue_pop(queue_size);
+    };
+
+/**
+ * @brief An algorithm_observer which can additionally stop the algorithms it
+ * is passed to.
+ *
+ * The shortest path and traversal algorithms poll stop_requested in their main
+ * loop, i.e. once per expanded vertex or per pass over a row or edge. When it
+ * returns true they stop and return their partial result. Hence
+ * stop_requested should be cheap and, once it returned true, keep doing so.
+ */
+template <typename T>
+concept stoppable_observer =
+    algorithm_observer<T> && requires(T& observer) {
+      { observer.stop_requested() } -> std::convertible_to<bool>;
+    };
+
+namespace detail {
+
+/**
+ * Whether the observer requests the algorithm to stop. Always false for
+ * observers which are not stoppable, such that the check compiles away.
+ */
+template <typename OBSERVER_T>
+[[nodiscard]] bool stop_requested(OBSERVER_T& observer) {
+  if constexpr (stoppable_observer<OBSERVER_T>) {
+    return static_cast<bool>(observer.stop_requested());
+  } else {
+    return false;
+  }
+}
+
+/**
+ * An observer which does nothing, the default of all algorithms.
+ */
+struct noop_observer {
+  void on_begin(std::string_view /*algorithm*/) const noexcept {}
+  void on_end(std::string_view /*algorithm*/) const noexcept {}
+  void on_vertex_settled(vertex_id_t /*vertex_id*/) const noexcept {}
+  void on_edge_relaxed(const edge_id_t& /*edge_id*/) const noexcept {}
+  void on_queue_push(std::size_t /*queue_size*/) const noexcept {}
+  void on_queue_pop(std::size_t /*queue_size*/) const noexcept {}
+};
+
+/**
+ * Notifies an observer of the begin and, on leaving the scope, the end of an
+ * algorithm.
+ */
+template <typename OBSERVER_T>
+class observer_scope {
+ public:
+  observer_scope(OBSERVER_T& observer, std::string_view algorithm)
+      : observer_{observer}, algorithm_{algorithm} {
+    observer_.on_begin(algorithm_);
+  }
+
+  ~observer_scope() { observer_.on_end(algorithm_); }
+
+  observer_scope(const observer_scope&) = delete;
+  observer_scope& operator=(const observer_scope&) = delete;
+
+ private:
+  OBSERVER_T& observer_;
+  std::string_view algorithm_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief An observer which accumulates the algorithm_statistics of all
+ * algorithms it is passed to.
+ */
+class statistics_observer {
+ public:
+  void on_begin(std::string_view /*algorithm*/) noexcept {}
+  void on_end(std::string_view /*algorithm*/) noexcept {}
+
+  void on_vertex_settled(vertex_id_t /*vertex_id*/) noexcept {
+    ++statistics_.vertices_settled;
+  }
+
+  void on_edge_relaxed(const edge_id_t& /*edge_id*/) noexcept {
+    ++statistics_.edges_relaxed;
+  }
+
+  void on_queue_push(std::size_t queue_size) noexcept {
+    ++statistics_.queue_pushes;
+    statistics_.peak_queue_size =
+        std::max(statistics_.peak_queue_size, queue_size);
+  }
+
+  void on_queue_pop(std::size_t /*queue_size*/) noexcept {
+    ++statistics_.queue_pops;
+  }
+
+  [[nodiscard]] const algorithm_statistics& statistics() const noexcept {
+    return statistics_;
+  }
+
+  void reset() noexcept { statistics_ = {}; }
+
+ private:
+  algorithm_statistics statistics_{};
+};
+
+/**
+ * @brief A finished algorithm invocation, as reported by a tracing_observer.
+ */
+struct trace_span {
+  std::string_view algorithm;
+  // Nesting depth, zero for the outermost algorithm
+  std::size_t depth;
+  std::chrono::steady_clock::time_point begin;
+  std::chrono::steady_clock::time_point end;
+  // The work performed between begin and end, including nested algorithms
+  algorithm_statistics statistics;
+};
+
+/**
+ * @brief An observer which reports a trace_span for every algorithm
+ * invocation, e.g. to attach them to a slow query log.
+ *
+ * @tparam SPAN_CALLBACK_T Callable accepting a const trace_span&, which is
+ * invoked when an algorithm finishes. Nested spans are reported before the
+ * span which contains them.
+ */
+template <typename SPAN_CALLBACK_T>
+  requires std::invocable<SPAN_CALLBACK_T&, const trace_span&>
+class tracing_observer {
+ public:
+  explicit tracing_observer(SPAN_CALLBACK_T span_callback)
+      : span_callback_{std::move(span_callback)} {}
+
+  void on_begin(std::string_view algorithm);
+  void on_end(std::string_view algorithm);
+
+  void on_vertex_settled(vertex_id_t /*vertex_id*/) noexcept {
+    ++statistics_.vertices_settled;
+  }
+
+  void on_edge_relaxed(const edge_id_t& /*edge_id*/) noexcept {
+    ++statistics_.edges_relaxed;
+  }
+
+  void on_queue_push(std::size_t queue_size) noexcept;
+
+  void on_queue_pop(std::size_t /*queue_size*/) noexcept {
+    ++statistics_.queue_pops;
+  }
+
+ private:
+  struct open_span {
+    std::string_view algorithm;
+    std::chrono::steady_clock::time_point begin;
+    algorithm_statistics statistics_at_begin;
+    std::size_t peak_queue_size;
+  };
+
+  SPAN_CALLBACK_T span_callback_;
+  algorithm_statistics statistics_{};
+  std::vector<open_span> open_spans_{};
+};
+
+}  // namespace graaf::algorithm
+
+#include "observer.tpp"
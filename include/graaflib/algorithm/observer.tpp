@@ -0,0 +1,53 @@
+#pragma once
+
+namespace graaf::algorithm {
+
+template <typename SPAN_CALLBACK_T>
+  requires std::invocable<SPAN_CALLBACK_T&, const trace_span&>
+void tracing_observer<SPAN_CALLBACK_T>::on_begin(std::string_view algorithm) {
+  open_spans_.push_back(
+      {algorithm, std::chrono::steady_clock::now(), statistics_, 0});
+}
+
+template <typename SPAN_CALLBACK_T>
+  requires std::invocable<SPAN_CALLBACK_T&, const trace_span&>
+void tracing_observer<SPAN_CALLBACK_T>::on_end(
+    std::string_view /*algorithm*/) {
+  if (open_spans_.empty()) {
+    return;
+  }
+
+  const auto span{open_spans_.back()};
+  open_spans_.pop_back();
+
+  const auto& before{span.statistics_at_begin};
+  const algorithm_statistics statistics{
+      .vertices_settled =
+          statistics_.vertices_settled - before.vertices_settled,
+      .edges_relaxed = statistics_.edges_relaxed - before.edges_relaxed,
+      .queue_pushes = statistics_.queue_pushes - before.queue_pushes,
+      .queue_pops = statistics_.queue_pops - before.queue_pops,
+      .peak_queue_size = span.peak_queue_size};
+
+  // The queues of nested algorithms are part of the enclosing algorithm
+  if (!open_spans_.empty()) {
+    open_spans_.back().peak_queue_size =
+        std::max(open_spans_.back().peak_queue_size, span.peak_queue_size);
+  }
+
+  span_callback_(trace_span{span.algorithm, open_spans_.size(), span.begin,
+                            std::chrono::steady_clock::now(), statistics});
+}
+
+template <typename SPAN_CALLBACK_T>
+  requires std::invocable<SPAN_CALLBACK_T&, const trace_span&>
+void tracing_observer<SPAN_CALLBACK_T>::on_queue_push(
+    std::size_t queue_size) noexcept {
+  ++statistics_.queue_pushes;
+  if (!open_spans_.empty()) {
+    open_spans_.back().peak_queue_size =
+        std::max(open_spans_.back().peak_queue_size, queue_size);
+  }
+}
+
+}  // namespace graaf::algorithm
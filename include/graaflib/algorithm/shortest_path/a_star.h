@@ -1,11 +1,13 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
 #include <graaflib/algorithm/shortest_path/common.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
 #include <concepts>
 #include <optional>
+#include <type_traits>
 
 namespace graaf::algorithm {
 
@@ -18,16 +20,21 @@ namespace graaf::algorithm {
  * @param target_vertex The target vertex to reach.
  * @param heuristic A heuristic function estimating the cost from a vertex to
  * the target.
+ * @param observer An algorithm_observer notified of the expanded vertices,
+ * examined edges and open set operations. If a stoppable_observer stops the
+ * search, no path is returned.
  * @return An optional containing the shortest path if found, or std::nullopt if
  * no path exists.
  */
 template <typename V, typename E, graph_type T, typename HEURISTIC_T,
-          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
-  requires std::is_invocable_r_v<WEIGHT_T, HEURISTIC_T&, vertex_id_t>
-std::optional<graph_path<WEIGHT_T>> a_star_search(const graph<V, E, T>& graph,
-                                                  vertex_id_t start_vertex,
-                                                  vertex_id_t target_vertex,
-                                                  const HEURISTIC_T& heuristic);
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>())),
+          typename OBSERVER_T = detail::noop_observer>
+  requires std::is_invocable_r_v<WEIGHT_T, HEURISTIC_T&, vertex_id_t> &&
+           algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+std::optional<graph_path<WEIGHT_T>> a_star_search(
+    const graph<V, E, T>& graph, vertex_id_t start_vertex,
+    vertex_id_t target_vertex, const HEURISTIC_T& heuristic,
+    OBSERVER_T&& observer = OBSERVER_T{});
 
 }  // namespace graaf::algorithm
 
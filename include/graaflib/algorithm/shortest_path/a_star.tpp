@@ -1,15 +1,21 @@
 #pragma once
 
+#include <fmt/core.h>
+
 #include <queue>
 
 namespace graaf::algorithm {
 
 template <typename V, typename E, graph_type T, typename HEURISTIC_T,
-          typename WEIGHT_T>
-  requires std::is_invocable_r_v<WEIGHT_T, HEURISTIC_T&, vertex_id_t>
+          typename WEIGHT_T, typename OBSERVER_T>
+  requires std::is_invocable_r_v<WEIGHT_T, HEURISTIC_T&, vertex_id_t> &&
+           algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::optional<graph_path<WEIGHT_T>> a_star_search(
     const graph<V, E, T>& graph, vertex_id_t start_vertex,
-    vertex_id_t target_vertex, const HEURISTIC_T& heuristic) {
+    vertex_id_t target_vertex, const HEURISTIC_T& heuristic,
+    OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "a_star_search"};
+
   // Define a priority queue for open set of vertices to explore.
   // This part is similar to dijkstra_shortest_path
   using weighted_path_item = detail::path_vertex<WEIGHT_T>;
@@ -42,19 +48,28 @@ std::optional<graph_path<WEIGHT_T>> a_star_search(
 
   // Initialize start vertex in open set queue
   open_set.push(vertex_info[start_vertex]);
+  observer.on_queue_push(open_set.size());
 
   while (!open_set.empty()) {
+    if (detail::stop_requested(observer)) {
+      return std::nullopt;
+    }
+
     // Get the vertex with the lowest f_score
     auto current{open_set.top()};
     open_set.pop();
+    observer.on_queue_pop(open_set.size());
 
     // Check if current vertex is the target
     if (current.id == target_vertex) {
       return reconstruct_path(start_vertex, target_vertex, vertex_info);
     }
 
+    observer.on_vertex_settled(current.id);
+
     // Iterate through neighboring vertices
     for (const auto& neighbor : graph.get_neighbors(current.id)) {
+      observer.on_edge_relaxed(edge_id_t{current.id, neighbor});
       WEIGHT_T edge_weight = get_weight(graph.get_edge(current.id, neighbor));
 
       // A* search does not work on negative edge weights.
@@ -87,6 +102,7 @@ std::optional<graph_path<WEIGHT_T>> a_star_search(
         };
 
         open_set.push(vertex_info[neighbor]);
+        observer.on_queue_push(open_set.size());
       }
     }
   }
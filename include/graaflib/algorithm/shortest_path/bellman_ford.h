@@ -1,9 +1,13 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
 #include <graaflib/algorithm/shortest_path/common.h>
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
+#include <type_traits>
+
 namespace graaf::algorithm {
 
 /**
@@ -16,6 +20,10 @@ namespace graaf::algorithm {
  * @tparam WEIGHT_T The type of weight associated with the edges.
  * @param graph The graph in which to find the shortest paths.
  * @param start_vertex The source vertex for the shortest paths.
+ * @param observer An algorithm_observer notified of every edge relaxation,
+ *        in each of the passes over the edges. If a stoppable_observer stops
+ *        the algorithm, the paths are upper bounds on the shortest paths and
+ *        negative cycles are not detected.
  * @return A map of target vertex IDs to shortest path structures. Each
  *         value contains a graph_path object representing the
  *         shortest path from the source vertex to the respective vertex.
@@ -23,9 +31,33 @@ namespace graaf::algorithm {
  *         absent from the map.
  */
 template <typename V, typename E, graph_type T,
-          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>())),
+          typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
 bellman_ford_shortest_paths(const graph<V, E, T>& graph,
+                            vertex_id_t start_vertex,
+                            OBSERVER_T&& observer = OBSERVER_T{});
+
+/**
+ * Find the shortest paths from a source vertex to all other vertices using
+ * the Bellman-Ford algorithm with the given execution policy.
+ *
+ * With a parallel policy, the edges of each pass are relaxed in parallel on
+ * the default_executor, grouped by their source vertex. The passes stop early
+ * once a pass improves no distance. As in the sequential algorithm, the edges
+ * of an undirected graph are only relaxed in the direction in which they are
+ * stored. The distances and the negative cycle detection are those of the
+ * sequential algorithm, but when several shortest paths exist another one may
+ * be returned.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see bellman_ford_shortest_paths
+ */
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+bellman_ford_shortest_paths(POLICY_T&& policy, const graph<V, E, T>& graph,
                             vertex_id_t start_vertex);
 
 }  // namespace graaf::algorithm
@@ -1,11 +1,99 @@
 #pragma once
 
+#include <graaflib/algorithm/dense_graph.h>
+#include <graaflib/executor.h>
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <vector>
+
 namespace graaf::algorithm {
 
+namespace detail {
+
 template <typename V, typename E, graph_type T, typename WEIGHT_T>
 std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+parallel_bellman_ford_shortest_paths(const graph<V, E, T>& graph,
+                                     vertex_id_t start_vertex) {
+  // Like the sequential algorithm, relax the edges only in the direction in
+  // which they are stored, also for undirected graphs
+  const auto dense_graph{make_dense_graph(graph, dense_adjacency::STORED)};
+  const auto vertex_count{dense_graph.vertex_count()};
+  const auto start{dense_graph.index(start_vertex)};
+  constexpr auto infinity{std::numeric_limits<WEIGHT_T>::max()};
+
+  std::vector<WEIGHT_T> distances(vertex_count, infinity);
+  std::vector<std::size_t> predecessors(vertex_count, vertex_count);
+  std::vector<std::mutex> vertex_mutexes(vertex_count);
+  distances[start] = 0;
+  predecessors[start] = start;
+
+  // Relaxes all edges once, returns whether any distance improved
+  const auto relax_all_edges{[&]() {
+    std::atomic<bool> improved{false};
+    parallel_for(
+        default_executor(), 0, vertex_count,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto source{begin}; source < end; ++source) {
+            WEIGHT_T source_distance{};
+            {
+              const std::lock_guard lock{vertex_mutexes[source]};
+              source_distance = distances[source];
+            }
+            if (source_distance == infinity) {
+              continue;
+            }
+
+            const auto neighbors{dense_graph.neighbors(source)};
+            const auto edges{dense_graph.edges(source)};
+            for (std::size_t index{0}; index < neighbors.size(); ++index) {
+              const auto target{neighbors[index]};
+              const WEIGHT_T distance{source_distance +
+                                      get_weight(*edges[index])};
+              const std::lock_guard lock{vertex_mutexes[target]};
+              if (distance < distances[target]) {
+                distances[target] = distance;
+                predecessors[target] = source;
+                improved.store(true, std::memory_order_relaxed);
+              }
+            }
+          }
+        },
+        {.grain_size = 64});
+    return improved.load();
+  }};
+
+  bool converged{false};
+  for (std::size_t pass{1}; pass < vertex_count && !converged; ++pass) {
+    converged = !relax_all_edges();
+  }
+  // A pass which improves no distance proves the absence of negative cycles
+  if (!converged && relax_all_edges()) {
+    throw std::invalid_argument{"Negative cycle detected in the graph."};
+  }
+
+  auto shortest_paths{
+      paths_from_predecessors(dense_graph, start, predecessors, distances)};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    if (predecessors[vertex] == vertex_count) {
+      shortest_paths[dense_graph.vertex_id(vertex)] = {
+          {dense_graph.vertex_id(vertex)}, infinity};
+    }
+  }
+  return shortest_paths;
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T,
+          typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
 bellman_ford_shortest_paths(const graph<V, E, T>& graph,
-                            vertex_id_t start_vertex) {
+                            vertex_id_t start_vertex, OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "bellman_ford_shortest_paths"};
+
   std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> shortest_paths;
 
   const auto found_shorter_path{
@@ -31,8 +119,14 @@ bellman_ford_shortest_paths(const graph<V, E, T>& graph,
   // Relax edges for |V| - 1 iterations
   for (std::size_t i = 1; i < graph.vertex_count(); ++i) {
     for (const auto& [edge_id, edge] : graph.get_edges()) {
+      if (detail::stop_requested(observer)) {
+        // Skip the negative cycle detection, it requires all passes
+        return shortest_paths;
+      }
+
       const auto [u, v]{edge_id};
       WEIGHT_T weight = get_weight(edge);
+      observer.on_edge_relaxed(edge_id);
 
       if (found_shorter_path(edge_id, edge)) {
         // Update the shortest path to vertex v
@@ -55,4 +149,18 @@ bellman_ford_shortest_paths(const graph<V, E, T>& graph,
   return shortest_paths;
 }
 
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename WEIGHT_T>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+bellman_ford_shortest_paths(POLICY_T&& /*policy*/,
+                            const graph<V, E, T>& graph,
+                            vertex_id_t start_vertex) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_bellman_ford_shortest_paths<V, E, T, WEIGHT_T>(
+        graph, start_vertex);
+  } else {
+    return bellman_ford_shortest_paths(graph, start_vertex);
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -4,10 +4,14 @@
 
 namespace graaf::algorithm {
 
-template <typename V, typename E, graph_type T, typename WEIGHT_T>
+template <typename V, typename E, graph_type T, typename WEIGHT_T,
+          typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::optional<graph_path<WEIGHT_T>> bfs_shortest_path(
     const graph<V, E, T>& graph, vertex_id_t start_vertex,
-    vertex_id_t end_vertex) {
+    vertex_id_t end_vertex, OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "bfs_shortest_path"};
+
   std::unordered_map<vertex_id_t, detail::path_vertex<WEIGHT_T>> vertex_info{
       {start_vertex, {start_vertex, 0, start_vertex}}};
 
@@ -27,7 +31,7 @@ std::optional<graph_path<WEIGHT_T>> bfs_shortest_path(
       }};
 
   breadth_first_traverse(graph, start_vertex, callback,
-                         search_termination_strategy);
+                         search_termination_strategy, observer);
 
   return reconstruct_path(start_vertex, end_vertex, vertex_info);
 }
@@ -1,8 +1,11 @@
 #pragma once
+#include <graaflib/algorithm/dense_graph.h>
 #include <graaflib/types.h>
 
 #include <list>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace graaf::algorithm {
 
@@ -28,6 +31,17 @@ std::optional<graph_path<WEIGHT_T>> reconstruct_path(
     vertex_id_t start_vertex, vertex_id_t end_vertex,
     std::unordered_map<vertex_id_t, path_vertex<WEIGHT_T>>& vertex_info);
 
+/**
+ * Builds the paths of all reached vertices from their predecessors, where the
+ * predecessor of an unreached vertex is the vertex count.
+ */
+template <typename EDGE_T, typename WEIGHT_T>
+[[nodiscard]] std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+paths_from_predecessors(const dense_graph<EDGE_T>& dense_graph,
+                        std::size_t source,
+                        const std::vector<std::size_t>& predecessors,
+                        const std::vector<WEIGHT_T>& distances);
+
 }  // namespace detail
 
 template <typename WEIGHT_T>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <graaflib/executor.h>
+
 namespace graaf::algorithm {
 
 namespace detail {
@@ -25,6 +27,42 @@ std::optional<graph_path<WEIGHT_T>> reconstruct_path(
   return path;
 }
 
+template <typename EDGE_T, typename WEIGHT_T>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+paths_from_predecessors(const dense_graph<EDGE_T>& dense_graph,
+                        std::size_t source,
+                        const std::vector<std::size_t>& predecessors,
+                        const std::vector<WEIGHT_T>& distances) {
+  const auto vertex_count{dense_graph.vertex_count()};
+  std::vector<std::optional<graph_path<WEIGHT_T>>> paths(vertex_count);
+
+  parallel_for(default_executor(), 0, vertex_count,
+               [&](std::size_t begin, std::size_t end) {
+                 for (auto vertex{begin}; vertex < end; ++vertex) {
+                   if (predecessors[vertex] == vertex_count) {
+                     continue;
+                   }
+                   graph_path<WEIGHT_T> path{{}, distances[vertex]};
+                   auto current{vertex};
+                   while (current != source) {
+                     path.vertices.push_front(dense_graph.vertex_id(current));
+                     current = predecessors[current];
+                   }
+                   path.vertices.push_front(dense_graph.vertex_id(source));
+                   paths[vertex] = std::move(path);
+                 }
+               });
+
+  std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> shortest_paths{};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    if (paths[vertex]) {
+      shortest_paths.emplace(dense_graph.vertex_id(vertex),
+                             std::move(*paths[vertex]));
+    }
+  }
+  return shortest_paths;
+}
+
 }  // namespace detail
 
 }  // namespace graaf::algorithm
\ No newline at end of file
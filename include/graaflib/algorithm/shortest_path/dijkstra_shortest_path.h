@@ -1,10 +1,12 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
 #include <graaflib/algorithm/shortest_path/common.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
 #include <optional>
+#include <type_traits>
 
 namespace graaf::algorithm {
 
@@ -17,13 +19,18 @@ namespace graaf::algorithm {
  * @param graph The graph to extract shortest path from.
  * @param start_vertex Vertex id where the shortest path should start.
  * @param end_vertex Vertex id where the shortest path should end.
+ * @param observer An algorithm_observer notified of the settled vertices,
+ * relaxed edges and priority queue operations. If a stoppable_observer stops
+ * the search, no path is returned.
  * @return An optional with the shortest path (list of vertices) if found.
  */
 template <typename V, typename E, graph_type T,
-          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>())),
+          typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::optional<graph_path<WEIGHT_T>> dijkstra_shortest_path(
     const graph<V, E, T>& graph, vertex_id_t start_vertex,
-    vertex_id_t end_vertex);
+    vertex_id_t end_vertex, OBSERVER_T&& observer = OBSERVER_T{});
 
 }  // namespace graaf::algorithm
 
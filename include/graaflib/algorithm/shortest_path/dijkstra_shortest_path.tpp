@@ -5,10 +5,14 @@
 
 namespace graaf::algorithm {
 
-template <typename V, typename E, graph_type T, typename WEIGHT_T>
+template <typename V, typename E, graph_type T, typename WEIGHT_T,
+          typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::optional<graph_path<WEIGHT_T>> dijkstra_shortest_path(
     const graph<V, E, T>& graph, vertex_id_t start_vertex,
-    vertex_id_t end_vertex) {
+    vertex_id_t end_vertex, OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "dijkstra_shortest_path"};
+
   using weighted_path_item = detail::path_vertex<WEIGHT_T>;
   using dijkstra_queue_t =
       std::priority_queue<weighted_path_item, std::vector<weighted_path_item>,
@@ -18,16 +22,25 @@ std::optional<graph_path<WEIGHT_T>> dijkstra_shortest_path(
 
   vertex_info[start_vertex] = {start_vertex, 0, start_vertex};
   to_explore.push(vertex_info[start_vertex]);
+  observer.on_queue_push(to_explore.size());
 
   while (!to_explore.empty()) {
+    if (detail::stop_requested(observer)) {
+      // The target was not settled, any path to it may not be the shortest
+      return std::nullopt;
+    }
+
     auto current{to_explore.top()};
     to_explore.pop();
+    observer.on_queue_pop(to_explore.size());
 
     if (current.id == end_vertex) {
       break;
     }
+    observer.on_vertex_settled(current.id);
 
     for (const auto& neighbor : graph.get_neighbors(current.id)) {
+      observer.on_edge_relaxed(edge_id_t{current.id, neighbor});
       WEIGHT_T edge_weight = get_weight(graph.get_edge(current.id, neighbor));
 
       if (edge_weight < 0) {
@@ -44,6 +57,7 @@ std::optional<graph_path<WEIGHT_T>> dijkstra_shortest_path(
           distance < vertex_info[neighbor].dist_from_start) {
         vertex_info[neighbor] = {neighbor, distance, current.id};
         to_explore.push(vertex_info[neighbor]);
+        observer.on_queue_push(to_explore.size());
       }
     }
   }
@@ -1,11 +1,37 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
 #include <graaflib/algorithm/shortest_path/common.h>
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
 namespace graaf::algorithm {
 
+/**
+ * @brief Conditions under which dijkstra_shortest_paths stops before it has
+ * settled every reachable vertex. The search stops as soon as any of the
+ * given conditions holds.
+ */
+template <typename WEIGHT_T>
+struct dijkstra_options {
+  // Stop once all of these vertices are settled, or once all vertices which
+  // are reachable are. Ignored if empty.
+  std::vector<vertex_id_t> targets{};
+
+  // Vertices further than this from the source are not settled, e.g. for
+  // isochrones
+  std::optional<WEIGHT_T> max_distance{};
+
+  // Stop after this many vertices, including the source, are settled
+  std::optional<std::size_t> max_settled{};
+};
+
 /**
  * Find the shortest paths from a source vertex to all other vertices in the
  * graph using Dijkstra's algorithm.
@@ -16,6 +42,10 @@ namespace graaf::algorithm {
  * @tparam WEIGHT_T The type of edge weights.
  * @param graph The graph we want to search.
  * @param source_vertex The source vertex from which to compute shortest paths.
+ * @param observer An algorithm_observer notified of the settled vertices,
+ * relaxed edges and priority queue operations. If a stoppable_observer stops
+ * the search, the paths found so far are returned, which are the shortest
+ * paths for the settled vertices and upper bounds for the other vertices.
  * @return A map containing the shortest paths from the source vertex to all
  * other vertices. The map keys are target vertex IDs, and the values are
  * instances of graph_path, representing the shortest distance and the path
@@ -23,9 +53,58 @@ namespace graaf::algorithm {
  * reachable from the source, its entry will be absent from the map.
  */
 template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>())),
+          typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+[[nodiscard]] std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+dijkstra_shortest_paths(const graph<V, E, T>& graph, vertex_id_t source_vertex,
+                        OBSERVER_T&& observer = OBSERVER_T{});
+
+/**
+ * Find the shortest paths from a source vertex to the vertices closest to it,
+ * stopping early as given by the options.
+ *
+ * Unlike the overload without options, only settled vertices are returned, so
+ * the result is a partial shortest path tree in which every path is a
+ * shortest path. This holds as well when a stoppable_observer stops the
+ * search.
+ *
+ * @param graph The graph we want to search.
+ * @param source_vertex The source vertex from which to compute shortest paths.
+ * @param options The targets, distance bound and settled vertex bound.
+ * @param observer An algorithm_observer, as for the overload without options.
+ * @return A map from the ID of every settled vertex to its shortest path.
+ * @throws invalid_argument - If a negative edge weight is encountered.
+ */
+template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>())),
+          typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+[[nodiscard]] std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+dijkstra_shortest_paths(
+    const graph<V, E, T>& graph, vertex_id_t source_vertex,
+    const std::type_identity_t<dijkstra_options<WEIGHT_T>>& options,
+    OBSERVER_T&& observer = OBSERVER_T{});
+
+/**
+ * Find the shortest paths from a source vertex to all other vertices in the
+ * graph with the given execution policy.
+ *
+ * With a parallel policy, a delta-stepping variant of Dijkstra's algorithm
+ * runs on the default_executor: vertices whose tentative distance lies within
+ * one bucket width of the smallest tentative distance are expanded in
+ * parallel, and the bucket width is the mean edge weight. The shortest
+ * distances equal those of the sequential algorithm, but when several
+ * shortest paths exist another one may be returned.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see dijkstra_shortest_paths
+ */
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
           typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
 [[nodiscard]] std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
-dijkstra_shortest_paths(const graph<V, E, T>& graph, vertex_id_t source_vertex);
+dijkstra_shortest_paths(POLICY_T&& policy, const graph<V, E, T>& graph,
+                        vertex_id_t source_vertex);
 
 }  // namespace graaf::algorithm
 
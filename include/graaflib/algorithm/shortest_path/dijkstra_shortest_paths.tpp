@@ -1,59 +1,313 @@
 #pragma once
 
+#include <graaflib/algorithm/dense_graph.h>
+#include <graaflib/algorithm/shortest_path/monotone_queue.h>
+#include <graaflib/executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <sstream>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 namespace graaf::algorithm {
 
+namespace detail {
+
 template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+parallel_dijkstra_shortest_paths(const graph<V, E, T>& graph,
+                                 vertex_id_t source_vertex) {
+  const auto dense_graph{make_dense_graph(graph)};
+  if (!dense_graph.contains(source_vertex)) {
+    return {{source_vertex, {{source_vertex}, 0}}};
+  }
+
+  const auto vertex_count{dense_graph.vertex_count()};
+  const auto source{dense_graph.index(source_vertex)};
+
+  // The bucket width trades the number of rounds, each a synchronization of
+  // all threads, against vertices which are expanded more than once
+  double weight_sum{0};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    for (const auto* edge : dense_graph.edges(vertex)) {
+      weight_sum += std::max(0.0, static_cast<double>(get_weight(*edge)));
+    }
+  }
+  auto bucket_width{static_cast<WEIGHT_T>(
+      dense_graph.edge_count() == 0 ? 0
+                                    : weight_sum / dense_graph.edge_count())};
+  if constexpr (std::is_integral_v<WEIGHT_T>) {
+    bucket_width = std::max<WEIGHT_T>(bucket_width, 1);
+  }
+
+  std::vector<WEIGHT_T> distances(vertex_count,
+                                  std::numeric_limits<WEIGHT_T>::max());
+  std::vector<std::size_t> predecessors(vertex_count, vertex_count);
+  std::vector<std::mutex> vertex_mutexes(vertex_count);
+  // The last round in which a vertex was added to the active vertices
+  std::vector<std::atomic<std::size_t>> activation_rounds(vertex_count);
+
+  distances[source] = 0;
+  predecessors[source] = source;
+
+  std::vector<std::size_t> active{source};
+  std::mutex next_active_mutex{};
+  for (std::size_t round{1}; !active.empty(); ++round) {
+    // Between rounds no thread writes the distances
+    auto min_distance{std::numeric_limits<WEIGHT_T>::max()};
+    for (const auto vertex : active) {
+      min_distance = std::min(min_distance, distances[vertex]);
+    }
+    const auto bucket_end{min_distance + bucket_width};
+
+    std::vector<std::size_t> bucket{};
+    std::vector<std::size_t> next_active{};
+    for (const auto vertex : active) {
+      if (distances[vertex] <= bucket_end) {
+        bucket.push_back(vertex);
+      } else {
+        next_active.push_back(vertex);
+        activation_rounds[vertex].store(round, std::memory_order_relaxed);
+      }
+    }
+
+    const auto relax{[&](std::size_t begin, std::size_t end) {
+      std::vector<std::size_t> improved{};
+      for (auto position{begin}; position < end; ++position) {
+        const auto current{bucket[position]};
+        WEIGHT_T current_distance{};
+        {
+          const std::lock_guard lock{vertex_mutexes[current]};
+          current_distance = distances[current];
+        }
+
+        const auto neighbors{dense_graph.neighbors(current)};
+        const auto edges{dense_graph.edges(current)};
+        for (std::size_t index{0}; index < neighbors.size(); ++index) {
+          const auto neighbor{neighbors[index]};
+          const WEIGHT_T edge_weight{get_weight(*edges[index])};
+
+          if (edge_weight < 0) {
+            std::ostringstream error_msg;
+            error_msg << "Negative edge weight [" << edge_weight
+                      << "] between vertices ["
+                      << dense_graph.vertex_id(current) << "] -> ["
+                      << dense_graph.vertex_id(neighbor) << "].";
+            throw std::invalid_argument{error_msg.str()};
+          }
+
+          const WEIGHT_T distance{current_distance + edge_weight};
+          {
+            const std::lock_guard lock{vertex_mutexes[neighbor]};
+            if (distance >= distances[neighbor]) {
+              continue;
+            }
+            distances[neighbor] = distance;
+            predecessors[neighbor] = current;
+          }
+
+          if (activation_rounds[neighbor].exchange(
+                  round, std::memory_order_relaxed) != round) {
+            improved.push_back(neighbor);
+          }
+        }
+      }
+
+      const std::lock_guard lock{next_active_mutex};
+      next_active.insert(next_active.end(), improved.begin(), improved.end());
+    }};
+
+    parallel_for(default_executor(), 0, bucket.size(), relax,
+                 {.grain_size = 32});
+    active = std::move(next_active);
+  }
+
+  return paths_from_predecessors(dense_graph, source, predecessors, distances);
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T,
+          typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 [[nodiscard]] std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
-dijkstra_shortest_paths(const graph<V, E, T>& graph,
-                        vertex_id_t source_vertex) {
-  std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> shortest_paths;
+dijkstra_shortest_paths(const graph<V, E, T>& graph, vertex_id_t source_vertex,
+                        OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "dijkstra_shortest_paths"};
 
   using weighted_path_item = detail::path_vertex<WEIGHT_T>;
-  using dijkstra_queue_t =
-      std::priority_queue<weighted_path_item, std::vector<weighted_path_item>,
-                          std::greater<>>;
-  dijkstra_queue_t to_explore{};
-
-  shortest_paths[source_vertex].total_weight = 0;
-  shortest_paths[source_vertex].vertices.push_back(source_vertex);
-  to_explore.push(weighted_path_item{source_vertex, 0});
-
-  while (!to_explore.empty()) {
-    auto current{to_explore.top()};
-    to_explore.pop();
-
-    if (shortest_paths.contains(current.id) &&
-        current.dist_from_start > shortest_paths[current.id].total_weight) {
-      continue;
+
+  const auto search{[&](auto& to_explore) {
+    std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> shortest_paths;
+
+    shortest_paths[source_vertex].total_weight = 0;
+    shortest_paths[source_vertex].vertices.push_back(source_vertex);
+    to_explore.push(weighted_path_item{source_vertex, 0, source_vertex});
+    observer.on_queue_push(to_explore.size());
+
+    while (!to_explore.empty()) {
+      if (detail::stop_requested(observer)) {
+        break;
+      }
+
+      auto current{to_explore.top()};
+      to_explore.pop();
+      observer.on_queue_pop(to_explore.size());
+
+      if (shortest_paths.contains(current.id) &&
+          current.dist_from_start > shortest_paths[current.id].total_weight) {
+        continue;
+      }
+      observer.on_vertex_settled(current.id);
+
+      for (const auto neighbor : graph.get_neighbors(current.id)) {
+        observer.on_edge_relaxed(edge_id_t{current.id, neighbor});
+        WEIGHT_T edge_weight =
+            get_weight(graph.get_edge(current.id, neighbor));
+
+        if (edge_weight < 0) {
+          std::ostringstream error_msg;
+          error_msg << "Negative edge weight [" << edge_weight
+                    << "] between vertices [" << current.id << "] -> ["
+                    << neighbor << "].";
+          throw std::invalid_argument{error_msg.str()};
+        }
+
+        WEIGHT_T distance = current.dist_from_start + edge_weight;
+
+        if (!shortest_paths.contains(neighbor) ||
+            distance < shortest_paths[neighbor].total_weight) {
+          shortest_paths[neighbor].total_weight = distance;
+          shortest_paths[neighbor].vertices =
+              shortest_paths[current.id].vertices;
+          shortest_paths[neighbor].vertices.push_back(neighbor);
+          to_explore.push(weighted_path_item{neighbor, distance, current.id});
+          observer.on_queue_push(to_explore.size());
+        }
+      }
+    }
+
+    return shortest_paths;
+  }};
+  return detail::with_dijkstra_queue<WEIGHT_T>(graph, true, search);
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T,
+          typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> dijkstra_shortest_paths(
+    const graph<V, E, T>& graph, vertex_id_t source_vertex,
+    const std::type_identity_t<dijkstra_options<WEIGHT_T>>& options,
+    OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "dijkstra_shortest_paths"};
+
+  using weighted_path_item = detail::path_vertex<WEIGHT_T>;
+
+  // Paths are only built for the settled vertices once the search is done,
+  // rather than copied along every relaxed edge
+  std::unordered_map<vertex_id_t, weighted_path_item> vertex_info{};
+  std::vector<vertex_id_t> settled{};
+
+  std::unordered_set<vertex_id_t> unsettled_targets(options.targets.begin(),
+                                                    options.targets.end());
+  const bool has_targets{!unsettled_targets.empty()};
+  const auto within_bound{[&options](WEIGHT_T distance) {
+    return !options.max_distance || distance <= *options.max_distance;
+  }};
+
+  // Without knowing how much of the graph is settled, scanning all weights to
+  // choose the queue could cost more than the search
+  const auto search{[&](auto& to_explore) {
+    if (within_bound(0)) {
+      vertex_info[source_vertex] = {source_vertex, 0, source_vertex};
+      to_explore.push(vertex_info[source_vertex]);
+      observer.on_queue_push(to_explore.size());
     }
 
-    for (const auto neighbor : graph.get_neighbors(current.id)) {
-      WEIGHT_T edge_weight = get_weight(graph.get_edge(current.id, neighbor));
+    while (!to_explore.empty()) {
+      if (detail::stop_requested(observer) ||
+          (options.max_settled && settled.size() >= *options.max_settled)) {
+        break;
+      }
+
+      const auto current{to_explore.top()};
+      to_explore.pop();
+      observer.on_queue_pop(to_explore.size());
+
+      if (current.dist_from_start > vertex_info[current.id].dist_from_start) {
+        continue;
+      }
+      observer.on_vertex_settled(current.id);
+      settled.push_back(current.id);
 
-      if (edge_weight < 0) {
-        std::ostringstream error_msg;
-        error_msg << "Negative edge weight [" << edge_weight
-                  << "] between vertices [" << current.id << "] -> ["
-                  << neighbor << "].";
-        throw std::invalid_argument{error_msg.str()};
+      if (has_targets && unsettled_targets.erase(current.id) > 0 &&
+          unsettled_targets.empty()) {
+        break;
       }
 
-      WEIGHT_T distance = current.dist_from_start + edge_weight;
+      for (const auto neighbor : graph.get_neighbors(current.id)) {
+        observer.on_edge_relaxed(edge_id_t{current.id, neighbor});
+        WEIGHT_T edge_weight = get_weight(graph.get_edge(current.id, neighbor));
+
+        if constexpr (std::is_signed_v<WEIGHT_T>) {
+          if (edge_weight < 0) {
+            std::ostringstream error_msg;
+            error_msg << "Negative edge weight [" << edge_weight
+                      << "] between vertices [" << current.id << "] -> ["
+                      << neighbor << "].";
+            throw std::invalid_argument{error_msg.str()};
+          }
+        }
 
-      if (!shortest_paths.contains(neighbor) ||
-          distance < shortest_paths[neighbor].total_weight) {
-        shortest_paths[neighbor].total_weight = distance;
-        shortest_paths[neighbor].vertices = shortest_paths[current.id].vertices;
-        shortest_paths[neighbor].vertices.push_back(neighbor);
-        to_explore.push(weighted_path_item{neighbor, distance});
+        WEIGHT_T distance = current.dist_from_start + edge_weight;
+        if (!within_bound(distance)) {
+          continue;
+        }
+
+        const auto info{vertex_info.find(neighbor)};
+        if (info == vertex_info.end() ||
+            distance < info->second.dist_from_start) {
+          vertex_info[neighbor] = {neighbor, distance, current.id};
+          to_explore.push(vertex_info[neighbor]);
+          observer.on_queue_push(to_explore.size());
+        }
       }
     }
-  }
+  }};
+  detail::with_dijkstra_queue<WEIGHT_T>(graph, false, search);
 
+  std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> shortest_paths{};
+  shortest_paths.reserve(settled.size());
+  for (const auto vertex_id : settled) {
+    auto& path{shortest_paths[vertex_id]};
+    path.total_weight = vertex_info[vertex_id].dist_from_start;
+    // The predecessors of a settled vertex are settled before it
+    for (auto current{vertex_id}; current != source_vertex;
+         current = vertex_info[current].prev_id) {
+      path.vertices.push_front(current);
+    }
+    path.vertices.push_front(source_vertex);
+  }
   return shortest_paths;
 }
 
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename WEIGHT_T>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> dijkstra_shortest_paths(
+    POLICY_T&& /*policy*/, const graph<V, E, T>& graph,
+    vertex_id_t source_vertex) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_dijkstra_shortest_paths<V, E, T, WEIGHT_T>(
+        graph, source_vertex);
+  } else {
+    return dijkstra_shortest_paths(graph, source_vertex);
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <graaflib/executor.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief The shortest distances between every source and every target vertex.
+ */
+template <typename WEIGHT_T>
+struct distance_table {
+  // The distance of a target which is not reachable from a source
+  static constexpr WEIGHT_T unreachable{std::numeric_limits<WEIGHT_T>::max()};
+
+  std::vector<vertex_id_t> sources{};
+  std::vector<vertex_id_t> targets{};
+
+  // Row-major, the distance from sources[i] to targets[j] is at index
+  // i * targets.size() + j
+  std::vector<WEIGHT_T> distances{};
+
+  [[nodiscard]] WEIGHT_T at(std::size_t source_index,
+                            std::size_t target_index) const {
+    return distances[source_index * targets.size() + target_index];
+  }
+};
+
+/**
+ * @brief Options of the one-to-many and many-to-many distance queries.
+ */
+struct distance_table_options {
+  // Executor to run the searches on, if null the default_executor is used
+  graaf::executor* executor{nullptr};
+};
+
+/**
+ * @brief Computes the shortest distances from one source vertex to a set of
+ * target vertices with a single run of Dijkstra's algorithm, which stops as
+ * soon as all targets are settled.
+ *
+ * @param graph The graph, edge weights must be non-negative.
+ * @param source The source vertex.
+ * @param targets The target vertices, which may contain duplicates.
+ * @return The distance to each target in the order of the targets,
+ * distance_table<WEIGHT_T>::unreachable for targets which are not reachable.
+ * @throws invalid_argument - If a vertex does not exist, or a negative edge
+ * weight is encountered.
+ */
+template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+[[nodiscard]] std::vector<WEIGHT_T> one_to_many_distances(
+    const graph<V, E, T>& graph, vertex_id_t source,
+    const std::vector<vertex_id_t>& targets);
+
+/**
+ * @brief Computes the table of shortest distances between every source and
+ * every target vertex.
+ *
+ * A single search from each source settles the distances to all targets at
+ * once, and stops once all of them are settled. When there are fewer targets
+ * than sources, the searches instead run backwards from the targets along
+ * the reversed edges. The searches run in parallel on the executor of the
+ * options, and share a compact copy of the graph which is made once.
+ *
+ * @param graph The graph, edge weights must be non-negative.
+ * @param sources The source vertices, the rows of the table.
+ * @param targets The target vertices, the columns of the table.
+ * @param options The executor to run on.
+ * @return The table of distances, where unreachable pairs have the distance
+ * distance_table<WEIGHT_T>::unreachable.
+ * @throws invalid_argument - If a vertex does not exist, or a negative edge
+ * weight is encountered.
+ */
+template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+[[nodiscard]] distance_table<WEIGHT_T> many_to_many_distances(
+    const graph<V, E, T>& graph, const std::vector<vertex_id_t>& sources,
+    const std::vector<vertex_id_t>& targets,
+    const distance_table_options& options = {});
+
+}  // namespace graaf::algorithm
+
+#include "distance_table.tpp"
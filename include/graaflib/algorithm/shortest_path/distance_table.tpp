@@ -0,0 +1,227 @@
+#pragma once
+
+#include <graaflib/algorithm/dense_graph.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graaf::algorithm {
+
+namespace detail {
+
+/**
+ * Dijkstra's algorithm on a dense_graph which stops as soon as a given set of
+ * goal vertices is settled. The per-vertex buffers are kept between searches
+ * and only the entries a search touched are reset afterwards, such that a
+ * search which stops early does not pay for the size of the graph.
+ */
+template <typename WEIGHT_T>
+class goal_directed_search {
+ public:
+  explicit goal_directed_search(std::size_t vertex_count)
+      : distances_(vertex_count, distance_table<WEIGHT_T>::unreachable),
+        is_goal_(vertex_count, false) {}
+
+  /**
+   * @param graph The graph to search.
+   * @param root The index of the vertex to start from.
+   * @param goals The indices of the goal vertices.
+   * @param reversed Whether the adjacency of the graph is the incoming one,
+   * which only changes the direction in which edges are reported.
+   * @param goal_distances Receives the distance to each goal.
+   */
+  template <typename E>
+  void run(const dense_graph<E>& graph, std::size_t root,
+           const std::vector<std::size_t>& goals, bool reversed,
+           std::vector<WEIGHT_T>& goal_distances) {
+    std::size_t remaining_goals{0};
+    for (const auto goal : goals) {
+      if (!is_goal_[goal]) {
+        is_goal_[goal] = true;
+        ++remaining_goals;
+      }
+    }
+
+    using queue_item = std::pair<WEIGHT_T, std::size_t>;
+    std::priority_queue<queue_item, std::vector<queue_item>, std::greater<>>
+        to_explore{};
+    distances_[root] = 0;
+    touched_.push_back(root);
+    to_explore.emplace(0, root);
+
+    while (remaining_goals > 0 && !to_explore.empty()) {
+      const auto [distance, current]{to_explore.top()};
+      to_explore.pop();
+      if (distance > distances_[current]) {
+        // A shorter distance was found after this entry was pushed
+        continue;
+      }
+
+      if (is_goal_[current]) {
+        is_goal_[current] = false;
+        if (--remaining_goals == 0) {
+          break;
+        }
+      }
+
+      const auto neighbors{graph.neighbors(current)};
+      const auto edges{graph.edges(current)};
+      for (std::size_t position{0}; position < neighbors.size(); ++position) {
+        const auto neighbor{neighbors[position]};
+        const WEIGHT_T edge_weight = get_weight(*edges[position]);
+        if (edge_weight < 0) {
+          throw_negative_weight(graph, current, neighbor, edge_weight,
+                                reversed);
+        }
+
+        const WEIGHT_T neighbor_distance = distance + edge_weight;
+        if (neighbor_distance < distances_[neighbor]) {
+          if (distances_[neighbor] == distance_table<WEIGHT_T>::unreachable) {
+            touched_.push_back(neighbor);
+          }
+          distances_[neighbor] = neighbor_distance;
+          to_explore.emplace(neighbor_distance, neighbor);
+        }
+      }
+    }
+
+    goal_distances.resize(goals.size());
+    for (std::size_t goal_index{0}; goal_index < goals.size(); ++goal_index) {
+      goal_distances[goal_index] = distances_[goals[goal_index]];
+    }
+    reset(goals);
+  }
+
+ private:
+  template <typename E>
+  [[noreturn]] static void throw_negative_weight(const dense_graph<E>& graph,
+                                                 std::size_t current,
+                                                 std::size_t neighbor,
+                                                 WEIGHT_T edge_weight,
+                                                 bool reversed) {
+    const auto [from, to]{reversed ? std::pair{neighbor, current}
+                                   : std::pair{current, neighbor}};
+    std::ostringstream error_msg;
+    error_msg << "Negative edge weight [" << edge_weight
+              << "] between vertices [" << graph.vertex_id(from) << "] -> ["
+              << graph.vertex_id(to) << "].";
+    throw std::invalid_argument{error_msg.str()};
+  }
+
+  void reset(const std::vector<std::size_t>& goals) {
+    for (const auto index : touched_) {
+      distances_[index] = distance_table<WEIGHT_T>::unreachable;
+    }
+    touched_.clear();
+    // Goals which were not reached are still marked
+    for (const auto goal : goals) {
+      is_goal_[goal] = false;
+    }
+  }
+
+  std::vector<WEIGHT_T> distances_;
+  std::vector<bool> is_goal_;
+  std::vector<std::size_t> touched_{};
+};
+
+template <typename E>
+std::vector<std::size_t> dense_indices(
+    const dense_graph<E>& graph, const std::vector<vertex_id_t>& vertex_ids) {
+  std::vector<std::size_t> indices{};
+  indices.reserve(vertex_ids.size());
+  for (const auto vertex_id : vertex_ids) {
+    if (!graph.contains(vertex_id)) {
+      throw std::invalid_argument{"Vertex with ID [" +
+                                  std::to_string(vertex_id) +
+                                  "] not found in graph."};
+    }
+    indices.push_back(graph.index(vertex_id));
+  }
+  return indices;
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::vector<WEIGHT_T> one_to_many_distances(
+    const graph<V, E, T>& graph, vertex_id_t source,
+    const std::vector<vertex_id_t>& targets) {
+  const auto dense_graph{detail::make_dense_graph(graph)};
+  const auto roots{detail::dense_indices(dense_graph, {source})};
+  const auto goals{detail::dense_indices(dense_graph, targets)};
+
+  std::vector<WEIGHT_T> distances{};
+  detail::goal_directed_search<WEIGHT_T> search{dense_graph.vertex_count()};
+  search.run(dense_graph, roots.front(), goals, false, distances);
+  return distances;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+distance_table<WEIGHT_T> many_to_many_distances(
+    const graph<V, E, T>& graph, const std::vector<vertex_id_t>& sources,
+    const std::vector<vertex_id_t>& targets,
+    const distance_table_options& options) {
+  // Searching from the smaller side takes fewer searches, a backward search
+  // from a target follows the incoming edges
+  const bool reversed{targets.size() < sources.size()};
+  const auto dense_graph{detail::make_dense_graph(
+      graph, reversed ? detail::dense_adjacency::INCOMING
+                      : detail::dense_adjacency::OUTGOING)};
+  const auto source_indices{detail::dense_indices(dense_graph, sources)};
+  const auto target_indices{detail::dense_indices(dense_graph, targets)};
+  const auto& roots{reversed ? target_indices : source_indices};
+  const auto& goals{reversed ? source_indices : target_indices};
+
+  distance_table<WEIGHT_T> table{.sources = sources, .targets = targets};
+  table.distances.assign(sources.size() * targets.size(),
+                         distance_table<WEIGHT_T>::unreachable);
+
+  auto& executor{options.executor != nullptr ? *options.executor
+                                             : default_executor()};
+
+  // Searches are handed out to one chunk of roots at a time, so there are at
+  // most as many as there are concurrent chunks rather than one per chunk
+  using search_t = detail::goal_directed_search<WEIGHT_T>;
+  std::mutex searches_mutex{};
+  std::vector<std::unique_ptr<search_t>> searches{};
+  std::vector<search_t*> idle_searches{};
+
+  parallel_for(executor, 0, roots.size(),
+               [&](std::size_t begin, std::size_t end) {
+                 search_t* search{nullptr};
+                 {
+                   const std::lock_guard lock{searches_mutex};
+                   if (idle_searches.empty()) {
+                     searches.push_back(std::make_unique<search_t>(
+                         dense_graph.vertex_count()));
+                     search = searches.back().get();
+                   } else {
+                     search = idle_searches.back();
+                     idle_searches.pop_back();
+                   }
+                 }
+
+                 std::vector<WEIGHT_T> goal_distances{};
+                 for (auto root{begin}; root < end; ++root) {
+                   search->run(dense_graph, roots[root], goals, reversed,
+                               goal_distances);
+                   for (std::size_t goal{0}; goal < goals.size(); ++goal) {
+                     const auto cell{reversed ? goal * targets.size() + root
+                                              : root * targets.size() + goal};
+                     table.distances[cell] = goal_distances[goal];
+                   }
+                 }
+
+                 const std::lock_guard lock{searches_mutex};
+                 idle_searches.push_back(search);
+               });
+  return table;
+}
+
+}  // namespace graaf::algorithm
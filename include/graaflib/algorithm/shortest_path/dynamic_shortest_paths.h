@@ -0,0 +1,132 @@
+#pragma once
+
+#include <graaflib/algorithm/shortest_path/common.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <optional>
+#include <queue>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief A shortest path tree from a source vertex which is kept up to date as
+ * the edges of the graph change.
+ *
+ * After an edge is added, removed or has its weight changed, update_edge
+ * repairs the tree in the manner of Ramalingam and Reps, instead of searching
+ * the whole graph again:
+ * - If the edge now offers a shorter path to its target, the shorter
+ *   distances are propagated with Dijkstra's algorithm from the target. Only
+ *   vertices whose distance decreases are visited.
+ * - If the edge was part of the tree and got longer or was removed, only the
+ *   subtree below it is affected. Those vertices are detached, given the best
+ *   distance through their unaffected neighbors, and settled again with
+ *   Dijkstra's algorithm.
+ * Changes to edges which are not part of the tree and do not shorten it cost
+ * a single lookup.
+ *
+ * The graph must outlive the tree, and every change to its edges must be
+ * reported through update_edge before the tree is queried again. Changes may
+ * be reported one by one or after a whole batch of them was made. Vertices
+ * may be added freely. A vertex may only be removed after all of its edges
+ * were removed and reported.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @tparam WEIGHT_T The type of edge weights, which must be non-negative.
+ */
+template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+class dynamic_shortest_paths {
+ public:
+  using graph_t = graph<V, E, T>;
+
+  /**
+   * Builds the shortest path tree with Dijkstra's algorithm.
+   *
+   * @param graph The graph to search.
+   * @param source_vertex The root of the shortest path tree.
+   * @throws invalid_argument - If a negative edge weight is encountered.
+   */
+  dynamic_shortest_paths(const graph_t& graph, vertex_id_t source_vertex);
+
+  [[nodiscard]] vertex_id_t source() const noexcept { return source_; }
+
+  /**
+   * Repairs the tree after the edge between two vertices was added, removed
+   * or had its weight changed in the graph. In undirected graphs the order of
+   * the vertices does not matter.
+   *
+   * @param vertex_id_lhs The ID of the source vertex of the edge
+   * @param vertex_id_rhs The ID of the target vertex of the edge
+   * @throws invalid_argument - If a negative edge weight is encountered.
+   */
+  void update_edge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs);
+
+  /**
+   * @return The shortest distance from the source to the vertex, or nullopt
+   * if the vertex is not reachable.
+   */
+  [[nodiscard]] std::optional<WEIGHT_T> distance(vertex_id_t vertex_id) const;
+
+  /**
+   * @return The shortest path from the source to the vertex, or nullopt if
+   * the vertex is not reachable.
+   */
+  [[nodiscard]] std::optional<graph_path<WEIGHT_T>> path(
+      vertex_id_t vertex_id) const;
+
+  /**
+   * @return The shortest paths to all reachable vertices, in the format of
+   * dijkstra_shortest_paths.
+   */
+  [[nodiscard]] std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> paths()
+      const;
+
+ private:
+  using queue_item = std::pair<WEIGHT_T, vertex_id_t>;
+  using queue_t = std::priority_queue<queue_item, std::vector<queue_item>,
+                                      std::greater<>>;
+
+  [[nodiscard]] WEIGHT_T edge_weight(vertex_id_t vertex_id_lhs,
+                                     vertex_id_t vertex_id_rhs) const;
+
+  // Updates the tree for the edge in one direction
+  void repair(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs);
+
+  // Detaches the subtree of the vertex and reattaches it through the
+  // remaining vertices
+  void reattach_subtree(vertex_id_t root);
+
+  void set_predecessor(vertex_id_t vertex_id, vertex_id_t predecessor);
+  void detach(vertex_id_t vertex_id);
+
+  // Dijkstra's algorithm from the queued vertices, settling only vertices
+  // whose distance decreases
+  void propagate(queue_t& to_explore);
+
+  [[nodiscard]] std::unordered_set<vertex_id_t> incoming_neighbors(
+      vertex_id_t vertex_id) const;
+
+  const graph_t& graph_;
+  vertex_id_t source_;
+
+  std::unordered_map<vertex_id_t, WEIGHT_T> distances_{};
+  std::unordered_map<vertex_id_t, vertex_id_t> predecessors_{};
+  std::unordered_map<vertex_id_t, std::unordered_set<vertex_id_t>> children_{};
+
+  // The graph only stores outgoing edges, the incoming ones of directed
+  // graphs are tracked here
+  std::unordered_map<vertex_id_t, std::unordered_set<vertex_id_t>> incoming_{};
+};
+
+}  // namespace graaf::algorithm
+
+#include "dynamic_shortest_paths.tpp"
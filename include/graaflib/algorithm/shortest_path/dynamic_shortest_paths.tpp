@@ -0,0 +1,228 @@
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+
+namespace graaf::algorithm {
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+dynamic_shortest_paths<V, E, T, WEIGHT_T>::dynamic_shortest_paths(
+    const graph_t& graph, vertex_id_t source_vertex)
+    : graph_{graph}, source_{source_vertex} {
+  if constexpr (T == graph_type::DIRECTED) {
+    for (const auto& [edge_id, _] : graph_.get_edges()) {
+      incoming_[edge_id.second].insert(edge_id.first);
+    }
+  }
+
+  distances_[source_] = 0;
+  queue_t to_explore{};
+  to_explore.emplace(0, source_);
+  propagate(to_explore);
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+WEIGHT_T dynamic_shortest_paths<V, E, T, WEIGHT_T>::edge_weight(
+    vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs) const {
+  const WEIGHT_T weight = get_weight(graph_.get_edge(vertex_id_lhs,
+                                                     vertex_id_rhs));
+  if (weight < 0) {
+    std::ostringstream error_msg;
+    error_msg << "Negative edge weight [" << weight << "] between vertices ["
+              << vertex_id_lhs << "] -> [" << vertex_id_rhs << "].";
+    throw std::invalid_argument{error_msg.str()};
+  }
+  return weight;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::unordered_set<vertex_id_t>
+dynamic_shortest_paths<V, E, T, WEIGHT_T>::incoming_neighbors(
+    vertex_id_t vertex_id) const {
+  if constexpr (T == graph_type::DIRECTED) {
+    const auto incoming{incoming_.find(vertex_id)};
+    return incoming == incoming_.end() ? std::unordered_set<vertex_id_t>{}
+                                       : incoming->second;
+  } else {
+    return graph_.get_neighbors(vertex_id);
+  }
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void dynamic_shortest_paths<V, E, T, WEIGHT_T>::set_predecessor(
+    vertex_id_t vertex_id, vertex_id_t predecessor) {
+  detach(vertex_id);
+  predecessors_[vertex_id] = predecessor;
+  children_[predecessor].insert(vertex_id);
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void dynamic_shortest_paths<V, E, T, WEIGHT_T>::detach(vertex_id_t vertex_id) {
+  const auto predecessor{predecessors_.find(vertex_id)};
+  if (predecessor == predecessors_.end()) {
+    return;
+  }
+  children_[predecessor->second].erase(vertex_id);
+  predecessors_.erase(predecessor);
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void dynamic_shortest_paths<V, E, T, WEIGHT_T>::propagate(
+    queue_t& to_explore) {
+  while (!to_explore.empty()) {
+    const auto [distance, current]{to_explore.top()};
+    to_explore.pop();
+    if (distance > distances_.at(current)) {
+      continue;
+    }
+
+    for (const auto neighbor : graph_.get_neighbors(current)) {
+      const WEIGHT_T neighbor_distance = distance + edge_weight(current,
+                                                                neighbor);
+      const auto known{distances_.find(neighbor)};
+      if (known == distances_.end() || neighbor_distance < known->second) {
+        distances_[neighbor] = neighbor_distance;
+        set_predecessor(neighbor, current);
+        to_explore.emplace(neighbor_distance, neighbor);
+      }
+    }
+  }
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void dynamic_shortest_paths<V, E, T, WEIGHT_T>::reattach_subtree(
+    vertex_id_t root) {
+  std::vector<vertex_id_t> subtree{root};
+  for (std::size_t position{0}; position < subtree.size(); ++position) {
+    const auto children{children_.find(subtree[position])};
+    if (children != children_.end()) {
+      subtree.insert(subtree.end(), children->second.begin(),
+                     children->second.end());
+    }
+  }
+
+  // Until reattached, the subtree counts as unreachable, such that it is not
+  // reattached through itself
+  for (const auto vertex_id : subtree) {
+    distances_.erase(vertex_id);
+    detach(vertex_id);
+  }
+
+  queue_t to_explore{};
+  for (const auto vertex_id : subtree) {
+    std::optional<std::pair<WEIGHT_T, vertex_id_t>> best{};
+    for (const auto neighbor : incoming_neighbors(vertex_id)) {
+      const auto neighbor_distance{distances_.find(neighbor)};
+      // The edge may have been removed in a batch of changes which is not
+      // fully reported yet
+      if (neighbor_distance == distances_.end() ||
+          !graph_.has_edge(neighbor, vertex_id)) {
+        continue;
+      }
+      const WEIGHT_T distance =
+          neighbor_distance->second + edge_weight(neighbor, vertex_id);
+      if (!best || distance < best->first) {
+        best.emplace(distance, neighbor);
+      }
+    }
+
+    if (best) {
+      distances_[vertex_id] = best->first;
+      set_predecessor(vertex_id, best->second);
+      to_explore.emplace(best->first, vertex_id);
+    }
+  }
+  propagate(to_explore);
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void dynamic_shortest_paths<V, E, T, WEIGHT_T>::repair(
+    vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs) {
+  if (vertex_id_rhs == source_) {
+    // Edge weights are non-negative, no edge can shorten the path to the
+    // source
+    return;
+  }
+
+  std::optional<WEIGHT_T> candidate{};
+  const auto lhs_distance{distances_.find(vertex_id_lhs)};
+  if (lhs_distance != distances_.end() &&
+      graph_.has_edge(vertex_id_lhs, vertex_id_rhs)) {
+    candidate =
+        lhs_distance->second + edge_weight(vertex_id_lhs, vertex_id_rhs);
+  }
+
+  const auto rhs_distance{distances_.find(vertex_id_rhs)};
+  const auto predecessor{predecessors_.find(vertex_id_rhs)};
+  const bool is_tree_edge{predecessor != predecessors_.end() &&
+                          predecessor->second == vertex_id_lhs};
+
+  if (candidate &&
+      (rhs_distance == distances_.end() || *candidate < rhs_distance->second)) {
+    distances_[vertex_id_rhs] = *candidate;
+    set_predecessor(vertex_id_rhs, vertex_id_lhs);
+    queue_t to_explore{};
+    to_explore.emplace(*candidate, vertex_id_rhs);
+    propagate(to_explore);
+  } else if (is_tree_edge &&
+             (!candidate || *candidate > rhs_distance->second)) {
+    reattach_subtree(vertex_id_rhs);
+  }
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void dynamic_shortest_paths<V, E, T, WEIGHT_T>::update_edge(
+    vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs) {
+  if constexpr (T == graph_type::DIRECTED) {
+    if (graph_.has_edge(vertex_id_lhs, vertex_id_rhs)) {
+      incoming_[vertex_id_rhs].insert(vertex_id_lhs);
+    } else if (const auto incoming{incoming_.find(vertex_id_rhs)};
+               incoming != incoming_.end()) {
+      incoming->second.erase(vertex_id_lhs);
+    }
+    repair(vertex_id_lhs, vertex_id_rhs);
+  } else {
+    repair(vertex_id_lhs, vertex_id_rhs);
+    repair(vertex_id_rhs, vertex_id_lhs);
+  }
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::optional<WEIGHT_T> dynamic_shortest_paths<V, E, T, WEIGHT_T>::distance(
+    vertex_id_t vertex_id) const {
+  const auto distance{distances_.find(vertex_id)};
+  if (distance == distances_.end()) {
+    return std::nullopt;
+  }
+  return distance->second;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::optional<graph_path<WEIGHT_T>>
+dynamic_shortest_paths<V, E, T, WEIGHT_T>::path(vertex_id_t vertex_id) const {
+  const auto distance{distances_.find(vertex_id)};
+  if (distance == distances_.end()) {
+    return std::nullopt;
+  }
+
+  graph_path<WEIGHT_T> shortest_path{{}, distance->second};
+  for (auto current{vertex_id}; current != source_;
+       current = predecessors_.at(current)) {
+    shortest_path.vertices.push_front(current);
+  }
+  shortest_path.vertices.push_front(source_);
+  return shortest_path;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>>
+dynamic_shortest_paths<V, E, T, WEIGHT_T>::paths() const {
+  std::unordered_map<vertex_id_t, graph_path<WEIGHT_T>> shortest_paths{};
+  shortest_paths.reserve(distances_.size());
+  for (const auto& [vertex_id, _] : distances_) {
+    shortest_paths.emplace(vertex_id, *path(vertex_id));
+  }
+  return shortest_paths;
+}
+
+}  // namespace graaf::algorithm
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
+#include <type_traits>
+
 namespace graaf::algorithm {
 /**
  * @brief Floyd-Warshall Algorithm
@@ -17,13 +21,33 @@ namespace graaf::algorithm {
  * @tparam T the graph type (DIRECTED or UNDIRECTED)
  * @tparam WEIGHT_T The weight type of an edge in the graph
  * @param graph The graph object
+ * @param observer An algorithm_observer, a vertex is settled when it is used
+ * as intermediate vertex and an edge is relaxed for each path it shortens. If
+ * a stoppable_observer stops the algorithm, the distances are upper bounds.
  * @return A 2D vector where element at [i][j] is the shortest distance from
  * vertex i to vertex j.
  */
 template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>())),
+          typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+std::vector<std::vector<WEIGHT_T>> floyd_warshall_shortest_paths(
+    const graph<V, E, T>& graph, OBSERVER_T&& observer = OBSERVER_T{});
+
+/**
+ * @brief Floyd-Warshall Algorithm with the given execution policy.
+ *
+ * With a parallel policy, the rows of the distance matrix are updated in
+ * parallel on the default_executor for every intermediate vertex. The result
+ * is the same as that of the sequential algorithm.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see floyd_warshall_shortest_paths
+ */
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
           typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
 std::vector<std::vector<WEIGHT_T>> floyd_warshall_shortest_paths(
-    const graph<V, E, T>& graph);
+    POLICY_T&& policy, const graph<V, E, T>& graph);
 
 };  // namespace graaf::algorithm
 
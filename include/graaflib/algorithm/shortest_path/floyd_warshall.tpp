@@ -1,15 +1,20 @@
 #pragma once
 
 #include <graaflib/algorithm/shortest_path/floyd_warshall.h>
+#include <graaflib/executor.h>
 
 #include <limits>
 #include <vector>
 
 namespace graaf::algorithm {
 
-template <typename V, typename E, graph_type T, typename WEIGHT_T>
+template <typename V, typename E, graph_type T, typename WEIGHT_T,
+          typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 std::vector<std::vector<WEIGHT_T>> floyd_warshall_shortest_paths(
-    const graph<V, E, T>& graph) {
+    const graph<V, E, T>& graph, OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer, "floyd_warshall_shortest_paths"};
+
   WEIGHT_T ZERO{};
   std::size_t n = graph.vertex_count();
   auto INF = std::numeric_limits<WEIGHT_T>::max();
@@ -31,14 +36,20 @@ std::vector<std::vector<WEIGHT_T>> floyd_warshall_shortest_paths(
   }
 
   for (std::size_t through_vertex = 0; through_vertex < n; ++through_vertex) {
+    observer.on_vertex_settled(through_vertex);
     for (std::size_t start_vertex = 0; start_vertex < n; ++start_vertex) {
+      if (detail::stop_requested(observer)) {
+        return shortest_paths;
+      }
       if (shortest_paths[start_vertex][through_vertex] < INF) {
         for (std::size_t end_vertex = 0; end_vertex < n; ++end_vertex) {
           if (shortest_paths[through_vertex][end_vertex] < INF) {
-            shortest_paths[start_vertex][end_vertex] =
-                std::min(shortest_paths[start_vertex][end_vertex],
-                         shortest_paths[start_vertex][through_vertex] +
-                             shortest_paths[through_vertex][end_vertex]);
+            const auto distance{shortest_paths[start_vertex][through_vertex] +
+                                shortest_paths[through_vertex][end_vertex]};
+            if (distance < shortest_paths[start_vertex][end_vertex]) {
+              shortest_paths[start_vertex][end_vertex] = distance;
+              observer.on_edge_relaxed(edge_id_t{start_vertex, end_vertex});
+            }
           }
         }
       }
@@ -48,4 +59,70 @@ std::vector<std::vector<WEIGHT_T>> floyd_warshall_shortest_paths(
   return shortest_paths;
 }
 
+namespace detail {
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::vector<std::vector<WEIGHT_T>> parallel_floyd_warshall_shortest_paths(
+    const graph<V, E, T>& graph) {
+  const std::size_t n{graph.vertex_count()};
+  constexpr auto INF{std::numeric_limits<WEIGHT_T>::max()};
+
+  std::vector<std::vector<WEIGHT_T>> shortest_paths(
+      n, std::vector<WEIGHT_T>(n, INF));
+
+  for (std::size_t vertex{0}; vertex < n; ++vertex) {
+    shortest_paths[vertex][vertex] = WEIGHT_T{};
+  }
+
+  for (std::size_t from_vertex{0}; from_vertex < n; ++from_vertex) {
+    for (const auto& to_vertex : graph.get_neighbors(from_vertex)) {
+      shortest_paths[from_vertex][to_vertex] =
+          std::min(shortest_paths[from_vertex][to_vertex],
+                   get_weight(graph.get_edge(from_vertex, to_vertex)));
+    }
+  }
+
+  // Row k does not change in iteration k unless there is a negative cycle, a
+  // copy keeps the other rows from reading it while it is being written
+  std::vector<WEIGHT_T> through_row(n);
+  for (std::size_t through_vertex{0}; through_vertex < n; ++through_vertex) {
+    through_row = shortest_paths[through_vertex];
+    parallel_for(default_executor(), 0, n,
+                 [&](std::size_t begin, std::size_t end) {
+                   for (auto start_vertex{begin}; start_vertex < end;
+                        ++start_vertex) {
+                     auto& row{shortest_paths[start_vertex]};
+                     const auto to_through{row[through_vertex]};
+                     if (to_through == INF) {
+                       continue;
+                     }
+                     for (std::size_t end_vertex{0}; end_vertex < n;
+                          ++end_vertex) {
+                       if (through_row[end_vertex] < INF) {
+                         const auto distance{to_through +
+                                             through_row[end_vertex]};
+                         row[end_vertex] = std::min(row[end_vertex], distance);
+                       }
+                     }
+                   }
+                 });
+  }
+
+  return shortest_paths;
+}
+
+}  // namespace detail
+
+template <execution_policy POLICY_T, typename V, typename E, graph_type T,
+          typename WEIGHT_T>
+std::vector<std::vector<WEIGHT_T>> floyd_warshall_shortest_paths(
+    POLICY_T&& /*policy*/, const graph<V, E, T>& graph) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_floyd_warshall_shortest_paths<V, E, T, WEIGHT_T>(
+        graph);
+  } else {
+    return floyd_warshall_shortest_paths(graph);
+  }
+}
+
 };  // namespace graaf::algorithm
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <graaflib/algorithm/shortest_path/common.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <type_traits>
+#include <vector>
+
+namespace graaf::algorithm::detail {
+
+/**
+ * The priority queues below are monotone: the distance of every pushed item
+ * must be at least the distance of the last popped item. Dijkstra's algorithm
+ * with non-negative weights meets this, and in exchange integer distances are
+ * ordered without comparisons. All queues share the interface of
+ * std::priority_queue with std::greater<>, except that top is not const.
+ */
+
+/**
+ * 0-1 BFS: with edge weights of zero and one, all queued distances are either
+ * the last popped distance or one more, so a deque kept in order by pushing to
+ * the front or the back suffices.
+ */
+template <typename WEIGHT_T>
+class zero_one_queue {
+ public:
+  using value_type = path_vertex<WEIGHT_T>;
+
+  [[nodiscard]] bool empty() const noexcept { return items_.empty(); }
+  [[nodiscard]] std::size_t size() const noexcept { return items_.size(); }
+
+  void push(const value_type& item);
+  [[nodiscard]] const value_type& top() { return items_.front(); }
+  void pop() { items_.pop_front(); }
+
+ private:
+  std::deque<value_type> items_{};
+};
+
+/**
+ * Dial's algorithm: a circular array of max_weight + 1 buckets, one per
+ * distance. All queued distances lie within max_weight of the smallest one,
+ * so they map to distinct buckets.
+ */
+template <typename WEIGHT_T>
+class dial_queue {
+ public:
+  using value_type = path_vertex<WEIGHT_T>;
+
+  explicit dial_queue(WEIGHT_T max_weight)
+      : buckets_(static_cast<std::size_t>(max_weight) + 1) {}
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+  void push(const value_type& item);
+  [[nodiscard]] const value_type& top();
+  void pop();
+
+ private:
+  [[nodiscard]] std::vector<value_type>& bucket_of(WEIGHT_T distance) {
+    return buckets_[static_cast<std::size_t>(distance) % buckets_.size()];
+  }
+
+  std::vector<std::vector<value_type>> buckets_;
+  // The smallest distance which may still be queued
+  WEIGHT_T current_{0};
+  std::size_t size_{0};
+};
+
+/**
+ * A radix heap, for integer weights of any size. Bucket i holds the items
+ * whose distance first differs from the last popped distance in bit i - 1.
+ * When the first bucket runs empty, the next non-empty bucket is spread over
+ * the lower buckets, so each item moves down at most once per bit.
+ */
+template <typename WEIGHT_T>
+class radix_heap {
+ public:
+  using value_type = path_vertex<WEIGHT_T>;
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+  void push(const value_type& item);
+  [[nodiscard]] const value_type& top();
+  void pop();
+
+ private:
+  using key_t = std::make_unsigned_t<WEIGHT_T>;
+  static constexpr std::size_t bucket_count{sizeof(key_t) * CHAR_BIT + 1};
+
+  [[nodiscard]] std::size_t bucket_index(WEIGHT_T distance) const noexcept;
+
+  std::array<std::vector<value_type>, bucket_count> buckets_{};
+  WEIGHT_T last_{0};
+  std::size_t size_{0};
+};
+
+// Dial's algorithm scans every bucket between two distances, which beyond
+// this maximum weight costs more than the radix heap saves
+inline constexpr std::size_t dial_queue_max_weight{255};
+
+/**
+ * Invokes the function with the cheapest queue for the edge weights of the
+ * graph: for integer weights, a monotone integer queue chosen by the largest
+ * weight, otherwise a binary heap.
+ *
+ * Finding the largest weight takes a pass over all edges. When a search is
+ * expected to settle only part of the graph, scan_weights should be false,
+ * which selects the radix heap for integer weights without that pass.
+ */
+template <typename WEIGHT_T, typename V, typename E, graph_type T,
+          typename FUNCTION_T>
+decltype(auto) with_dijkstra_queue(const graph<V, E, T>& graph,
+                                   bool scan_weights, FUNCTION_T&& function);
+
+}  // namespace graaf::algorithm::detail
+
+#include "monotone_queue.tpp"
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+namespace graaf::algorithm::detail {
+
+template <typename WEIGHT_T>
+void zero_one_queue<WEIGHT_T>::push(const value_type& item) {
+  if (items_.empty() ||
+      item.dist_from_start <= items_.front().dist_from_start) {
+    items_.push_front(item);
+  } else {
+    items_.push_back(item);
+  }
+}
+
+template <typename WEIGHT_T>
+void dial_queue<WEIGHT_T>::push(const value_type& item) {
+  bucket_of(item.dist_from_start).push_back(item);
+  ++size_;
+}
+
+template <typename WEIGHT_T>
+const typename dial_queue<WEIGHT_T>::value_type& dial_queue<WEIGHT_T>::top() {
+  while (bucket_of(current_).empty()) {
+    ++current_;
+  }
+  return bucket_of(current_).back();
+}
+
+template <typename WEIGHT_T>
+void dial_queue<WEIGHT_T>::pop() {
+  [[maybe_unused]] const auto& item{top()};
+  bucket_of(current_).pop_back();
+  --size_;
+}
+
+template <typename WEIGHT_T>
+std::size_t radix_heap<WEIGHT_T>::bucket_index(
+    WEIGHT_T distance) const noexcept {
+  return static_cast<std::size_t>(std::bit_width(
+      static_cast<key_t>(distance) ^ static_cast<key_t>(last_)));
+}
+
+template <typename WEIGHT_T>
+void radix_heap<WEIGHT_T>::push(const value_type& item) {
+  buckets_[bucket_index(item.dist_from_start)].push_back(item);
+  ++size_;
+}
+
+template <typename WEIGHT_T>
+const typename radix_heap<WEIGHT_T>::value_type& radix_heap<WEIGHT_T>::top() {
+  if (buckets_[0].empty()) {
+    auto bucket{std::ranges::find_if(
+        buckets_, [](const auto& items) { return !items.empty(); })};
+
+    last_ = std::ranges::min(*bucket, {}, &value_type::dist_from_start)
+                .dist_from_start;
+    for (const auto& item : *bucket) {
+      buckets_[bucket_index(item.dist_from_start)].push_back(item);
+    }
+    bucket->clear();
+  }
+  return buckets_[0].back();
+}
+
+template <typename WEIGHT_T>
+void radix_heap<WEIGHT_T>::pop() {
+  [[maybe_unused]] const auto& item{top()};
+  buckets_[0].pop_back();
+  --size_;
+}
+
+template <typename WEIGHT_T, typename V, typename E, graph_type T,
+          typename FUNCTION_T>
+decltype(auto) with_dijkstra_queue(const graph<V, E, T>& graph,
+                                   bool scan_weights, FUNCTION_T&& function) {
+  if constexpr (std::is_integral_v<WEIGHT_T>) {
+    if (scan_weights) {
+      WEIGHT_T max_weight{0};
+      for (const auto& [_, edge] : graph.get_edges()) {
+        max_weight = std::max<WEIGHT_T>(max_weight, get_weight(edge));
+      }
+
+      if (max_weight <= 1) {
+        zero_one_queue<WEIGHT_T> queue{};
+        return function(queue);
+      }
+      if (static_cast<std::size_t>(max_weight) <= dial_queue_max_weight) {
+        dial_queue<WEIGHT_T> queue{max_weight};
+        return function(queue);
+      }
+    }
+    radix_heap<WEIGHT_T> queue{};
+    return function(queue);
+  } else {
+    std::priority_queue<path_vertex<WEIGHT_T>,
+                        std::vector<path_vertex<WEIGHT_T>>, std::greater<>>
+        queue{};
+    return function(queue);
+  }
+}
+
+}  // namespace graaf::algorithm::detail
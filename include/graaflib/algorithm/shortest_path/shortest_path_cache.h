@@ -0,0 +1,133 @@
+#pragma once
+
+#include <graaflib/algorithm/shortest_path/common.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+
+namespace graaf::algorithm {
+
+/**
+ * @brief Options of a shortest_path_cache.
+ */
+struct shortest_path_cache_options {
+  // The estimated memory of the cached paths, beyond which the least recently
+  // used paths are evicted
+  std::size_t max_bytes{std::size_t{64} << 20};
+};
+
+/**
+ * @brief A cache of single pair shortest path queries on a graph.
+ *
+ * Queries are keyed by the algorithm, the start vertex and the end vertex. All
+ * cached paths are dropped when the version of the graph changed since they
+ * were computed, i.e. when a vertex or edge was added or removed. Changes made
+ * in place through graph::get_edge are not detected, call clear after those.
+ *
+ * The A* search is keyed without its heuristic: with an admissible heuristic
+ * it finds a shortest path regardless, so a cached path is reused for any
+ * heuristic.
+ *
+ * The graph must outlive the cache. Like the graph, the cache is not safe to
+ * use from several threads at once.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @tparam WEIGHT_T The type of edge weights.
+ */
+template <typename V, typename E, graph_type T,
+          typename WEIGHT_T = decltype(get_weight(std::declval<E>()))>
+class shortest_path_cache {
+ public:
+  using graph_t = graph<V, E, T>;
+  using path_t = std::optional<graph_path<WEIGHT_T>>;
+
+  explicit shortest_path_cache(const graph_t& graph,
+                               shortest_path_cache_options options = {})
+      : graph_{graph}, options_{options}, version_{graph.version()} {}
+
+  /**
+   * @see dijkstra_shortest_path
+   */
+  [[nodiscard]] path_t dijkstra_shortest_path(vertex_id_t start_vertex,
+                                              vertex_id_t end_vertex);
+
+  /**
+   * @see bfs_shortest_path
+   */
+  [[nodiscard]] path_t bfs_shortest_path(vertex_id_t start_vertex,
+                                         vertex_id_t end_vertex);
+
+  /**
+   * @see a_star_search
+   */
+  template <typename HEURISTIC_T>
+    requires std::is_invocable_r_v<WEIGHT_T, HEURISTIC_T&, vertex_id_t>
+  [[nodiscard]] path_t a_star_search(vertex_id_t start_vertex,
+                                     vertex_id_t target_vertex,
+                                     const HEURISTIC_T& heuristic);
+
+  // The number of cached paths
+  [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+
+  // The estimated memory of the cached paths in bytes
+  [[nodiscard]] std::size_t memory_usage() const noexcept { return bytes_; }
+
+  [[nodiscard]] std::size_t hit_count() const noexcept { return hits_; }
+  [[nodiscard]] std::size_t miss_count() const noexcept { return misses_; }
+
+  void clear() noexcept;
+
+ private:
+  enum class query_algorithm : std::uint8_t { DIJKSTRA, BFS, A_STAR };
+
+  struct query_key {
+    query_algorithm algorithm;
+    vertex_id_t start_vertex;
+    vertex_id_t end_vertex;
+
+    bool operator==(const query_key& other) const = default;
+  };
+
+  struct query_key_hash {
+    [[nodiscard]] std::size_t operator()(const query_key& key) const noexcept;
+  };
+
+  struct entry {
+    query_key key;
+    path_t path;
+    std::size_t bytes;
+  };
+
+  // Looks the query up, or computes it and caches the result
+  template <typename COMPUTE_FN_T>
+  [[nodiscard]] path_t query(const query_key& key,
+                             const COMPUTE_FN_T& compute);
+
+  [[nodiscard]] static std::size_t estimate_bytes(const path_t& path) noexcept;
+
+  const graph_t& graph_;
+  shortest_path_cache_options options_;
+  std::uint64_t version_;
+
+  // Most recently used first
+  std::list<entry> entries_{};
+  std::unordered_map<query_key, typename std::list<entry>::iterator,
+                     query_key_hash>
+      index_{};
+  std::size_t bytes_{0};
+
+  std::size_t hits_{0};
+  std::size_t misses_{0};
+};
+
+}  // namespace graaf::algorithm
+
+#include "shortest_path_cache.tpp"
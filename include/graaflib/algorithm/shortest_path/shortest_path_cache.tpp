@@ -0,0 +1,108 @@
+#pragma once
+
+#include <graaflib/algorithm/shortest_path/a_star.h>
+#include <graaflib/algorithm/shortest_path/bfs_shortest_path.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_path.h>
+
+#include <functional>
+
+namespace graaf::algorithm {
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::size_t
+shortest_path_cache<V, E, T, WEIGHT_T>::query_key_hash::operator()(
+    const query_key& key) const noexcept {
+  const auto combine{[](std::size_t seed, std::size_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+  }};
+  auto seed{static_cast<std::size_t>(key.algorithm)};
+  seed = combine(seed, std::hash<vertex_id_t>{}(key.start_vertex));
+  return combine(seed, std::hash<vertex_id_t>{}(key.end_vertex));
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+std::size_t shortest_path_cache<V, E, T, WEIGHT_T>::estimate_bytes(
+    const path_t& path) noexcept {
+  // An entry is a node of the recency list and of the index, and every vertex
+  // of the path a node of its list
+  constexpr std::size_t entry_bytes{
+      sizeof(entry) + 2 * sizeof(void*) + sizeof(query_key) +
+      sizeof(typename std::list<entry>::iterator) + 2 * sizeof(void*)};
+  constexpr std::size_t vertex_bytes{sizeof(vertex_id_t) + 2 * sizeof(void*)};
+  return entry_bytes + (path ? path->vertices.size() * vertex_bytes : 0);
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+void shortest_path_cache<V, E, T, WEIGHT_T>::clear() noexcept {
+  index_.clear();
+  entries_.clear();
+  bytes_ = 0;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+template <typename COMPUTE_FN_T>
+typename shortest_path_cache<V, E, T, WEIGHT_T>::path_t
+shortest_path_cache<V, E, T, WEIGHT_T>::query(const query_key& key,
+                                              const COMPUTE_FN_T& compute) {
+  if (graph_.version() != version_) {
+    clear();
+    version_ = graph_.version();
+  }
+
+  if (const auto cached{index_.find(key)}; cached != index_.end()) {
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, cached->second);
+    return cached->second->path;
+  }
+
+  ++misses_;
+  auto path{compute()};
+  const auto bytes{estimate_bytes(path)};
+  entries_.push_front(entry{key, path, bytes});
+  index_.emplace(key, entries_.begin());
+  bytes_ += bytes;
+
+  // A path larger than the whole budget is not kept either
+  while (bytes_ > options_.max_bytes) {
+    const auto& evicted{entries_.back()};
+    bytes_ -= evicted.bytes;
+    index_.erase(evicted.key);
+    entries_.pop_back();
+  }
+  return path;
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+typename shortest_path_cache<V, E, T, WEIGHT_T>::path_t
+shortest_path_cache<V, E, T, WEIGHT_T>::dijkstra_shortest_path(
+    vertex_id_t start_vertex, vertex_id_t end_vertex) {
+  return query({query_algorithm::DIJKSTRA, start_vertex, end_vertex}, [&] {
+    return algorithm::dijkstra_shortest_path<V, E, T, WEIGHT_T>(
+        graph_, start_vertex, end_vertex);
+  });
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+typename shortest_path_cache<V, E, T, WEIGHT_T>::path_t
+shortest_path_cache<V, E, T, WEIGHT_T>::bfs_shortest_path(
+    vertex_id_t start_vertex, vertex_id_t end_vertex) {
+  return query({query_algorithm::BFS, start_vertex, end_vertex}, [&] {
+    return algorithm::bfs_shortest_path<V, E, T, WEIGHT_T>(
+        graph_, start_vertex, end_vertex);
+  });
+}
+
+template <typename V, typename E, graph_type T, typename WEIGHT_T>
+template <typename HEURISTIC_T>
+  requires std::is_invocable_r_v<WEIGHT_T, HEURISTIC_T&, vertex_id_t>
+typename shortest_path_cache<V, E, T, WEIGHT_T>::path_t
+shortest_path_cache<V, E, T, WEIGHT_T>::a_star_search(
+    vertex_id_t start_vertex, vertex_id_t target_vertex,
+    const HEURISTIC_T& heuristic) {
+  return query({query_algorithm::A_STAR, start_vertex, target_vertex}, [&] {
+    return algorithm::a_star_search<V, E, T, HEURISTIC_T, WEIGHT_T>(
+        graph_, start_vertex, target_vertex, heuristic);
+  });
+}
+
+}  // namespace graaf::algorithm
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <graaflib/algorithm/observer.h>
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 #include <graaflib/types.h>
 
+#include <type_traits>
+
 namespace graaf::algorithm {
 
 /**
@@ -17,13 +21,37 @@ namespace graaf::algorithm {
  * @tparam V Vertex type.
  * @tparam E Edge type.
  * @param graph The graph for which to compute SCCs.
+ * @param observer An algorithm_observer notified of the visited vertices, the
+ * traversed edges and the operations on the stack of the algorithm.
  * @return std::vector<std::vector<vertex_id_t>> A vector of vectors
  * representing SCCs.
  */
-template <typename V, typename E>
+template <typename V, typename E, typename OBSERVER_T = detail::noop_observer>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
+[[nodiscard]] std::vector<std::vector<vertex_id_t>>
+tarjans_strongly_connected_components(
+    const graph<V, E, graph_type::DIRECTED>& graph,
+    OBSERVER_T&& observer = OBSERVER_T{});
+
+/**
+ * Computes the Strongly Connected Components (SCCs) of a graph with the given
+ * execution policy.
+ *
+ * With a parallel policy, Tarjan's algorithm is replaced by the
+ * forward-backward algorithm on the default_executor. Vertices without
+ * incoming or outgoing edges are first trimmed off as singleton components.
+ * The remaining vertices are split by the sets reachable from and reaching a
+ * pivot vertex, and the resulting subproblems are solved in parallel. The
+ * components are the same as those of the sequential algorithm, but are
+ * returned in another order.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see tarjans_strongly_connected_components
+ */
+template <execution_policy POLICY_T, typename V, typename E>
 [[nodiscard]] std::vector<std::vector<vertex_id_t>>
 tarjans_strongly_connected_components(
-    const graph<V, E, graph_type::DIRECTED>& graph);
+    POLICY_T&& policy, const graph<V, E, graph_type::DIRECTED>& graph);
 
 }  // namespace graaf::algorithm
 
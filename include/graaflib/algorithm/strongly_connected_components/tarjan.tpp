@@ -1,18 +1,28 @@
 #pragma once
 
+#include <graaflib/algorithm/dense_graph.h>
 #include <graaflib/algorithm/strongly_connected_components/tarjan.h>
+#include <graaflib/executor.h>
 
+#include <atomic>
 #include <functional>  // For std::function
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <stack>
 #include <unordered_map>
 #include <vector>
 
 namespace graaf::algorithm {
 
-template <typename V, typename E>
+template <typename V, typename E, typename OBSERVER_T>
+  requires algorithm_observer<std::remove_reference_t<OBSERVER_T>>
 [[nodiscard]] std::vector<std::vector<vertex_id_t>>
 tarjans_strongly_connected_components(
-    const graph<V, E, graph_type::DIRECTED>& graph) {
+    const graph<V, E, graph_type::DIRECTED>& graph, OBSERVER_T&& observer) {
+  detail::observer_scope scope{observer,
+                               "tarjans_strongly_connected_components"};
+
   // Vector to store strongly connected components
   std::vector<std::vector<vertex_id_t>> sccs;
 
@@ -39,9 +49,12 @@ tarjans_strongly_connected_components(
     // Push the vertex onto the stack and mark it as on-stack
     stack.push(vertex);
     on_stack[vertex] = true;
+    observer.on_queue_push(stack.size());
+    observer.on_vertex_settled(vertex);
 
     // Traverse neighbors
     for (const auto neighbor : graph.get_neighbors(vertex)) {
+      observer.on_edge_relaxed(edge_id_t{vertex, neighbor});
       if (!indices.contains(neighbor)) {
         // Neighbor has not yet been visited; recurse on it
         strong_connect(neighbor);
@@ -60,6 +73,7 @@ tarjans_strongly_connected_components(
       do {
         top = stack.top();
         stack.pop();
+        observer.on_queue_pop(stack.size());
         on_stack[top] = false;
         scc.push_back(top);  // Add to current strongly connected component
       } while (top != vertex);
@@ -79,4 +93,184 @@ tarjans_strongly_connected_components(
   return sccs;
 }
 
+namespace detail {
+
+template <typename V, typename E>
+std::vector<std::vector<vertex_id_t>> parallel_strongly_connected_components(
+    const graph<V, E, graph_type::DIRECTED>& graph) {
+  const auto successors{make_dense_graph(graph, dense_adjacency::OUTGOING)};
+  const auto predecessors{make_dense_graph(graph, dense_adjacency::INCOMING)};
+  const auto vertex_count{successors.vertex_count()};
+
+  // Every vertex belongs to a subproblem until its component is found. Only
+  // vertices of the same subproblem can be in the same component.
+  constexpr auto solved{std::numeric_limits<std::size_t>::max()};
+  std::vector<std::atomic<std::size_t>> parts(vertex_count);
+  for (auto& part : parts) {
+    part.store(0, std::memory_order_relaxed);
+  }
+  std::atomic<std::size_t> next_part{1};
+
+  std::mutex sccs_mutex{};
+  std::vector<std::vector<vertex_id_t>> sccs{};
+
+  // Whether the vertex has a neighbor other than itself in its subproblem
+  const auto has_neighbor_in_part{[&parts](const auto& dense_graph,
+                                           std::size_t vertex) {
+    const auto part{parts[vertex].load(std::memory_order_relaxed)};
+    for (const auto neighbor : dense_graph.neighbors(vertex)) {
+      if (neighbor != vertex &&
+          parts[neighbor].load(std::memory_order_relaxed) == part) {
+        return true;
+      }
+    }
+    return false;
+  }};
+
+  // A vertex without incoming or outgoing edges is on no cycle. Each trimming
+  // round may expose more such vertices, the remaining ones are left to the
+  // forward-backward splitting.
+  constexpr std::size_t max_trimming_rounds{8};
+  std::vector<std::size_t> remaining(vertex_count);
+  std::iota(remaining.begin(), remaining.end(), std::size_t{0});
+  for (std::size_t round{0}; round < max_trimming_rounds; ++round) {
+    std::vector<std::size_t> kept{};
+    std::mutex kept_mutex{};
+    parallel_for(
+        default_executor(), 0, remaining.size(),
+        [&](std::size_t begin, std::size_t end) {
+          std::vector<std::size_t> local_kept{};
+          std::vector<std::vector<vertex_id_t>> local_sccs{};
+          for (auto position{begin}; position < end; ++position) {
+            const auto vertex{remaining[position]};
+            if (has_neighbor_in_part(successors, vertex) &&
+                has_neighbor_in_part(predecessors, vertex)) {
+              local_kept.push_back(vertex);
+            } else {
+              parts[vertex].store(solved, std::memory_order_relaxed);
+              local_sccs.push_back({successors.vertex_id(vertex)});
+            }
+          }
+          const std::lock_guard kept_lock{kept_mutex};
+          kept.insert(kept.end(), local_kept.begin(), local_kept.end());
+          const std::lock_guard sccs_lock{sccs_mutex};
+          sccs.insert(sccs.end(), std::make_move_iterator(local_sccs.begin()),
+                      std::make_move_iterator(local_sccs.end()));
+        },
+        {.grain_size = 256});
+
+    const bool trimmed_any{kept.size() < remaining.size()};
+    remaining = std::move(kept);
+    if (!trimmed_any) {
+      break;
+    }
+  }
+
+  // Each vertex is only read and written by the task of its subproblem
+  std::vector<char> forward(vertex_count, false);
+  std::vector<char> backward(vertex_count, false);
+
+  // Marks the vertices of the subproblem reachable from the pivot
+  const auto reach{[&parts](const auto& dense_graph, std::size_t pivot,
+                            std::size_t part, std::vector<char>& reached) {
+    std::vector<std::size_t> stack{pivot};
+    reached[pivot] = true;
+    while (!stack.empty()) {
+      const auto vertex{stack.back()};
+      stack.pop_back();
+      for (const auto neighbor : dense_graph.neighbors(vertex)) {
+        // Only the flags of the own subproblem may be read, the other ones
+        // are written concurrently by the tasks of their subproblems
+        if (parts[neighbor].load(std::memory_order_relaxed) == part &&
+            !reached[neighbor]) {
+          reached[neighbor] = true;
+          stack.push_back(neighbor);
+        }
+      }
+    }
+  }};
+
+  std::vector<std::vector<std::size_t>> subproblems{};
+  if (!remaining.empty()) {
+    subproblems.push_back(std::move(remaining));
+  }
+
+  while (!subproblems.empty()) {
+    std::mutex next_subproblems_mutex{};
+    std::vector<std::vector<std::size_t>> next_subproblems{};
+
+    parallel_for(
+        default_executor(), 0, subproblems.size(),
+        [&](std::size_t begin, std::size_t end) {
+          for (auto index{begin}; index < end; ++index) {
+            const auto& subproblem{subproblems[index]};
+            const auto pivot{subproblem.front()};
+            const auto part{parts[pivot].load(std::memory_order_relaxed)};
+            reach(successors, pivot, part, forward);
+            reach(predecessors, pivot, part, backward);
+
+            // The component of the pivot, and the vertices only reachable
+            // from it, only reaching it, or neither
+            std::vector<vertex_id_t> scc{};
+            std::vector<std::size_t> splits[3]{};
+            for (const auto vertex : subproblem) {
+              if (forward[vertex] && backward[vertex]) {
+                scc.push_back(successors.vertex_id(vertex));
+              } else {
+                splits[forward[vertex] ? 0 : backward[vertex] ? 1 : 2]
+                    .push_back(vertex);
+              }
+            }
+
+            // Reachability of the other vertices is evaluated before any of
+            // them moves to a new subproblem
+            for (const auto vertex : subproblem) {
+              if (forward[vertex] && backward[vertex]) {
+                parts[vertex].store(solved, std::memory_order_relaxed);
+              }
+              forward[vertex] = false;
+              backward[vertex] = false;
+            }
+            for (auto& split : splits) {
+              if (split.empty()) {
+                continue;
+              }
+              const auto split_part{next_part.fetch_add(1)};
+              for (const auto vertex : split) {
+                parts[vertex].store(split_part, std::memory_order_relaxed);
+              }
+            }
+
+            {
+              const std::lock_guard lock{sccs_mutex};
+              sccs.push_back(std::move(scc));
+            }
+            const std::lock_guard lock{next_subproblems_mutex};
+            for (auto& split : splits) {
+              if (!split.empty()) {
+                next_subproblems.push_back(std::move(split));
+              }
+            }
+          }
+        },
+        {.grain_size = 1});
+
+    subproblems = std::move(next_subproblems);
+  }
+
+  return sccs;
+}
+
+}  // namespace detail
+
+template <execution_policy POLICY_T, typename V, typename E>
+std::vector<std::vector<vertex_id_t>> tarjans_strongly_connected_components(
+    POLICY_T&& /*policy*/, const graph<V, E, graph_type::DIRECTED>& graph) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_strongly_connected_components(graph);
+  } else {
+    return tarjans_strongly_connected_components(graph);
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <graaflib/execution_policy.h>
 #include <graaflib/graph.h>
 
 #include <optional>
@@ -18,5 +19,21 @@ template <typename V, typename E>
 [[nodiscard]] std::optional<std::vector<vertex_id_t>> dfs_topological_sort(
     const graph<V, E, graph_type::DIRECTED>& graph);
 
+/**
+ * @brief Calculates order of vertices in topological order with the given
+ * execution policy.
+ *
+ * With a parallel policy, the vertices are ordered with Kahn's algorithm,
+ * where all vertices whose predecessors are ordered are processed in parallel
+ * on the default_executor. The order is a valid topological order, but may
+ * differ from the one of the sequential algorithm.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see dfs_topological_sort
+ */
+template <execution_policy POLICY_T, typename V, typename E>
+[[nodiscard]] std::optional<std::vector<vertex_id_t>> dfs_topological_sort(
+    POLICY_T&& policy, const graph<V, E, graph_type::DIRECTED>& graph);
+
 }  // namespace graaf::algorithm
 #include "dfs_topological_sorting.tpp"
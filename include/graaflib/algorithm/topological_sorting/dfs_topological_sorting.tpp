@@ -1,8 +1,12 @@
 #pragma once
 
 #include <graaflib/algorithm/cycle_detection/dfs_cycle_detection.h>
+#include <graaflib/algorithm/dense_graph.h>
 #include <graaflib/algorithm/topological_sorting/dfs_topological_sorting.h>
+#include <graaflib/executor.h>
 
+#include <atomic>
+#include <mutex>
 #include <optional>
 #include <unordered_set>
 #include <vector>
@@ -53,4 +57,81 @@ std::optional<std::vector<vertex_id_t>> dfs_topological_sort(
   return sorted_vertices;
 }
 
+namespace detail {
+
+template <typename V, typename E>
+std::optional<std::vector<vertex_id_t>> parallel_topological_sort(
+    const graph<V, E, graph_type::DIRECTED>& graph) {
+  const auto dense_graph{make_dense_graph(graph)};
+  const auto vertex_count{dense_graph.vertex_count()};
+
+  std::vector<std::atomic<std::size_t>> in_degrees(vertex_count);
+  parallel_for(
+      default_executor(), 0, vertex_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto vertex{begin}; vertex < end; ++vertex) {
+          for (const auto neighbor : dense_graph.neighbors(vertex)) {
+            in_degrees[neighbor].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      },
+      {.grain_size = 256});
+
+  std::vector<std::size_t> frontier{};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    if (in_degrees[vertex].load(std::memory_order_relaxed) == 0) {
+      frontier.push_back(vertex);
+    }
+  }
+
+  std::vector<vertex_id_t> sorted_vertices{};
+  sorted_vertices.reserve(vertex_count);
+  while (!frontier.empty()) {
+    for (const auto vertex : frontier) {
+      sorted_vertices.push_back(dense_graph.vertex_id(vertex));
+    }
+
+    // The last predecessor to be ordered moves a vertex to the next frontier
+    std::mutex next_frontier_mutex{};
+    std::vector<std::size_t> next_frontier{};
+    parallel_for(
+        default_executor(), 0, frontier.size(),
+        [&](std::size_t begin, std::size_t end) {
+          std::vector<std::size_t> local_frontier{};
+          for (auto position{begin}; position < end; ++position) {
+            for (const auto neighbor :
+                 dense_graph.neighbors(frontier[position])) {
+              if (in_degrees[neighbor].fetch_sub(
+                      1, std::memory_order_acq_rel) == 1) {
+                local_frontier.push_back(neighbor);
+              }
+            }
+          }
+          const std::lock_guard lock{next_frontier_mutex};
+          next_frontier.insert(next_frontier.end(), local_frontier.begin(),
+                               local_frontier.end());
+        },
+        {.grain_size = 64});
+    frontier = std::move(next_frontier);
+  }
+
+  // Vertices on or behind a cycle never run out of predecessors
+  if (sorted_vertices.size() < vertex_count) {
+    return std::nullopt;
+  }
+  return sorted_vertices;
+}
+
+}  // namespace detail
+
+template <execution_policy POLICY_T, typename V, typename E>
+std::optional<std::vector<vertex_id_t>> dfs_topological_sort(
+    POLICY_T&& /*policy*/, const graph<V, E, graph_type::DIRECTED>& graph) {
+  if constexpr (graaf::detail::is_parallel_execution_policy_v<POLICY_T>) {
+    return detail::parallel_topological_sort(graph);
+  } else {
+    return dfs_topological_sort(graph);
+  }
+}
+
 };  // namespace graaf::algorithm
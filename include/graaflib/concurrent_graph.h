@@ -0,0 +1,204 @@
+#pragma once
+
+#include <graaflib/graph.h>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graaf {
+
+namespace detail {
+
+/**
+ * @brief Tracks which versions of a data structure readers may still access,
+ * such that retired versions can be reclaimed without reference counting.
+ *
+ * Writers advance a global epoch when they retire a version. A reader
+ * announces the epoch it started in by occupying one of a fixed number of
+ * slots for as long as it reads. A version retired in epoch e is unreachable
+ * once no slot holds an epoch of e or earlier.
+ */
+class epoch_domain {
+ public:
+  static constexpr std::uint64_t idle{
+      std::numeric_limits<std::uint64_t>::max()};
+
+  explicit epoch_domain(std::size_t slot_count);
+
+  // Occupies a slot with the current epoch. Waits while all slots are taken.
+  [[nodiscard]] std::size_t enter() noexcept;
+
+  void leave(std::size_t slot) noexcept;
+
+  // Advances the epoch, returns the epoch before advancing
+  std::uint64_t advance() noexcept;
+
+  // The earliest epoch any reader is in, idle if there are no readers
+  [[nodiscard]] std::uint64_t min_active_epoch() const noexcept;
+
+ private:
+  // Slots live on separate cache lines, readers on different cores do not
+  // invalidate each other's slot
+  struct alignas(64) reader_slot {
+    std::atomic<std::uint64_t> epoch{idle};
+  };
+
+  std::atomic<std::uint64_t> epoch_{0};
+  std::size_t slot_count_;
+  std::unique_ptr<reader_slot[]> slots_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Options of a concurrent_graph.
+ */
+struct concurrent_graph_options {
+  // The number of snapshots which can be held at the same time. Taking a
+  // snapshot while all are held waits until one is released.
+  std::size_t max_snapshots{256};
+};
+
+template <typename GRAPH_T>
+class concurrent_graph;
+
+/**
+ * @brief A pinned, immutable version of the graph of a concurrent_graph.
+ *
+ * As long as the snapshot is held, the version it refers to is not reclaimed,
+ * regardless of the updates published in the meantime. Snapshots are meant to
+ * be short-lived, a held snapshot delays the reclamation of all versions
+ * retired after it was taken. A snapshot must not outlive its
+ * concurrent_graph.
+ */
+template <typename GRAPH_T>
+class graph_snapshot {
+ public:
+  graph_snapshot(graph_snapshot&& other) noexcept;
+  graph_snapshot& operator=(graph_snapshot&& other) noexcept;
+  graph_snapshot(const graph_snapshot&) = delete;
+  graph_snapshot& operator=(const graph_snapshot&) = delete;
+
+  ~graph_snapshot();
+
+  [[nodiscard]] const GRAPH_T& get() const noexcept { return *graph_; }
+  [[nodiscard]] const GRAPH_T& operator*() const noexcept { return *graph_; }
+  [[nodiscard]] const GRAPH_T* operator->() const noexcept { return graph_; }
+
+ private:
+  friend class concurrent_graph<GRAPH_T>;
+
+  graph_snapshot(detail::epoch_domain& domain, std::size_t slot,
+                 const GRAPH_T* graph) noexcept
+      : domain_{&domain}, slot_{slot}, graph_{graph} {}
+
+  void release() noexcept;
+
+  detail::epoch_domain* domain_;
+  std::size_t slot_;
+  const GRAPH_T* graph_;
+};
+
+/**
+ * @brief A graph which is read by many threads while it is being updated.
+ *
+ * Readers take a snapshot of the current version of the graph, which takes
+ * neither a lock nor a reference count: reading never waits on a writer, and
+ * concurrent readers do not contend on a shared cache line. Writers create a
+ * new version by copying the current one and applying their mutations to the
+ * copy, then publish it atomically. Readers see either the complete update or
+ * none of it.
+ *
+ * Replaced versions are reclaimed once no snapshot of them is held anymore,
+ * which is tracked through epochs instead of per-snapshot reference counts.
+ *
+ * As every update copies the graph, updates should be batched: a single call
+ * to update may apply any number of mutations.
+ *
+ * @tparam GRAPH_T The type of the underlying graph.
+ */
+template <typename GRAPH_T>
+class concurrent_graph {
+ public:
+  using graph_t = GRAPH_T;
+  using snapshot_t = graph_snapshot<GRAPH_T>;
+
+  explicit concurrent_graph(graph_t graph = {},
+                            concurrent_graph_options options = {});
+
+  /**
+   * Reclaims all versions. No snapshots may be held anymore.
+   */
+  ~concurrent_graph();
+
+  concurrent_graph(const concurrent_graph&) = delete;
+  concurrent_graph& operator=(const concurrent_graph&) = delete;
+
+  /**
+   * Pin the current version of the graph. Safe to call from any thread.
+   *
+   * @return snapshot_t - The pinned version
+   */
+  [[nodiscard]] snapshot_t snapshot() const noexcept;
+
+  /**
+   * Apply mutations to a copy of the current version and publish it. Updates
+   * are serialized, but do not block readers. If the mutation throws, nothing
+   * is published.
+   *
+   * @param  mutation Invoked with a mutable reference to the new version
+   * @return A copy of the result of the mutation, e.g. the ID of an added
+   * vertex
+   */
+  template <typename MUTATION_T>
+    requires std::invocable<MUTATION_T&, GRAPH_T&>
+  auto update(MUTATION_T&& mutation);
+
+  /**
+   * Publish the given graph as the new version, replacing the current one.
+   *
+   * @param  graph The new version
+   */
+  void publish(graph_t graph);
+
+  /**
+   * Reclaim the retired versions which no snapshot refers to anymore. Updates
+   * do this as well, calling it is only needed to release memory when no
+   * further updates follow.
+   */
+  void collect();
+
+  /**
+   * @return size_t - The number of replaced versions which are not reclaimed
+   * yet, as snapshots may still refer to them
+   */
+  [[nodiscard]] std::size_t retired_count() const;
+
+ private:
+  struct retired_version {
+    std::uint64_t epoch;
+    std::unique_ptr<const graph_t> graph;
+  };
+
+  // Requires the writer mutex to be held
+  void publish_locked(std::unique_ptr<const graph_t> graph);
+  void collect_locked();
+
+  mutable detail::epoch_domain domain_;
+  std::atomic<const graph_t*> current_;
+
+  mutable std::mutex writer_mutex_{};
+  std::vector<retired_version> retired_{};
+};
+
+}  // namespace graaf
+
+#include "concurrent_graph.tpp"
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace graaf {
+
+namespace detail {
+
+inline epoch_domain::epoch_domain(std::size_t slot_count)
+    : slot_count_{std::max<std::size_t>(slot_count, 1)},
+      slots_{std::make_unique<reader_slot[]>(slot_count_)} {}
+
+inline std::size_t epoch_domain::enter() noexcept {
+  // Threads start searching at the slot they used last, so a thread usually
+  // finds a free slot at the first attempt and keeps it in its own cache
+  thread_local std::size_t slot_hint{
+      std::hash<std::thread::id>{}(std::this_thread::get_id())};
+
+  for (std::size_t attempt{0};; ++attempt) {
+    const auto slot{(slot_hint + attempt) % slot_count_};
+    // Reading the epoch before occupying the slot is what makes this safe: if
+    // a writer which retires a version does not see the slot occupied, then
+    // this reader is ordered after its publication and never sees the retired
+    // version.
+    const auto epoch{epoch_.load()};
+    auto expected{idle};
+    if (slots_[slot].epoch.compare_exchange_strong(expected, epoch)) {
+      slot_hint = slot;
+      return slot;
+    }
+    if ((attempt + 1) % slot_count_ == 0) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+inline void epoch_domain::leave(std::size_t slot) noexcept {
+  slots_[slot].epoch.store(idle, std::memory_order_release);
+}
+
+inline std::uint64_t epoch_domain::advance() noexcept {
+  return epoch_.fetch_add(1);
+}
+
+inline std::uint64_t epoch_domain::min_active_epoch() const noexcept {
+  auto min_epoch{idle};
+  for (std::size_t slot{0}; slot < slot_count_; ++slot) {
+    min_epoch = std::min(min_epoch, slots_[slot].epoch.load());
+  }
+  return min_epoch;
+}
+
+}  // namespace detail
+
+template <typename GRAPH_T>
+graph_snapshot<GRAPH_T>::graph_snapshot(graph_snapshot&& other) noexcept
+    : domain_{std::exchange(other.domain_, nullptr)},
+      slot_{other.slot_},
+      graph_{other.graph_} {}
+
+template <typename GRAPH_T>
+graph_snapshot<GRAPH_T>& graph_snapshot<GRAPH_T>::operator=(
+    graph_snapshot&& other) noexcept {
+  if (this != &other) {
+    release();
+    domain_ = std::exchange(other.domain_, nullptr);
+    slot_ = other.slot_;
+    graph_ = other.graph_;
+  }
+  return *this;
+}
+
+template <typename GRAPH_T>
+graph_snapshot<GRAPH_T>::~graph_snapshot() {
+  release();
+}
+
+template <typename GRAPH_T>
+void graph_snapshot<GRAPH_T>::release() noexcept {
+  if (domain_ != nullptr) {
+    domain_->leave(slot_);
+    domain_ = nullptr;
+  }
+}
+
+template <typename GRAPH_T>
+concurrent_graph<GRAPH_T>::concurrent_graph(graph_t graph,
+                                            concurrent_graph_options options)
+    : domain_{options.max_snapshots},
+      current_{new graph_t{std::move(graph)}} {}
+
+template <typename GRAPH_T>
+concurrent_graph<GRAPH_T>::~concurrent_graph() {
+  delete current_.load();
+}
+
+template <typename GRAPH_T>
+typename concurrent_graph<GRAPH_T>::snapshot_t
+concurrent_graph<GRAPH_T>::snapshot() const noexcept {
+  const auto slot{domain_.enter()};
+  return snapshot_t{domain_, slot, current_.load()};
+}
+
+template <typename GRAPH_T>
+template <typename MUTATION_T>
+  requires std::invocable<MUTATION_T&, GRAPH_T&>
+auto concurrent_graph<GRAPH_T>::update(MUTATION_T&& mutation) {
+  const std::lock_guard lock{writer_mutex_};
+  // Only writers replace the current version, and they hold the lock
+  auto next_version{std::make_unique<graph_t>(
+      *current_.load(std::memory_order_relaxed))};
+
+  if constexpr (std::is_void_v<std::invoke_result_t<MUTATION_T&, graph_t&>>) {
+    mutation(*next_version);
+    publish_locked(std::move(next_version));
+  } else {
+    auto result{mutation(*next_version)};
+    publish_locked(std::move(next_version));
+    return result;
+  }
+}
+
+template <typename GRAPH_T>
+void concurrent_graph<GRAPH_T>::publish(graph_t graph) {
+  auto next_version{std::make_unique<const graph_t>(std::move(graph))};
+  const std::lock_guard lock{writer_mutex_};
+  publish_locked(std::move(next_version));
+}
+
+template <typename GRAPH_T>
+void concurrent_graph<GRAPH_T>::collect() {
+  const std::lock_guard lock{writer_mutex_};
+  collect_locked();
+}
+
+template <typename GRAPH_T>
+std::size_t concurrent_graph<GRAPH_T>::retired_count() const {
+  const std::lock_guard lock{writer_mutex_};
+  return retired_.size();
+}
+
+template <typename GRAPH_T>
+void concurrent_graph<GRAPH_T>::publish_locked(
+    std::unique_ptr<const graph_t> graph) {
+  std::unique_ptr<const graph_t> previous_version{
+      current_.exchange(graph.release())};
+  // Readers which enter after this advance see the new version
+  const auto retired_epoch{domain_.advance()};
+  retired_.push_back({retired_epoch, std::move(previous_version)});
+  collect_locked();
+}
+
+template <typename GRAPH_T>
+void concurrent_graph<GRAPH_T>::collect_locked() {
+  const auto min_active_epoch{domain_.min_active_epoch()};
+  std::erase_if(retired_, [min_active_epoch](const auto& retired) {
+    return retired.epoch < min_active_epoch;
+  });
+}
+
+}  // namespace graaf
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <graaflib/executor.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace graaf {
+
+template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
+class csr_graph;
+
+namespace detail {
+
+/**
+ * Assembles a csr_graph in parallel on the executor.
+ *
+ * @param vertex_ids The ids of all vertices in ascending order
+ * @param vertex_of Returns a reference to the vertex with the given id
+ * @param for_each_adjacency Invokes its second argument with the id of every
+ * neighbor of the vertex with the given id and the edge to it. Called
+ * concurrently for different vertices.
+ * @param edge_count The number of edges of the graph
+ */
+template <typename V, typename E, graph_type T, typename VERTEX_FN_T,
+          typename ADJACENCY_FN_T>
+[[nodiscard]] csr_graph<V, E, T> assemble_csr_graph(
+    std::vector<vertex_id_t> vertex_ids, const VERTEX_FN_T& vertex_of,
+    const ADJACENCY_FN_T& for_each_adjacency, std::size_t edge_count,
+    executor& executor);
+
+}  // namespace detail
+
+/**
+ * @brief An immutable graph in compressed sparse row (CSR) format.
+ *
+ * Vertices are numbered densely from zero in the order of their ids. The
+ * neighbors of every vertex are stored contiguously and sorted by their
+ * index, as are the edges to them. Compared to graph, this takes far less
+ * memory, neighbors are read without copying or hashing, and whether an edge
+ * exists is found through binary search.
+ *
+ * In undirected graphs every edge is adjacent to both its vertices, so it is
+ * stored twice, except for self loops.
+ *
+ * @tparam VERTEX_T The vertex type of the graph.
+ * @tparam EDGE_T The edge type of the graph.
+ * @tparam GRAPH_TYPE_V The graph type (directed or undirected).
+ */
+template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
+class csr_graph {
+ public:
+  using vertex_t = VERTEX_T;
+  using edge_t = EDGE_T;
+
+  [[nodiscard]] constexpr bool is_directed() const {
+    return GRAPH_TYPE_V == graph_type::DIRECTED;
+  }
+
+  [[nodiscard]] constexpr bool is_undirected() const {
+    return GRAPH_TYPE_V == graph_type::UNDIRECTED;
+  }
+
+  [[nodiscard]] std::size_t vertex_count() const noexcept {
+    return vertex_ids_.size();
+  }
+
+  /**
+   * Query the number of edges, where undirected edges are counted once.
+   *
+   * @return size_t - Number of edges
+   */
+  [[nodiscard]] std::size_t edge_count() const noexcept { return edge_count_; }
+
+  /**
+   * @param  index The index of a vertex
+   * @return vertex_id_t - The id of the vertex in the graph it was created
+   * from
+   */
+  [[nodiscard]] vertex_id_t vertex_id(std::size_t index) const noexcept {
+    return vertex_ids_[index];
+  }
+
+  /**
+   * @param  vertex_id The id of a vertex
+   * @return size_t - The index of the vertex
+   * @throws out_of_range - If there is no vertex with the given id
+   */
+  [[nodiscard]] std::size_t index(vertex_id_t vertex_id) const {
+    return indices_.at(vertex_id);
+  }
+
+  [[nodiscard]] bool has_vertex(vertex_id_t vertex_id) const noexcept {
+    return indices_.contains(vertex_id);
+  }
+
+  [[nodiscard]] const vertex_t& get_vertex(std::size_t index) const noexcept {
+    return vertices_[index];
+  }
+
+  [[nodiscard]] std::size_t degree(std::size_t index) const noexcept {
+    return offsets_[index + 1] - offsets_[index];
+  }
+
+  /**
+   * @param  index The index of a vertex
+   * @return The indices of the neighbors of the vertex in ascending order
+   */
+  [[nodiscard]] std::span<const std::size_t> neighbors(
+      std::size_t index) const noexcept {
+    return {targets_.data() + offsets_[index], degree(index)};
+  }
+
+  /**
+   * @param  index The index of a vertex
+   * @return The edges to the neighbors, in the same order as the neighbors
+   */
+  [[nodiscard]] std::span<const edge_t> edges(
+      std::size_t index) const noexcept {
+    return {edges_.data() + offsets_[index], degree(index)};
+  }
+
+  /**
+   * Checks whether there is an edge from one vertex to another.
+   *
+   * @param  index_lhs The index of the first vertex
+   * @param  index_rhs The index of the second vertex
+   * @return boolean - True if there is an edge between the vertices
+   */
+  [[nodiscard]] bool has_edge(std::size_t index_lhs,
+                              std::size_t index_rhs) const noexcept;
+
+ private:
+  template <typename V, typename E, graph_type T, typename VERTEX_FN_T,
+            typename ADJACENCY_FN_T>
+  friend csr_graph<V, E, T> detail::assemble_csr_graph(
+      std::vector<vertex_id_t> vertex_ids, const VERTEX_FN_T& vertex_of,
+      const ADJACENCY_FN_T& for_each_adjacency, std::size_t edge_count,
+      executor& executor);
+
+  csr_graph() = default;
+
+  std::vector<vertex_id_t> vertex_ids_{};
+  std::unordered_map<vertex_id_t, std::size_t> indices_{};
+  std::vector<vertex_t> vertices_{};
+  std::vector<std::size_t> offsets_{};
+  std::vector<std::size_t> targets_{};
+  std::vector<edge_t> edges_{};
+  std::size_t edge_count_{0};
+};
+
+/**
+ * @brief Creates a csr_graph containing the vertices and edges of the graph.
+ * The adjacency lists are sorted in parallel on the default_executor.
+ *
+ * @param  graph The graph to convert
+ * @return csr_graph - The graph in compressed sparse row format
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] csr_graph<V, E, T> make_csr_graph(const graph<V, E, T>& graph);
+
+}  // namespace graaf
+
+#include "csr_graph.tpp"
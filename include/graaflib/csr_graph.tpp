@@ -0,0 +1,120 @@
+#pragma once
+
+#include <graaflib/algorithm/dense_graph.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace graaf {
+
+namespace detail {
+
+template <typename V, typename E, graph_type T, typename VERTEX_FN_T,
+          typename ADJACENCY_FN_T>
+csr_graph<V, E, T> assemble_csr_graph(std::vector<vertex_id_t> vertex_ids,
+                                      const VERTEX_FN_T& vertex_of,
+                                      const ADJACENCY_FN_T& for_each_adjacency,
+                                      std::size_t edge_count,
+                                      executor& executor) {
+  csr_graph<V, E, T> csr{};
+  const auto vertex_count{vertex_ids.size()};
+
+  csr.indices_.reserve(vertex_count);
+  for (std::size_t index{0}; index < vertex_count; ++index) {
+    csr.indices_.emplace(vertex_ids[index], index);
+  }
+
+  csr.offsets_.assign(vertex_count + 1, 0);
+  parallel_for(
+      executor, 0, vertex_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto index{begin}; index < end; ++index) {
+          std::size_t degree{0};
+          for_each_adjacency(vertex_ids[index],
+                             [&degree](vertex_id_t /*target*/,
+                                       const E& /*edge*/) { ++degree; });
+          csr.offsets_[index + 1] = degree;
+        }
+      },
+      {.grain_size = 256});
+  for (std::size_t index{0}; index < vertex_count; ++index) {
+    csr.offsets_[index + 1] += csr.offsets_[index];
+  }
+
+  // The edges are copied in a sequential pass afterwards, such that they need
+  // not be default constructible
+  csr.targets_.resize(csr.offsets_.back());
+  std::vector<const E*> edge_pointers(csr.offsets_.back());
+  parallel_for(
+      executor, 0, vertex_count,
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<std::pair<std::size_t, const E*>> row{};
+        for (auto index{begin}; index < end; ++index) {
+          row.clear();
+          for_each_adjacency(vertex_ids[index],
+                             [&row, &csr](vertex_id_t target, const E& edge) {
+                               row.emplace_back(csr.indices_.at(target), &edge);
+                             });
+          std::ranges::sort(row, {}, &std::pair<std::size_t, const E*>::first);
+
+          auto slot{csr.offsets_[index]};
+          for (const auto& [target, edge] : row) {
+            csr.targets_[slot] = target;
+            edge_pointers[slot] = edge;
+            ++slot;
+          }
+        }
+      },
+      {.grain_size = 256});
+
+  csr.vertices_.reserve(vertex_count);
+  for (const auto vertex_id : vertex_ids) {
+    csr.vertices_.push_back(vertex_of(vertex_id));
+  }
+  csr.edges_.reserve(edge_pointers.size());
+  for (const auto* edge : edge_pointers) {
+    csr.edges_.push_back(*edge);
+  }
+
+  csr.vertex_ids_ = std::move(vertex_ids);
+  csr.edge_count_ = edge_count;
+  return csr;
+}
+
+}  // namespace detail
+
+template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
+bool csr_graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::has_edge(
+    std::size_t index_lhs, std::size_t index_rhs) const noexcept {
+  return std::ranges::binary_search(neighbors(index_lhs), index_rhs);
+}
+
+template <typename V, typename E, graph_type T>
+csr_graph<V, E, T> make_csr_graph(const graph<V, E, T>& graph) {
+  const auto dense_graph{algorithm::detail::make_dense_graph(graph)};
+
+  std::vector<vertex_id_t> vertex_ids{};
+  vertex_ids.reserve(graph.vertex_count());
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    vertex_ids.push_back(vertex_id);
+  }
+  std::ranges::sort(vertex_ids);
+
+  return detail::assemble_csr_graph<V, E, T>(
+      std::move(vertex_ids),
+      [&graph](vertex_id_t vertex_id) -> const V& {
+        return graph.get_vertex(vertex_id);
+      },
+      [&dense_graph](vertex_id_t vertex_id, const auto& callback) {
+        const auto index{dense_graph.index(vertex_id)};
+        const auto neighbors{dense_graph.neighbors(index)};
+        const auto edges{dense_graph.edges(index)};
+        for (std::size_t position{0}; position < neighbors.size(); ++position) {
+          callback(dense_graph.vertex_id(neighbors[position]),
+                   *edges[position]);
+        }
+      },
+      graph.edge_count(), default_executor());
+}
+
+}  // namespace graaf
@@ -42,6 +42,18 @@ template <typename EDGE_T>
 template <typename EDGE_T>
 [[nodiscard]] int get_weight(const EDGE_T& /*edge*/);
 
+namespace detail {
+
+/**
+ * @brief Edge types which carry a weight, see graaf::get_weight. Edges of other
+ * types have a weight of 1.
+ */
+template <typename EDGE_T>
+concept has_edge_weight =
+    std::is_arithmetic_v<EDGE_T> || derived_from_weighted_edge<EDGE_T>;
+
+}  // namespace detail
+
 }  // namespace graaf
 
 #include "edge.tpp"
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <type_traits>
+
+#ifdef GRAAF_USE_STD_EXECUTION_POLICIES
+#include <execution>
+#endif
+
+namespace graaf {
+
+/**
+ * Execution policies which select between the sequential and the parallel
+ * overloads of the algorithms, mirroring those of std::execution.
+ *
+ * The standard policies are only accepted when GRAAF_USE_STD_EXECUTION_POLICIES
+ * is defined. Including <execution> makes some standard libraries depend on
+ * TBB at link time, which the library does not want to impose on all users.
+ */
+namespace execution {
+
+class sequenced_policy {};
+class parallel_policy {};
+class parallel_unsequenced_policy {};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+}  // namespace execution
+
+namespace detail {
+
+template <typename T>
+struct execution_policy_traits {
+  static constexpr bool is_policy{false};
+  static constexpr bool is_parallel{false};
+};
+
+template <>
+struct execution_policy_traits<execution::sequenced_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{false};
+};
+
+template <>
+struct execution_policy_traits<execution::parallel_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{true};
+};
+
+template <>
+struct execution_policy_traits<execution::parallel_unsequenced_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{true};
+};
+
+#ifdef GRAAF_USE_STD_EXECUTION_POLICIES
+template <>
+struct execution_policy_traits<std::execution::sequenced_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{false};
+};
+
+template <>
+struct execution_policy_traits<std::execution::unsequenced_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{false};
+};
+
+template <>
+struct execution_policy_traits<std::execution::parallel_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{true};
+};
+
+template <>
+struct execution_policy_traits<std::execution::parallel_unsequenced_policy> {
+  static constexpr bool is_policy{true};
+  static constexpr bool is_parallel{true};
+};
+#endif
+
+/**
+ * Whether the policy requests a parallel implementation. Unsequenced policies
+ * are treated as their sequenced counterparts, since the algorithms invoke
+ * user callbacks which may not be safe to interleave on a single thread.
+ */
+template <typename POLICY_T>
+inline constexpr bool is_parallel_execution_policy_v{
+    execution_policy_traits<std::remove_cvref_t<POLICY_T>>::is_parallel};
+
+}  // namespace detail
+
+/**
+ * @brief One of the execution policies of graaf::execution, or of
+ * std::execution when GRAAF_USE_STD_EXECUTION_POLICIES is defined.
+ */
+template <typename T>
+concept execution_policy =
+    detail::execution_policy_traits<std::remove_cvref_t<T>>::is_policy;
+
+}  // namespace graaf
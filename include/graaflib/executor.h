@@ -0,0 +1,204 @@
+#pragma once
+
+#include <graaflib/execution_policy.h>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace graaf {
+
+/**
+ * @brief Runs the tasks of the parallel functionality of the library.
+ *
+ * Implement this interface to run the work of the library on a thread pool
+ * owned by the application, and pass it in the options of a function or
+ * install it with set_default_executor.
+ */
+class executor {
+ public:
+  virtual ~executor() = default;
+
+  /**
+   * Schedules a task, which may run on any thread, including the calling one.
+   * Tasks submitted by the library do not throw and do not block on other
+   * tasks, but they may submit further tasks.
+   */
+  virtual void execute(std::function<void()> task) = 0;
+
+  /**
+   * The number of tasks the executor runs in parallel. The library splits its
+   * work in at most this many concurrent tasks, the calling thread included.
+   */
+  [[nodiscard]] virtual std::size_t concurrency() const noexcept = 0;
+};
+
+/**
+ * @brief An executor which runs every task on the calling thread.
+ */
+class inline_executor final : public executor {
+ public:
+  void execute(std::function<void()> task) override { task(); }
+
+  [[nodiscard]] std::size_t concurrency() const noexcept override { return 1; }
+};
+
+/**
+ * @brief Options of the thread_pool_executor.
+ */
+struct thread_pool_options {
+  std::size_t thread_count{std::max(1U, std::thread::hardware_concurrency())};
+
+  // Pins worker i to CPU i, modulo the number of CPUs. Keeping workers on a
+  // fixed CPU, and hence NUMA node, keeps the memory they touch local. Only
+  // supported on Linux, ignored elsewhere.
+  bool pin_threads{false};
+};
+
+/**
+ * @brief A work stealing thread pool.
+ *
+ * Every worker owns a deque of tasks. Tasks submitted from a worker are pushed
+ * to the back of its own deque, other tasks are distributed round robin. A
+ * worker takes tasks from the back of its own deque, such that recently
+ * submitted tasks run while their data is still in cache, and steals from the
+ * front of the deques of other workers when its own deque is empty.
+ *
+ * The destructor runs all submitted tasks before joining the workers.
+ */
+class thread_pool_executor final : public executor {
+ public:
+  explicit thread_pool_executor(thread_pool_options options = {});
+  ~thread_pool_executor() override;
+
+  thread_pool_executor(const thread_pool_executor&) = delete;
+  thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+  void execute(std::function<void()> task) override;
+
+  [[nodiscard]] std::size_t concurrency() const noexcept override {
+    return workers_.size();
+  }
+
+ private:
+  struct task_deque {
+    std::mutex mutex{};
+    std::deque<std::function<void()>> tasks{};
+  };
+
+  void run_worker(std::size_t worker_index);
+  [[nodiscard]] bool try_take_task(std::size_t worker_index,
+                                   std::function<void()>& task);
+
+  std::vector<std::unique_ptr<task_deque>> task_deques_{};
+  std::atomic<std::size_t> next_deque_{0};
+
+  // The number of submitted tasks which no worker has reserved yet
+  std::mutex pending_mutex_{};
+  std::condition_variable pending_condition_{};
+  std::size_t pending_task_count_{0};
+  bool stopping_{false};
+
+  std::vector<std::thread> workers_{};
+};
+
+/**
+ * @brief The executor used when no executor is passed to a function.
+ *
+ * Unless another executor is installed, this is a thread_pool_executor with a
+ * thread per CPU, which is created on first use.
+ */
+[[nodiscard]] inline executor& default_executor();
+
+/**
+ * @brief Replaces the default executor, e.g. by a pool of the application such
+ * that the library does not spawn threads of its own. Passing nullptr restores
+ * the built-in thread pool. The executor must outlive its use by the library.
+ */
+inline void set_default_executor(executor* executor) noexcept;
+
+/**
+ * @brief Options of parallel_for.
+ */
+struct parallel_for_options {
+  // The smallest number of indices handed to the function in one call
+  std::size_t grain_size{1};
+
+  // Upper bound on the number of concurrent calls, the calling thread included
+  std::size_t max_concurrency{std::numeric_limits<std::size_t>::max()};
+};
+
+/**
+ * @brief Calls the function on disjoint subranges which together cover [begin,
+ * end), in parallel on the executor.
+ *
+ * The calling thread takes part in the work. Subranges are claimed with guided
+ * self-scheduling: every claim takes a share of the remaining indices which
+ * shrinks as the range is consumed, but is at least the grain size. Large
+ * ranges hence start with large subranges, which keeps the scheduling overhead
+ * low, and finish with small ones, which balances uneven work.
+ *
+ * @param executor The executor to run the function on.
+ * @param begin The first index.
+ * @param end One past the last index.
+ * @param function Callable accepting the begin and end of a subrange.
+ * @param options The grain size and the maximum concurrency.
+ * @throws Rethrows the first exception thrown by the function, after all
+ * ongoing calls have finished. Subranges which are not started by then are
+ * skipped.
+ */
+template <typename FUNCTION_T>
+  requires std::invocable<const FUNCTION_T&, std::size_t, std::size_t>
+void parallel_for(executor& executor, std::size_t begin, std::size_t end,
+                  const FUNCTION_T& function,
+                  const parallel_for_options& options = {});
+
+/**
+ * @brief Calls the function on every element of a random access range, such
+ * as a vector of vertex ids or edges, in parallel on the executor.
+ *
+ * @see parallel_for
+ */
+template <std::ranges::random_access_range RANGE_T, typename FUNCTION_T>
+  requires std::invocable<const FUNCTION_T&,
+                          std::ranges::range_reference_t<RANGE_T>>
+void parallel_for_each(executor& executor, RANGE_T&& range,
+                       const FUNCTION_T& function,
+                       const parallel_for_options& options = {});
+
+namespace detail {
+
+/**
+ * @brief The executor to run parallel work with thread_count threads on.
+ *
+ * @return The given executor if any, otherwise the default executor. If a
+ * single thread is requested and no executor is given, an inline executor is
+ * returned, which avoids creating the built-in thread pool.
+ */
+[[nodiscard]] inline executor& select_executor(executor* executor,
+                                               std::size_t thread_count);
+
+/**
+ * @brief The executor to run the parallel overload of an algorithm on.
+ *
+ * @return The default executor for a parallel policy, otherwise an inline
+ * executor on the calling thread.
+ */
+template <typename POLICY_T>
+[[nodiscard]] executor& policy_executor();
+
+}  // namespace detail
+
+}  // namespace graaf
+
+#include "executor.tpp"
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <exception>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace graaf {
+
+namespace detail {
+
+// The pool and index of the worker running on the current thread, if any
+struct current_worker {
+  const void* pool{nullptr};
+  std::size_t index{0};
+};
+
+inline thread_local current_worker this_thread_worker{};
+
+inline std::atomic<executor*> installed_default_executor{nullptr};
+
+#ifdef __linux__
+inline void pin_to_cpu(std::thread& thread, std::size_t worker_index) {
+  const auto cpu_count{std::max(1U, std::thread::hardware_concurrency())};
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(worker_index % cpu_count, &cpu_set);
+  // Pinning is an optimization, a failure is not an error
+  [[maybe_unused]] const auto result{pthread_setaffinity_np(
+      thread.native_handle(), sizeof(cpu_set_t), &cpu_set)};
+}
+#else
+inline void pin_to_cpu(std::thread& /*thread*/,
+                       std::size_t /*worker_index*/) {}
+#endif
+
+}  // namespace detail
+
+inline thread_pool_executor::thread_pool_executor(thread_pool_options options) {
+  const auto thread_count{std::max<std::size_t>(options.thread_count, 1)};
+
+  task_deques_.reserve(thread_count);
+  for (std::size_t worker_index{0}; worker_index < thread_count;
+       ++worker_index) {
+    task_deques_.push_back(std::make_unique<task_deque>());
+  }
+
+  workers_.reserve(thread_count);
+  for (std::size_t worker_index{0}; worker_index < thread_count;
+       ++worker_index) {
+    workers_.emplace_back(
+        [this, worker_index]() { run_worker(worker_index); });
+    if (options.pin_threads) {
+      detail::pin_to_cpu(workers_.back(), worker_index);
+    }
+  }
+}
+
+inline thread_pool_executor::~thread_pool_executor() {
+  {
+    const std::lock_guard lock{pending_mutex_};
+    stopping_ = true;
+  }
+  pending_condition_.notify_all();
+
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+inline void thread_pool_executor::execute(std::function<void()> task) {
+  const auto& current_worker{detail::this_thread_worker};
+  const auto deque_index{
+      current_worker.pool == this
+          ? current_worker.index
+          : next_deque_.fetch_add(1, std::memory_order_relaxed) %
+                task_deques_.size()};
+
+  {
+    auto& deque{*task_deques_[deque_index]};
+    const std::lock_guard lock{deque.mutex};
+    deque.tasks.push_back(std::move(task));
+  }
+
+  {
+    const std::lock_guard lock{pending_mutex_};
+    ++pending_task_count_;
+  }
+  pending_condition_.notify_one();
+}
+
+inline bool thread_pool_executor::try_take_task(std::size_t worker_index,
+                                                std::function<void()>& task) {
+  {
+    auto& own_deque{*task_deques_[worker_index]};
+    const std::lock_guard lock{own_deque.mutex};
+    if (!own_deque.tasks.empty()) {
+      task = std::move(own_deque.tasks.back());
+      own_deque.tasks.pop_back();
+      return true;
+    }
+  }
+
+  for (std::size_t offset{1}; offset < task_deques_.size(); ++offset) {
+    auto& victim_deque{
+        *task_deques_[(worker_index + offset) % task_deques_.size()]};
+    const std::lock_guard lock{victim_deque.mutex};
+    if (!victim_deque.tasks.empty()) {
+      task = std::move(victim_deque.tasks.front());
+      victim_deque.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+inline void thread_pool_executor::run_worker(std::size_t worker_index) {
+  detail::this_thread_worker = {this, worker_index};
+
+  while (true) {
+    {
+      std::unique_lock lock{pending_mutex_};
+      pending_condition_.wait(
+          lock, [this]() { return pending_task_count_ > 0 || stopping_; });
+      if (pending_task_count_ == 0) {
+        // Stopping, and all tasks have run
+        return;
+      }
+      --pending_task_count_;
+    }
+
+    // Every reservation is backed by a task in one of the deques, although
+    // another worker may take the one which triggered this reservation
+    std::function<void()> task{};
+    while (!try_take_task(worker_index, task)) {
+      std::this_thread::yield();
+    }
+    task();
+  }
+}
+
+inline executor& default_executor() {
+  if (auto* const installed{
+          detail::installed_default_executor.load(std::memory_order_acquire)}) {
+    return *installed;
+  }
+  static thread_pool_executor built_in_executor{};
+  return built_in_executor;
+}
+
+inline void set_default_executor(executor* executor) noexcept {
+  detail::installed_default_executor.store(executor,
+                                           std::memory_order_release);
+}
+
+namespace detail {
+
+inline executor& select_executor(executor* executor,
+                                 std::size_t thread_count) {
+  if (executor != nullptr) {
+    return *executor;
+  }
+  if (thread_count <= 1) {
+    static inline_executor calling_thread_executor{};
+    return calling_thread_executor;
+  }
+  return default_executor();
+}
+
+template <typename POLICY_T>
+executor& policy_executor() {
+  if constexpr (is_parallel_execution_policy_v<POLICY_T>) {
+    return default_executor();
+  } else {
+    return select_executor(nullptr, 1);
+  }
+}
+
+/**
+ * The state of a parallel_for which is shared with its tasks. Tasks may start
+ * after all indices have been claimed and the parallel_for has returned, hence
+ * they share ownership of the state.
+ */
+struct parallel_for_state {
+  parallel_for_state(std::size_t begin, std::size_t end, std::size_t grain_size,
+                     std::size_t concurrency)
+      : next{begin},
+        end{end},
+        grain_size{grain_size},
+        concurrency{concurrency},
+        remaining{end - begin} {}
+
+  std::atomic<std::size_t> next;
+  const std::size_t end;
+  const std::size_t grain_size;
+  const std::size_t concurrency;
+
+  std::mutex mutex{};
+  std::condition_variable finished{};
+  // Indices which were not processed or skipped yet
+  std::size_t remaining;
+  std::exception_ptr exception{};
+  std::atomic<bool> failed{false};
+
+  // Claims the next subrange, returns false when all indices are claimed
+  bool claim(std::size_t& subrange_begin, std::size_t& subrange_end) {
+    auto current{next.load(std::memory_order_relaxed)};
+    while (current < end) {
+      const auto unclaimed{end - current};
+      const auto size{std::min(
+          unclaimed, std::max(grain_size, unclaimed / (2 * concurrency)))};
+      if (next.compare_exchange_weak(current, current + size,
+                                     std::memory_order_relaxed)) {
+        subrange_begin = current;
+        subrange_end = current + size;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename FUNCTION_T>
+  void run(const FUNCTION_T& function) {
+    std::size_t subrange_begin{0};
+    std::size_t subrange_end{0};
+    while (claim(subrange_begin, subrange_end)) {
+      if (!failed.load(std::memory_order_relaxed)) {
+        try {
+          function(subrange_begin, subrange_end);
+        } catch (...) {
+          const std::lock_guard lock{mutex};
+          if (!exception) {
+            exception = std::current_exception();
+          }
+          failed.store(true, std::memory_order_relaxed);
+        }
+      }
+
+      const std::lock_guard lock{mutex};
+      remaining -= subrange_end - subrange_begin;
+      if (remaining == 0) {
+        finished.notify_all();
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename FUNCTION_T>
+  requires std::invocable<const FUNCTION_T&, std::size_t, std::size_t>
+void parallel_for(executor& executor, std::size_t begin, std::size_t end,
+                  const FUNCTION_T& function,
+                  const parallel_for_options& options) {
+  if (begin >= end) {
+    return;
+  }
+
+  const auto grain_size{std::max<std::size_t>(options.grain_size, 1)};
+  const auto subrange_count{(end - begin + grain_size - 1) / grain_size};
+  const auto concurrency{std::max<std::size_t>(
+      1, std::min({executor.concurrency(), options.max_concurrency,
+                   subrange_count}))};
+
+  if (concurrency == 1) {
+    function(begin, end);
+    return;
+  }
+
+  const auto state{std::make_shared<detail::parallel_for_state>(
+      begin, end, grain_size, concurrency)};
+
+  // A task only calls the function when it claims a subrange. Until that
+  // subrange is processed, this function does not return, so the function
+  // outlives all calls to it.
+  for (std::size_t task{1}; task < concurrency; ++task) {
+    executor.execute([state, &function]() { state->run(function); });
+  }
+  state->run(function);
+
+  std::unique_lock lock{state->mutex};
+  state->finished.wait(lock, [&state]() { return state->remaining == 0; });
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+template <std::ranges::random_access_range RANGE_T, typename FUNCTION_T>
+  requires std::invocable<const FUNCTION_T&,
+                          std::ranges::range_reference_t<RANGE_T>>
+void parallel_for_each(executor& executor, RANGE_T&& range,
+                       const FUNCTION_T& function,
+                       const parallel_for_options& options) {
+  const auto first{std::ranges::begin(range)};
+  parallel_for(
+      executor, 0, static_cast<std::size_t>(std::ranges::distance(range)),
+      [first, &function](std::size_t begin, std::size_t end) {
+        for (auto index{begin}; index < end; ++index) {
+          function(first[static_cast<std::ptrdiff_t>(index)]);
+        }
+      },
+      options);
+}
+
+}  // namespace graaf
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <graaflib/generators/common.h>
+#include <graaflib/graph.h>
+
+#include <concepts>
+#include <cstddef>
+
+namespace graaf::generators {
+
+/**
+ * @brief Generates a Barabási–Albert preferential attachment graph, which has a
+ * scale-free degree distribution.
+ *
+ * Starting from edges_per_vertex vertices without edges, every new vertex is
+ * connected to edges_per_vertex distinct existing vertices, chosen with a
+ * probability proportional to their degree. In a directed graph, edges point
+ * from the new vertex to the existing vertices. Since every vertex depends on
+ * all earlier ones, the graph is generated on the calling thread.
+ *
+ * @tparam V The vertex type of the graph, vertices are default constructed.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @param vertex_count The number of vertices.
+ * @param edges_per_vertex The number of edges added with every new vertex.
+ * @param options The seed and edge weight range.
+ * @return graph<V, E, T> The generated graph, vertex ids are [0, n).
+ * @throws invalid_argument - If edges_per_vertex is zero or not smaller than
+ * the number of vertices.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+[[nodiscard]] graph<V, E, T> barabasi_albert(
+    std::size_t vertex_count, std::size_t edges_per_vertex,
+    const generator_options& options = {});
+
+}  // namespace graaf::generators
+
+#include "barabasi_albert.tpp"
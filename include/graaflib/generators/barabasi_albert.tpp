@@ -0,0 +1,60 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace graaf::generators {
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+graph<V, E, T> barabasi_albert(std::size_t vertex_count,
+                               std::size_t edges_per_vertex,
+                               const generator_options& options) {
+  if (edges_per_vertex == 0 || edges_per_vertex >= vertex_count) {
+    throw std::invalid_argument{
+        "The number of edges per vertex must be positive and smaller than "
+        "the number of vertices."};
+  }
+
+  splitmix64 rng{detail::chunk_seed(options.seed, 0)};
+  const auto new_vertex_count{vertex_count - edges_per_vertex};
+  std::vector<detail::generated_edge<E>> edges{};
+  edges.reserve(new_vertex_count * edges_per_vertex);
+
+  // Every vertex occurs once per incident edge, so a uniform draw from this
+  // list picks vertices proportionally to their degree
+  std::vector<std::size_t> degree_weighted_vertices{};
+  degree_weighted_vertices.reserve(2 * new_vertex_count * edges_per_vertex);
+
+  // The first new vertex connects to all initial vertices
+  std::vector<std::size_t> targets(edges_per_vertex);
+  std::iota(targets.begin(), targets.end(), std::size_t{0});
+
+  for (auto vertex_index{edges_per_vertex}; vertex_index < vertex_count;
+       ++vertex_index) {
+    for (const auto target : targets) {
+      edges.push_back(
+          {vertex_index, target, detail::make_edge<E>(rng, options)});
+      degree_weighted_vertices.push_back(target);
+      degree_weighted_vertices.push_back(vertex_index);
+    }
+
+    if (vertex_index + 1 == vertex_count) {
+      break;
+    }
+    targets.clear();
+    while (targets.size() < edges_per_vertex) {
+      const auto target{degree_weighted_vertices[detail::uniform_index(
+          rng, degree_weighted_vertices.size())]};
+      if (std::ranges::find(targets, target) == targets.end()) {
+        targets.push_back(target);
+      }
+    }
+  }
+
+  return detail::build_graph<V, E, T>(vertex_count, std::move(edges));
+}
+
+}  // namespace graaf::generators
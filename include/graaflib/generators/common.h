@@ -0,0 +1,133 @@
+#pragma once
+
+#include <graaflib/executor.h>
+#include <graaflib/graph.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace graaf::generators {
+
+/**
+ * @brief Options shared by all graph generators.
+ */
+struct generator_options {
+  // Generating the same graph with the same seed yields the same graph,
+  // regardless of the number of threads.
+  std::uint64_t seed{0};
+
+  // Number of threads used to generate edges. Not all generators parallelize.
+  std::size_t thread_count{std::max(1U, std::thread::hardware_concurrency())};
+
+  // Executor to generate edges on, if null the default_executor is used when
+  // thread_count is larger than one.
+  graaf::executor* executor{nullptr};
+
+  // Edge weights are drawn uniformly from [min_weight, max_weight]. Edges
+  // which are neither arithmetic nor derived from weighted_edge are default
+  // constructed.
+  double min_weight{1};
+  double max_weight{1};
+};
+
+/**
+ * @brief The SplitMix64 pseudo random number generator.
+ *
+ * It is fast, has a small state and, in contrast to the distributions of the
+ * standard library, the numbers derived from it are the same on all platforms.
+ * Satisfies std::uniform_random_bit_generator.
+ */
+class splitmix64 {
+ public:
+  using result_type = std::uint64_t;
+
+  explicit constexpr splitmix64(std::uint64_t seed) noexcept : state_{seed} {}
+
+  [[nodiscard]] static constexpr result_type min() noexcept {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  [[nodiscard]] static constexpr result_type max() noexcept {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  constexpr result_type operator()() noexcept {
+    std::uint64_t z{state_ += 0x9E3779B97F4A7C15};
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    return z ^ (z >> 31);
+  }
+
+ private:
+  std::uint64_t state_;
+};
+
+namespace detail {
+
+/**
+ * @brief An edge produced by a generator, between the vertices with the given
+ * indices.
+ */
+template <typename EDGE_T>
+struct generated_edge {
+  std::size_t vertex_index_lhs;
+  std::size_t vertex_index_rhs;
+  EDGE_T edge;
+};
+
+/**
+ * @brief Draws a number uniformly from [0, 1).
+ */
+[[nodiscard]] inline double uniform_real(splitmix64& rng) noexcept;
+
+/**
+ * @brief Draws an index uniformly from [0, count).
+ */
+[[nodiscard]] inline std::size_t uniform_index(splitmix64& rng,
+                                               std::size_t count) noexcept;
+
+/**
+ * @brief Creates an edge with a weight drawn from the weight range of the
+ * options.
+ */
+template <typename EDGE_T>
+[[nodiscard]] EDGE_T make_edge(splitmix64& rng,
+                               const generator_options& options);
+
+/**
+ * @brief Generates edges in independent chunks, which are distributed over at
+ * most options.thread_count tasks on the executor of the options.
+ *
+ * Each chunk is generated with its own random number generator, seeded from
+ * the seed of the options and the index of the chunk. The edges are returned
+ * in chunk order, so the result does not depend on the number of threads.
+ *
+ * @param chunk_count The number of chunks.
+ * @param options The generator options.
+ * @param generate_chunk Callable accepting the chunk index, a splitmix64& and a
+ * std::vector<generated_edge<EDGE_T>>& to append the edges of the chunk to.
+ * @return The edges of all chunks.
+ */
+template <typename EDGE_T, typename CHUNK_GENERATOR_T>
+[[nodiscard]] std::vector<generated_edge<EDGE_T>> generate_in_chunks(
+    std::size_t chunk_count, const generator_options& options,
+    const CHUNK_GENERATOR_T& generate_chunk);
+
+/**
+ * @brief Builds a graph with the given number of default constructed vertices
+ * and the generated edges. The vertex ids equal the vertex indices.
+ */
+template <typename V, typename E, graph_type T>
+[[nodiscard]] graph<V, E, T> build_graph(
+    std::size_t vertex_count, std::vector<generated_edge<E>>&& edges);
+
+}  // namespace detail
+
+}  // namespace graaf::generators
+
+#include "common.tpp"
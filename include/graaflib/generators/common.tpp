@@ -0,0 +1,144 @@
+#pragma once
+
+#include <graaflib/graph_builder.h>
+
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace graaf::generators {
+
+namespace detail {
+
+/**
+ * @brief The upper 64 bits of the 128 bit product of two numbers.
+ */
+[[nodiscard]] constexpr std::uint64_t multiply_high(std::uint64_t lhs,
+                                                    std::uint64_t rhs) {
+  constexpr std::uint64_t low_mask{0xFFFFFFFF};
+  const auto lhs_low{lhs & low_mask};
+  const auto lhs_high{lhs >> 32};
+  const auto rhs_low{rhs & low_mask};
+  const auto rhs_high{rhs >> 32};
+
+  const auto low_low{lhs_low * rhs_low};
+  const auto low_high{lhs_low * rhs_high};
+  const auto high_low{lhs_high * rhs_low};
+  const auto high_high{lhs_high * rhs_high};
+
+  const auto carry{((low_low >> 32) + (low_high & low_mask) +
+                    (high_low & low_mask)) >>
+                   32};
+  return high_high + (low_high >> 32) + (high_low >> 32) + carry;
+}
+
+/**
+ * @brief Derives an independent seed for every chunk of a generator.
+ */
+[[nodiscard]] constexpr std::uint64_t chunk_seed(std::uint64_t seed,
+                                                 std::size_t chunk_index) {
+  splitmix64 rng{seed ^ splitmix64{chunk_index}()};
+  return rng();
+}
+
+inline double uniform_real(splitmix64& rng) noexcept {
+  // The upper 53 bits fill the mantissa of a double
+  return static_cast<double>(rng() >> 11) * 0x1.0p-53;
+}
+
+inline std::size_t uniform_index(splitmix64& rng, std::size_t count) noexcept {
+  // Lemire's multiply-shift, without the division of the modulo method
+  return static_cast<std::size_t>(multiply_high(rng(), count));
+}
+
+template <typename WEIGHT_T>
+[[nodiscard]] WEIGHT_T make_weight(splitmix64& rng,
+                                   const generator_options& options) {
+  if constexpr (std::is_integral_v<WEIGHT_T>) {
+    const auto min_weight{
+        static_cast<long long>(std::ceil(options.min_weight))};
+    const auto max_weight{
+        static_cast<long long>(std::floor(options.max_weight))};
+    if (max_weight <= min_weight) {
+      return static_cast<WEIGHT_T>(min_weight);
+    }
+    const auto range{static_cast<std::size_t>(max_weight - min_weight) + 1};
+    return static_cast<WEIGHT_T>(
+        min_weight + static_cast<long long>(uniform_index(rng, range)));
+  } else {
+    return static_cast<WEIGHT_T>(
+        options.min_weight +
+        uniform_real(rng) * (options.max_weight - options.min_weight));
+  }
+}
+
+template <typename EDGE_T>
+EDGE_T make_edge(splitmix64& rng, const generator_options& options) {
+  if constexpr (std::is_arithmetic_v<EDGE_T>) {
+    return make_weight<EDGE_T>(rng, options);
+  } else if constexpr (derived_from_weighted_edge<EDGE_T> &&
+                       std::is_constructible_v<EDGE_T,
+                                               typename EDGE_T::weight_t>) {
+    return EDGE_T{make_weight<typename EDGE_T::weight_t>(rng, options)};
+  } else {
+    return EDGE_T{};
+  }
+}
+
+template <typename EDGE_T, typename CHUNK_GENERATOR_T>
+std::vector<generated_edge<EDGE_T>> generate_in_chunks(
+    std::size_t chunk_count, const generator_options& options,
+    const CHUNK_GENERATOR_T& generate_chunk) {
+  if (chunk_count == 0) {
+    return {};
+  }
+
+  std::vector<std::vector<generated_edge<EDGE_T>>> chunk_edges(chunk_count);
+
+  auto& executor{
+      graaf::detail::select_executor(options.executor, options.thread_count)};
+
+  // Chunks differ in cost, hence the smallest grain balances them best
+  parallel_for(
+      executor, 0, chunk_count,
+      [&](std::size_t first_chunk, std::size_t last_chunk) {
+        for (auto chunk{first_chunk}; chunk < last_chunk; ++chunk) {
+          splitmix64 rng{chunk_seed(options.seed, chunk)};
+          generate_chunk(chunk, rng, chunk_edges[chunk]);
+        }
+      },
+      {.grain_size = 1, .max_concurrency = options.thread_count});
+
+  std::size_t edge_count{0};
+  for (const auto& edges : chunk_edges) {
+    edge_count += edges.size();
+  }
+
+  std::vector<generated_edge<EDGE_T>> edges{};
+  edges.reserve(edge_count);
+  for (auto& chunk : chunk_edges) {
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(edges));
+  }
+  return edges;
+}
+
+template <typename V, typename E, graph_type T>
+graph<V, E, T> build_graph(std::size_t vertex_count,
+                           std::vector<generated_edge<E>>&& edges) {
+  graph_builder<graph<V, E, T>> builder{};
+  builder.reserve(vertex_count, edges.size());
+
+  for (std::size_t vertex_index{0}; vertex_index < vertex_count;
+       ++vertex_index) {
+    [[maybe_unused]] const auto builder_index{builder.add_vertex(V{})};
+  }
+  for (auto& [vertex_index_lhs, vertex_index_rhs, edge] : edges) {
+    builder.add_edge(vertex_index_lhs, vertex_index_rhs, std::move(edge));
+  }
+  return std::move(builder).build();
+}
+
+}  // namespace detail
+
+}  // namespace graaf::generators
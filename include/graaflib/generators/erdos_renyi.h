@@ -0,0 +1,59 @@
+#pragma once
+
+#include <graaflib/generators/common.h>
+#include <graaflib/graph.h>
+
+#include <concepts>
+#include <cstddef>
+
+namespace graaf::generators {
+
+/**
+ * @brief Generates a G(n, p) Erdős–Rényi random graph, in which every possible
+ * edge between two distinct vertices exists with the given probability.
+ *
+ * Instead of drawing a random number for each of the n^2 possible edges, the
+ * gaps between consecutive edges are drawn from a geometric distribution, so
+ * the running time is proportional to the number of generated edges. The
+ * vertices are generated in parallel.
+ *
+ * @tparam V The vertex type of the graph, vertices are default constructed.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @param vertex_count The number of vertices n.
+ * @param edge_probability The probability p that an edge exists.
+ * @param options The seed, thread count and edge weight range.
+ * @return graph<V, E, T> The generated graph, vertex ids are [0, n).
+ * @throws invalid_argument - If the probability is not in [0, 1].
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+[[nodiscard]] graph<V, E, T> erdos_renyi_gnp(
+    std::size_t vertex_count, double edge_probability,
+    const generator_options& options = {});
+
+/**
+ * @brief Generates a G(n, m) Erdős–Rényi random graph, which has exactly m
+ * edges chosen uniformly among all edges between two distinct vertices.
+ *
+ * Edges are drawn one at a time and duplicates are rejected, so this generator
+ * is intended for sparse graphs and does not run in parallel.
+ *
+ * @tparam V The vertex type of the graph, vertices are default constructed.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @param vertex_count The number of vertices n.
+ * @param edge_count The number of edges m.
+ * @param options The seed and edge weight range.
+ * @return graph<V, E, T> The generated graph, vertex ids are [0, n).
+ * @throws invalid_argument - If m exceeds the number of possible edges.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+[[nodiscard]] graph<V, E, T> erdos_renyi_gnm(
+    std::size_t vertex_count, std::size_t edge_count,
+    const generator_options& options = {});
+
+}  // namespace graaf::generators
+
+#include "erdos_renyi.tpp"
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <graaflib/types.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+namespace graaf::generators {
+
+namespace detail {
+
+// The number of vertices of which the edges form one chunk of work
+inline constexpr std::size_t gnp_vertices_per_chunk{1024};
+
+/**
+ * @brief Generates the edges of a G(n, p) graph. For each vertex, edges to
+ * either all other vertices or only to the vertices with a larger index (for
+ * undirected graphs and DAGs) are considered.
+ */
+template <typename E>
+[[nodiscard]] std::vector<generated_edge<E>> generate_gnp_edges(
+    std::size_t vertex_count, double edge_probability, bool forward_only,
+    const generator_options& options) {
+  if (!(edge_probability >= 0.0 && edge_probability <= 1.0)) {
+    throw std::invalid_argument{"Edge probability [" +
+                                std::to_string(edge_probability) +
+                                "] is not in [0, 1]."};
+  }
+  if (edge_probability == 0.0 || vertex_count < 2) {
+    return {};
+  }
+
+  // Gaps between edges are geometrically distributed (Batagelj & Brandes)
+  const double log_no_edge_probability{std::log1p(-edge_probability)};
+  const auto generate_chunk{[&](std::size_t chunk, splitmix64& rng,
+                                std::vector<generated_edge<E>>& edges) {
+    const auto first_vertex{chunk * gnp_vertices_per_chunk};
+    const auto last_vertex{
+        std::min(first_vertex + gnp_vertices_per_chunk, vertex_count)};
+
+    for (auto vertex{first_vertex}; vertex < last_vertex; ++vertex) {
+      const auto candidate_count{forward_only ? vertex_count - vertex - 1
+                                              : vertex_count - 1};
+      const auto candidate_to_vertex{[&](std::size_t candidate) {
+        if (forward_only) {
+          return vertex + 1 + candidate;
+        }
+        // Skips the vertex itself, self loops are not generated
+        return candidate < vertex ? candidate : candidate + 1;
+      }};
+
+      for (std::size_t candidate{0}; candidate < candidate_count;
+           ++candidate) {
+        if (edge_probability < 1.0) {
+          const double gap{
+              std::floor(std::log1p(-uniform_real(rng)) /
+                         log_no_edge_probability)};
+          if (gap >= static_cast<double>(candidate_count - candidate)) {
+            break;
+          }
+          candidate += static_cast<std::size_t>(gap);
+        }
+        edges.push_back({vertex, candidate_to_vertex(candidate),
+                         make_edge<E>(rng, options)});
+      }
+    }
+  }};
+
+  const auto chunk_count{(vertex_count + gnp_vertices_per_chunk - 1) /
+                         gnp_vertices_per_chunk};
+  return generate_in_chunks<E>(chunk_count, options, generate_chunk);
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+graph<V, E, T> erdos_renyi_gnp(std::size_t vertex_count,
+                               double edge_probability,
+                               const generator_options& options) {
+  auto edges{detail::generate_gnp_edges<E>(
+      vertex_count, edge_probability, T == graph_type::UNDIRECTED, options)};
+  return detail::build_graph<V, E, T>(vertex_count, std::move(edges));
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+graph<V, E, T> erdos_renyi_gnm(std::size_t vertex_count,
+                               std::size_t edge_count,
+                               const generator_options& options) {
+  const auto pair_count{vertex_count < 2
+                            ? std::size_t{0}
+                            : vertex_count * (vertex_count - 1)};
+  const auto max_edge_count{T == graph_type::DIRECTED ? pair_count
+                                                      : pair_count / 2};
+  if (edge_count > max_edge_count) {
+    throw std::invalid_argument{
+        "Cannot generate [" + std::to_string(edge_count) +
+        "] edges, the graph has at most [" + std::to_string(max_edge_count) +
+        "] edges."};
+  }
+
+  splitmix64 rng{detail::chunk_seed(options.seed, 0)};
+  std::unordered_set<edge_id_t, edge_id_hash> edge_ids{};
+  edge_ids.reserve(edge_count);
+  std::vector<detail::generated_edge<E>> edges{};
+  edges.reserve(edge_count);
+
+  while (edges.size() < edge_count) {
+    auto vertex_index_lhs{detail::uniform_index(rng, vertex_count)};
+    auto vertex_index_rhs{detail::uniform_index(rng, vertex_count)};
+    if (vertex_index_lhs == vertex_index_rhs) {
+      continue;
+    }
+    if (T == graph_type::UNDIRECTED && vertex_index_lhs > vertex_index_rhs) {
+      std::swap(vertex_index_lhs, vertex_index_rhs);
+    }
+    if (edge_ids.emplace(vertex_index_lhs, vertex_index_rhs).second) {
+      edges.push_back({vertex_index_lhs, vertex_index_rhs,
+                       detail::make_edge<E>(rng, options)});
+    }
+  }
+
+  return detail::build_graph<V, E, T>(vertex_count, std::move(edges));
+}
+
+}  // namespace graaf::generators
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <graaflib/generators/common.h>
+#include <graaflib/graph.h>
+
+#include <concepts>
+#include <cstddef>
+
+namespace graaf::generators {
+
+/**
+ * @brief Generates a two dimensional grid graph, in which every vertex is
+ * connected to its horizontal and vertical neighbors. Road networks are often
+ * approximated by weighted grids.
+ *
+ * The vertex in row r and column c has id r * column_count + c. In a directed
+ * grid, neighbors are connected in both directions by edges with
+ * independently drawn weights. The rows are generated in parallel.
+ *
+ * @tparam V The vertex type of the graph, vertices are default constructed.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @param row_count The number of rows.
+ * @param column_count The number of columns.
+ * @param options The seed, thread count and edge weight range.
+ * @return graph<V, E, T> The generated graph.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+[[nodiscard]] graph<V, E, T> grid(std::size_t row_count,
+                                  std::size_t column_count,
+                                  const generator_options& options = {});
+
+}  // namespace graaf::generators
+
+#include "grid.tpp"
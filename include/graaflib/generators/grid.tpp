@@ -0,0 +1,55 @@
+#pragma once
+
+#include <utility>
+
+namespace graaf::generators {
+
+namespace detail {
+
+// The number of grid rows which form one chunk of work
+inline constexpr std::size_t grid_rows_per_chunk{64};
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+graph<V, E, T> grid(std::size_t row_count, std::size_t column_count,
+                    const generator_options& options) {
+  const auto generate_chunk{[&](std::size_t chunk, splitmix64& rng,
+                                std::vector<detail::generated_edge<E>>& edges) {
+    const auto first_row{chunk * detail::grid_rows_per_chunk};
+    const auto last_row{
+        std::min(first_row + detail::grid_rows_per_chunk, row_count)};
+
+    const auto connect{[&](std::size_t vertex_index_lhs,
+                           std::size_t vertex_index_rhs) {
+      edges.push_back({vertex_index_lhs, vertex_index_rhs,
+                       detail::make_edge<E>(rng, options)});
+      if constexpr (T == graph_type::DIRECTED) {
+        edges.push_back({vertex_index_rhs, vertex_index_lhs,
+                         detail::make_edge<E>(rng, options)});
+      }
+    }};
+
+    for (auto row{first_row}; row < last_row; ++row) {
+      for (std::size_t column{0}; column < column_count; ++column) {
+        const auto vertex_index{row * column_count + column};
+        if (column + 1 < column_count) {
+          connect(vertex_index, vertex_index + 1);
+        }
+        if (row + 1 < row_count) {
+          connect(vertex_index, vertex_index + column_count);
+        }
+      }
+    }
+  }};
+
+  const auto chunk_count{(row_count + detail::grid_rows_per_chunk - 1) /
+                         detail::grid_rows_per_chunk};
+  auto edges{detail::generate_in_chunks<E>(chunk_count, options,
+                                           generate_chunk)};
+  return detail::build_graph<V, E, T>(row_count * column_count,
+                                      std::move(edges));
+}
+
+}  // namespace graaf::generators
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <graaflib/generators/common.h>
+#include <graaflib/graph.h>
+
+#include <concepts>
+#include <cstddef>
+
+namespace graaf::generators {
+
+/**
+ * @brief Generates a random directed acyclic graph, in which every edge from a
+ * vertex to a vertex with a larger id exists with the given probability.
+ *
+ * The vertex ids are a topological order of the generated graph. The vertices
+ * are generated in parallel.
+ *
+ * @tparam V The vertex type of the graph, vertices are default constructed.
+ * @tparam E The edge type of the graph.
+ * @param vertex_count The number of vertices.
+ * @param edge_probability The probability that an edge exists.
+ * @param options The seed, thread count and edge weight range.
+ * @return directed_graph<V, E> The generated graph, vertex ids are [0, n).
+ * @throws invalid_argument - If the probability is not in [0, 1].
+ */
+template <typename V, typename E>
+  requires std::default_initializable<V>
+[[nodiscard]] directed_graph<V, E> random_dag(
+    std::size_t vertex_count, double edge_probability,
+    const generator_options& options = {});
+
+}  // namespace graaf::generators
+
+#include "random_dag.tpp"
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <graaflib/generators/erdos_renyi.h>
+
+#include <utility>
+
+namespace graaf::generators {
+
+template <typename V, typename E>
+  requires std::default_initializable<V>
+directed_graph<V, E> random_dag(std::size_t vertex_count,
+                                double edge_probability,
+                                const generator_options& options) {
+  // Only edges towards larger ids are generated, so there can be no cycles
+  auto edges{detail::generate_gnp_edges<E>(vertex_count, edge_probability,
+                                           true, options)};
+  return detail::build_graph<V, E, graph_type::DIRECTED>(vertex_count,
+                                                         std::move(edges));
+}
+
+}  // namespace graaf::generators
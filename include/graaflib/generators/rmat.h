@@ -0,0 +1,51 @@
+#pragma once
+
+#include <graaflib/generators/common.h>
+#include <graaflib/graph.h>
+
+#include <concepts>
+#include <cstddef>
+
+namespace graaf::generators {
+
+/**
+ * @brief The probabilities with which an R-MAT edge falls into each quadrant of
+ * the adjacency matrix. The probability of the bottom right quadrant is
+ * 1 - a - b - c. The defaults are those of the Graph500 benchmark.
+ */
+struct rmat_parameters {
+  double a{0.57};
+  double b{0.19};
+  double c{0.19};
+};
+
+/**
+ * @brief Generates a recursive matrix (R-MAT) graph, a Kronecker graph with a
+ * skewed, power-law like degree distribution similar to real world networks.
+ *
+ * 2^scale vertices are generated and edge_factor * 2^scale edges are sampled
+ * by recursively descending into one of the four quadrants of the adjacency
+ * matrix. Duplicate samples collapse into a single edge and self loops are
+ * kept, so the resulting graph has at most edge_factor * 2^scale edges. Edges
+ * are sampled in parallel.
+ *
+ * @tparam V The vertex type of the graph, vertices are default constructed.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @param scale The base two logarithm of the number of vertices.
+ * @param edge_factor The number of edges sampled per vertex.
+ * @param parameters The quadrant probabilities.
+ * @param options The seed, thread count and edge weight range.
+ * @return graph<V, E, T> The generated graph, vertex ids are [0, 2^scale).
+ * @throws invalid_argument - If the scale is too large or the probabilities
+ * are invalid.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+[[nodiscard]] graph<V, E, T> rmat(std::size_t scale, std::size_t edge_factor,
+                                  const rmat_parameters& parameters = {},
+                                  const generator_options& options = {});
+
+}  // namespace graaf::generators
+
+#include "rmat.tpp"
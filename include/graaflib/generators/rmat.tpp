@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+
+namespace graaf::generators {
+
+namespace detail {
+
+// The number of edge samples which form one chunk of work
+inline constexpr std::size_t rmat_samples_per_chunk{1 << 16};
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V>
+graph<V, E, T> rmat(std::size_t scale, std::size_t edge_factor,
+                    const rmat_parameters& parameters,
+                    const generator_options& options) {
+  if (scale >= 48) {
+    throw std::invalid_argument{"The scale of an R-MAT graph must be < 48."};
+  }
+  const auto [a, b, c]{parameters};
+  if (a < 0.0 || b < 0.0 || c < 0.0 || a + b + c > 1.0) {
+    throw std::invalid_argument{
+        "The R-MAT probabilities must be non-negative and sum to at most 1."};
+  }
+
+  const std::size_t vertex_count{std::size_t{1} << scale};
+  const auto sample_count{edge_factor * vertex_count};
+
+  const auto generate_chunk{[&](std::size_t chunk, splitmix64& rng,
+                                std::vector<detail::generated_edge<E>>& edges) {
+    const auto first_sample{chunk * detail::rmat_samples_per_chunk};
+    const auto last_sample{std::min(
+        first_sample + detail::rmat_samples_per_chunk, sample_count)};
+    edges.reserve(last_sample - first_sample);
+
+    for (auto sample{first_sample}; sample < last_sample; ++sample) {
+      std::size_t vertex_index_lhs{0};
+      std::size_t vertex_index_rhs{0};
+      for (std::size_t bit{std::size_t{1} << scale}; bit >>= 1;) {
+        const auto quadrant{detail::uniform_real(rng)};
+        if (quadrant >= a + b + c) {
+          vertex_index_lhs |= bit;
+          vertex_index_rhs |= bit;
+        } else if (quadrant >= a + b) {
+          vertex_index_lhs |= bit;
+        } else if (quadrant >= a) {
+          vertex_index_rhs |= bit;
+        }
+      }
+      edges.push_back({vertex_index_lhs, vertex_index_rhs,
+                       detail::make_edge<E>(rng, options)});
+    }
+  }};
+
+  const auto chunk_count{
+      (sample_count + detail::rmat_samples_per_chunk - 1) /
+      detail::rmat_samples_per_chunk};
+  auto edges{detail::generate_in_chunks<E>(chunk_count, options,
+                                           generate_chunk)};
+  return detail::build_graph<V, E, T>(vertex_count, std::move(edges));
+}
+
+}  // namespace graaf::generators
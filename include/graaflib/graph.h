@@ -3,6 +3,9 @@
 #include <graaflib/edge.h>
 #include <graaflib/types.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -11,6 +14,128 @@ namespace graaf {
 
 enum class graph_type { DIRECTED, UNDIRECTED };
 
+/**
+ * @brief An estimate of the heap memory used by a graph in bytes, broken down
+ * by its internal containers.
+ */
+struct graph_memory_usage {
+  // The vertex id to vertex map
+  std::size_t vertices{0};
+  // The edge id to edge map
+  std::size_t edges{0};
+  // The adjacency list, including the neighbor set of every vertex
+  std::size_t adjacency{0};
+
+  [[nodiscard]] std::size_t total() const noexcept {
+    return vertices + edges + adjacency;
+  }
+};
+
+/**
+ * @brief Receives the changes made to a graph, e.g. to maintain an index of
+ * the graph incrementally. The callbacks are invoked on the thread which
+ * changed the graph, after the change was made, and only for changes which
+ * had an effect: adding an edge which already exists is not reported.
+ */
+class graph_observer {
+ public:
+  virtual ~graph_observer() = default;
+
+  virtual void on_vertex_added(vertex_id_t /*vertex_id*/) {}
+
+  // Preceded by on_edge_removed for every edge of the vertex
+  virtual void on_vertex_removed(vertex_id_t /*vertex_id*/) {}
+
+  virtual void on_edge_added(vertex_id_t /*vertex_id_lhs*/,
+                             vertex_id_t /*vertex_id_rhs*/) {}
+
+  virtual void on_edge_removed(vertex_id_t /*vertex_id_lhs*/,
+                               vertex_id_t /*vertex_id_rhs*/) {}
+
+  // All vertices and edges were replaced at once, by assigning another graph
+  // to the graph or by moving from it. Invoked from the noexcept assignment
+  // and move operations of the graph, so it must not throw.
+  virtual void on_graph_replaced() noexcept {}
+};
+
+namespace detail {
+
+/**
+ * @brief The modification epoch of a graph. Assigning to a graph, or moving
+ * from it, replaces its contents wholesale, so it then takes an epoch which it
+ * never had before. Structures derived from the previous contents hence see
+ * that they are stale, even if the other graph had the same epoch.
+ */
+class graph_version {
+ public:
+  graph_version() = default;
+  graph_version(const graph_version& other) noexcept = default;
+  graph_version(graph_version&& other) noexcept : value_{other.value_} {
+    ++other.value_;
+  }
+
+  graph_version& operator=(const graph_version& other) noexcept {
+    value_ = std::max(value_, other.value_) + 1;
+    return *this;
+  }
+  graph_version& operator=(graph_version&& other) noexcept {
+    value_ = std::max(value_, other.value_) + 1;
+    ++other.value_;
+    return *this;
+  }
+
+  graph_version& operator++() noexcept {
+    ++value_;
+    return *this;
+  }
+
+  [[nodiscard]] std::uint64_t get() const noexcept { return value_; }
+
+ private:
+  std::uint64_t value_{0};
+};
+
+/**
+ * @brief The observer of a graph. An observer follows one graph object, so
+ * copying or moving a graph does not carry the observer over to the new
+ * graph, and assigning to a graph keeps its observer. The observers of the
+ * graphs whose contents are replaced by an assignment or a move are notified
+ * through graph_observer::on_graph_replaced.
+ */
+class graph_observer_handle {
+ public:
+  graph_observer_handle() = default;
+  graph_observer_handle(const graph_observer_handle& /*other*/) noexcept {}
+  graph_observer_handle(graph_observer_handle&& other) noexcept {
+    other.notify_replaced();
+  }
+
+  graph_observer_handle& operator=(
+      const graph_observer_handle& /*other*/) noexcept {
+    notify_replaced();
+    return *this;
+  }
+  graph_observer_handle& operator=(graph_observer_handle&& other) noexcept {
+    notify_replaced();
+    other.notify_replaced();
+    return *this;
+  }
+
+  [[nodiscard]] graph_observer* get() const noexcept { return observer_; }
+  void reset(graph_observer* observer) noexcept { observer_ = observer; }
+
+ private:
+  void notify_replaced() const noexcept {
+    if (observer_) {
+      observer_->on_graph_replaced();
+    }
+  }
+
+  graph_observer* observer_{nullptr};
+};
+
+}  // namespace detail
+
 template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
 class graph {
  public:
@@ -54,6 +179,34 @@ class graph {
    */
   [[nodiscard]] std::size_t edge_count() const noexcept;
 
+  /**
+   * Query the modification epoch of the graph. It increases whenever a vertex
+   * or an edge is added or removed, such that structures derived from the
+   * graph can cheaply check whether they are stale. Modifying a vertex or an
+   * edge in place, through the references returned by get_vertex and
+   * get_edge, does not change the epoch. Assigning another graph to the graph,
+   * or moving from it, gives it an epoch it never had before.
+   *
+   * @return uint64_t - The modification epoch
+   */
+  [[nodiscard]] std::uint64_t version() const noexcept { return version_.get(); }
+
+  /**
+   * Attach an observer which is notified of every vertex and edge which is
+   * added to or removed from the graph, and of the graph being assigned to or
+   * moved from, replacing any previous observer. The observer must outlive the
+   * graph or be detached before it is destroyed.
+   *
+   * @param observer The observer, or nullptr to detach the current observer
+   */
+  void set_observer(graph_observer* observer) noexcept {
+    observer_.reset(observer);
+  }
+
+  [[nodiscard]] graph_observer* get_observer() const noexcept {
+    return observer_.get();
+  }
+
   /**
    * @brief Get the intrnal vertices
    *
@@ -179,6 +332,17 @@ class graph {
    */
   [[nodiscard]] vertex_id_t add_vertex(auto&& vertex);
 
+  /**
+   * Add a vertex with a given ID to the graph. Vertices which are added later
+   * on without an explicit ID are given IDs larger than the given ID.
+   *
+   * @param  vertex The vertex to be added
+   * @param  vertex_id The ID of the new vertex
+   * @return vertices_id_t - The ID of the new vertex
+   * @throws invalid_argument - If a vertex with the given ID already exists
+   */
+  vertex_id_t add_vertex(auto&& vertex, vertex_id_t vertex_id);
+
   /**
    * Remove a vertex from the graph and update all its neighbors
    *
@@ -195,6 +359,15 @@ class graph {
   void add_edge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs,
                 auto&& edge);
 
+  /**
+   * Reserve storage for at least the given number of vertices and edges, such
+   * that inserting them does not trigger any rehashing.
+   *
+   * @param  vertex_count The number of vertices to reserve storage for
+   * @param  edge_count The number of edges to reserve storage for
+   */
+  void reserve(std::size_t vertex_count, std::size_t edge_count);
+
   /**
    * Remove the edge between two vertices
    *
@@ -203,6 +376,16 @@ class graph {
    */
   void remove_edge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs);
 
+  /**
+   * Estimate the heap memory used by the graph. Every element of the hash
+   * based containers is counted as a separately allocated node, and every
+   * bucket as a pointer. Memory allocated by the vertices and edges themselves
+   * and the overhead of the allocator are not included.
+   *
+   * @return graph_memory_usage - The estimated memory usage per container
+   */
+  [[nodiscard]] graph_memory_usage memory_usage() const noexcept;
+
  private:
   std::unordered_map<vertex_id_t, vertices_t> adjacency_list_{};
 
@@ -210,6 +393,10 @@ class graph {
   edge_id_to_edge_t edges_{};
 
   size_t vertex_id_supplier_{0};
+  detail::graph_version version_{};
+  // Declared last, such that the observer is notified of an assignment or a
+  // move once all other members have been assigned or moved
+  detail::graph_observer_handle observer_{};
 };
 
 template <typename VERTEX_T, typename EDGE_T>
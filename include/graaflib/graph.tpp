@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 
@@ -15,6 +16,25 @@ inline std::pair<vertex_id_t, vertex_id_t> make_sorted_pair(
   return std::make_pair(vertex_id_rhs, vertex_id_lhs);
 }
 
+/**
+ * @brief Estimates the heap memory of an unordered container, excluding memory
+ * owned by its elements. Nodes hold the element, a pointer to the next node
+ * and the cached hash of the element, rounded up to the alignment of the
+ * allocator.
+ */
+template <typename CONTAINER_T>
+[[nodiscard]] std::size_t unordered_container_memory_usage(
+    const CONTAINER_T& container) noexcept {
+  constexpr std::size_t alignment{alignof(std::max_align_t)};
+  constexpr std::size_t node_size{
+      (sizeof(void*) + sizeof(typename CONTAINER_T::value_type) +
+       sizeof(std::size_t) + alignment - 1) /
+      alignment * alignment};
+
+  return container.size() * node_size +
+         container.bucket_count() * sizeof(void*);
+}
+
 }  // namespace detail
 
 template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
@@ -132,24 +152,61 @@ vertex_id_t graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::add_vertex(auto&& vertex) {
   // TODO: check overflow
   const auto vertex_id{vertex_id_supplier_++};
   vertices_.emplace(vertex_id, std::forward<VERTEX_T>(vertex));
+  ++version_;
+  if (auto* observer{observer_.get()}) {
+    observer->on_vertex_added(vertex_id);
+  }
+  return vertex_id;
+}
+
+template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
+vertex_id_t graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::add_vertex(
+    auto&& vertex, vertex_id_t vertex_id) {
+  if (has_vertex(vertex_id)) {
+    throw std::invalid_argument{"Vertex with ID [" +
+                                std::to_string(vertex_id) +
+                                "] already exists in graph."};
+  }
+
+  vertex_id_supplier_ = std::max(vertex_id_supplier_, vertex_id + 1);
+  vertices_.emplace(vertex_id, std::forward<VERTEX_T>(vertex));
+  ++version_;
+  if (auto* observer{observer_.get()}) {
+    observer->on_vertex_added(vertex_id);
+  }
   return vertex_id;
 }
 
 template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
 void graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::remove_vertex(
     vertex_id_t vertex_id) {
+  auto* observer{observer_.get()};
+  const auto erase_edge{[this, observer](vertex_id_t vertex_id_lhs,
+                                         vertex_id_t vertex_id_rhs) {
+    if (edges_.erase({vertex_id_lhs, vertex_id_rhs}) > 0 && observer) {
+      observer->on_edge_removed(vertex_id_lhs, vertex_id_rhs);
+    }
+  }};
+
   if (adjacency_list_.contains(vertex_id)) {
     for (auto& target_vertex_id : adjacency_list_.at(vertex_id)) {
-      edges_.erase({vertex_id, target_vertex_id});
+      erase_edge(vertex_id, target_vertex_id);
     }
   }
 
   adjacency_list_.erase(vertex_id);
-  vertices_.erase(vertex_id);
+  const auto removed{vertices_.erase(vertex_id) > 0};
 
   for (auto& [source_vertex_id, neighbors] : adjacency_list_) {
     neighbors.erase(vertex_id);
-    edges_.erase({source_vertex_id, vertex_id});
+    erase_edge(source_vertex_id, vertex_id);
+  }
+
+  if (removed) {
+    ++version_;
+    if (observer) {
+      observer->on_vertex_removed(vertex_id);
+    }
   }
 }
 
@@ -164,41 +221,82 @@ void graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::add_edge(vertex_id_t vertex_id_lhs,
         std::to_string(vertex_id_rhs) + "] not found in graph."};
   }
 
+  bool inserted{false};
   using enum graph_type;
   if constexpr (GRAPH_TYPE_V == DIRECTED) {
     adjacency_list_[vertex_id_lhs].insert(vertex_id_rhs);
-    edges_.emplace(std::make_pair(vertex_id_lhs, vertex_id_rhs),
-                   std::forward<EDGE_T>(edge));
-    return;
+    inserted = edges_
+                   .emplace(std::make_pair(vertex_id_lhs, vertex_id_rhs),
+                            std::forward<EDGE_T>(edge))
+                   .second;
   } else if constexpr (GRAPH_TYPE_V == UNDIRECTED) {
     adjacency_list_[vertex_id_lhs].insert(vertex_id_rhs);
     adjacency_list_[vertex_id_rhs].insert(vertex_id_lhs);
-    edges_.emplace(detail::make_sorted_pair(vertex_id_lhs, vertex_id_rhs),
-                   std::forward<EDGE_T>(edge));
-    return;
+    inserted =
+        edges_
+            .emplace(detail::make_sorted_pair(vertex_id_lhs, vertex_id_rhs),
+                     std::forward<EDGE_T>(edge))
+            .second;
+  } else {
+    // Should never reach this
+    std::abort();
   }
 
-  // Should never reach this
-  std::abort();
+  if (inserted) {
+    ++version_;
+    if (auto* observer{observer_.get()}) {
+      observer->on_edge_added(vertex_id_lhs, vertex_id_rhs);
+    }
+  }
+}
+
+template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
+void graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::reserve(std::size_t vertex_count,
+                                                    std::size_t edge_count) {
+  vertices_.reserve(vertex_count);
+  adjacency_list_.reserve(vertex_count);
+  edges_.reserve(edge_count);
 }
 
 template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
 void graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::remove_edge(
     vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs) {
+  bool removed{false};
   using enum graph_type;
   if constexpr (GRAPH_TYPE_V == DIRECTED) {
     adjacency_list_.at(vertex_id_lhs).erase(vertex_id_rhs);
-    edges_.erase(std::make_pair(vertex_id_lhs, vertex_id_rhs));
-    return;
+    removed = edges_.erase(std::make_pair(vertex_id_lhs, vertex_id_rhs)) > 0;
   } else if constexpr (GRAPH_TYPE_V == UNDIRECTED) {
     adjacency_list_.at(vertex_id_lhs).erase(vertex_id_rhs);
     adjacency_list_.at(vertex_id_rhs).erase(vertex_id_lhs);
-    edges_.erase(detail::make_sorted_pair(vertex_id_lhs, vertex_id_rhs));
-    return;
+    removed =
+        edges_.erase(detail::make_sorted_pair(vertex_id_lhs, vertex_id_rhs)) >
+        0;
+  } else {
+    // Should never reach this
+    std::abort();
   }
 
-  // Should never reach this
-  std::abort();
+  if (removed) {
+    ++version_;
+    if (auto* observer{observer_.get()}) {
+      observer->on_edge_removed(vertex_id_lhs, vertex_id_rhs);
+    }
+  }
+}
+
+template <typename VERTEX_T, typename EDGE_T, graph_type GRAPH_TYPE_V>
+graph_memory_usage graph<VERTEX_T, EDGE_T, GRAPH_TYPE_V>::memory_usage()
+    const noexcept {
+  graph_memory_usage usage{
+      .vertices = detail::unordered_container_memory_usage(vertices_),
+      .edges = detail::unordered_container_memory_usage(edges_),
+      .adjacency = detail::unordered_container_memory_usage(adjacency_list_)};
+
+  for (const auto& [_, neighbors] : adjacency_list_) {
+    usage.adjacency += detail::unordered_container_memory_usage(neighbors);
+  }
+  return usage;
 }
 
 }  // namespace graaf
\ No newline at end of file
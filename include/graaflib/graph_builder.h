@@ -0,0 +1,114 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace graaf {
+
+/**
+ * @brief Collects vertices and edges and inserts them into a graph in bulk.
+ *
+ * Vertices are referred to by their insertion index, which allows readers and
+ * generators to describe a graph before it exists. Since the final number of
+ * vertices and edges is known when building, the storage of the graph is
+ * reserved up front and no rehashing takes place during insertion.
+ *
+ * @tparam GRAPH_T The type of graph to build.
+ */
+template <typename GRAPH_T>
+class graph_builder {
+ public:
+  using vertex_t = typename GRAPH_T::vertex_t;
+  using edge_t = typename GRAPH_T::edge_t;
+
+  /**
+   * Reserve storage for the given number of vertices and edges in the builder.
+   *
+   * @param  vertex_count The number of vertices to reserve storage for
+   * @param  edge_count The number of edges to reserve storage for
+   */
+  void reserve(std::size_t vertex_count, std::size_t edge_count);
+
+  /**
+   * Query the number of vertices added to the builder
+   *
+   * @return size_t - Number of vertices
+   */
+  [[nodiscard]] std::size_t vertex_count() const noexcept {
+    return vertices_.size();
+  }
+
+  /**
+   * Query the number of edges added to the builder
+   *
+   * @return size_t - Number of edges
+   */
+  [[nodiscard]] std::size_t edge_count() const noexcept {
+    return edges_.size();
+  }
+
+  /**
+   * Add a vertex to the builder
+   *
+   * @param  vertex The vertex to be added
+   * @return size_t - The index of the new vertex in the builder
+   */
+  [[nodiscard]] std::size_t add_vertex(auto&& vertex);
+
+  /**
+   * Get a vertex which was previously added to the builder
+   *
+   * @param  vertex_index The index of the vertex
+   * @return vertex_t - A reference to the vertex
+   * @throws out_of_range - If the vertex was not added
+   */
+  [[nodiscard]] vertex_t& get_vertex(std::size_t vertex_index) {
+    return vertices_.at(vertex_index);
+  }
+
+  /**
+   * Add an edge between two vertices which were previously added to the
+   * builder
+   *
+   * @param  vertex_index_lhs The index of the first vertex
+   * @param  vertex_index_rhs The index of the second vertex
+   * @param  edge The edge to be added
+   * @throws invalid_argument - If either of the vertices was not added
+   */
+  void add_edge(std::size_t vertex_index_lhs, std::size_t vertex_index_rhs,
+                auto&& edge);
+
+  /**
+   * Create a new graph containing all vertices and edges of the builder. In
+   * the resulting graph, the vertex id of each vertex equals its index in the
+   * builder.
+   *
+   * @return GRAPH_T - The newly built graph
+   */
+  [[nodiscard]] GRAPH_T build() &&;
+
+  /**
+   * Insert all vertices and edges of the builder into an existing graph.
+   *
+   * @param  graph The graph to insert into
+   * @return std::vector<vertex_id_t> - The vertex id of each builder index
+   */
+  std::vector<vertex_id_t> build_into(GRAPH_T& graph) &&;
+
+ private:
+  struct pending_edge {
+    std::size_t vertex_index_lhs;
+    std::size_t vertex_index_rhs;
+    edge_t edge;
+  };
+
+  std::vector<vertex_t> vertices_{};
+  std::vector<pending_edge> edges_{};
+};
+
+}  // namespace graaf
+
+#include "graph_builder.tpp"
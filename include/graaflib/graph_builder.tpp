@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graaf {
+
+template <typename GRAPH_T>
+void graph_builder<GRAPH_T>::reserve(std::size_t vertex_count,
+                                     std::size_t edge_count) {
+  vertices_.reserve(vertex_count);
+  edges_.reserve(edge_count);
+}
+
+template <typename GRAPH_T>
+std::size_t graph_builder<GRAPH_T>::add_vertex(auto&& vertex) {
+  vertices_.emplace_back(std::forward<decltype(vertex)>(vertex));
+  return vertices_.size() - 1;
+}
+
+template <typename GRAPH_T>
+void graph_builder<GRAPH_T>::add_edge(std::size_t vertex_index_lhs,
+                                      std::size_t vertex_index_rhs,
+                                      auto&& edge) {
+  if (vertex_index_lhs >= vertices_.size() ||
+      vertex_index_rhs >= vertices_.size()) {
+    throw std::invalid_argument{
+        "Vertices with index [" + std::to_string(vertex_index_lhs) +
+        "] and [" + std::to_string(vertex_index_rhs) +
+        "] not found in builder."};
+  }
+
+  edges_.push_back(
+      pending_edge{vertex_index_lhs, vertex_index_rhs,
+                   edge_t(std::forward<decltype(edge)>(edge))});
+}
+
+template <typename GRAPH_T>
+GRAPH_T graph_builder<GRAPH_T>::build() && {
+  GRAPH_T graph{};
+  std::move(*this).build_into(graph);
+  return graph;
+}
+
+template <typename GRAPH_T>
+std::vector<vertex_id_t> graph_builder<GRAPH_T>::build_into(GRAPH_T& graph) && {
+  graph.reserve(graph.vertex_count() + vertices_.size(),
+                graph.edge_count() + edges_.size());
+
+  std::vector<vertex_id_t> vertex_ids{};
+  vertex_ids.reserve(vertices_.size());
+  for (auto& vertex : vertices_) {
+    vertex_ids.push_back(graph.add_vertex(std::move(vertex)));
+  }
+
+  for (auto& [vertex_index_lhs, vertex_index_rhs, edge] : edges_) {
+    graph.add_edge(vertex_ids[vertex_index_lhs], vertex_ids[vertex_index_rhs],
+                   std::move(edge));
+  }
+
+  vertices_.clear();
+  edges_.clear();
+  return vertex_ids;
+}
+
+}  // namespace graaf
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <graaflib/edge.h>
+#include <graaflib/types.h>
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace graaf::io {
+
+namespace detail {
+
+template <typename T>
+concept string_parsable =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/**
+ * @brief Appends the decimal representation of an integral value to a string.
+ *
+ * This avoids the temporary string created by std::to_string, which matters
+ * when serializing millions of vertex and edge ids.
+ *
+ * @param str The string to append to.
+ * @param value The value to append.
+ */
+template <typename INTEGRAL_T>
+  requires std::integral<INTEGRAL_T>
+void append_integral(std::string& str, INTEGRAL_T value);
+
+/**
+ * @brief Appends the shortest representation of an arithmetic value which
+ * parses back to the same value.
+ *
+ * @param str The string to append to.
+ * @param value The value to append.
+ */
+template <typename T>
+  requires std::is_arithmetic_v<T>
+void append_number(std::string& str, T value);
+
+/**
+ * @brief Parses a number from a string, ignoring surrounding whitespace.
+ *
+ * @param str The string to parse.
+ * @return std::optional<T> The parsed number, or std::nullopt if the string
+ * does not contain a number of type T.
+ */
+template <typename T>
+  requires std::is_arithmetic_v<T>
+[[nodiscard]] std::optional<T> try_parse_number(std::string_view str);
+
+/**
+ * @brief Parses a number from a string, ignoring surrounding whitespace.
+ *
+ * @param str The string to parse.
+ * @return T The parsed number.
+ * @throws invalid_argument - If the string does not contain a number of type T.
+ */
+template <typename T>
+  requires std::is_arithmetic_v<T>
+[[nodiscard]] T parse_number(std::string_view str);
+
+/**
+ * @brief Reads the remaining contents of a stream into a string.
+ */
+[[nodiscard]] inline std::string read_stream(std::istream& stream);
+
+/**
+ * @brief Size in bytes from which buffered output is written to the stream.
+ */
+inline constexpr std::size_t output_buffer_size{1 << 16};
+
+/**
+ * @brief Writes the buffer to the stream and clears it once it holds at least
+ * output_buffer_size bytes.
+ */
+inline void write_if_full(std::ostream& stream, std::string& buffer);
+
+/**
+ * @brief Writes the buffer to the stream and clears it.
+ */
+inline void write_buffer(std::ostream& stream, std::string& buffer);
+
+/**
+ * @brief Read-only view on the contents of a file.
+ *
+ * On POSIX systems the file is memory mapped, such that parsers can hand out
+ * string_views into the file contents without copying. On other systems the
+ * contents are read into memory once.
+ */
+class mapped_file {
+ public:
+  /**
+   * @brief Maps the file at the given path.
+   *
+   * @param path Path to the file.
+   * @throws invalid_argument - If the file cannot be opened.
+   */
+  explicit mapped_file(const std::filesystem::path& path);
+  ~mapped_file();
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  [[nodiscard]] std::string_view contents() const noexcept {
+    return {data_, size_};
+  }
+
+ private:
+  const char* data_{nullptr};
+  std::size_t size_{0};
+  bool is_mapped_{false};
+
+  // Holds the file contents when memory mapping is not available
+  std::string fallback_contents_{};
+};
+
+/**
+ * @brief Splits line based text formats into lines and whitespace separated
+ * fields without copying.
+ *
+ * Used by the readers of the edge list formats (Matrix Market, METIS and
+ * DIMACS). Errors are reported together with the current line number.
+ */
+class line_tokenizer {
+ public:
+  /**
+   * @param input The text to tokenize.
+   * @param format_name Name of the format, used in error messages.
+   */
+  line_tokenizer(std::string_view input, std::string_view format_name) noexcept
+      : input_{input}, format_name_{format_name} {}
+
+  /**
+   * Advance to the next line of the input.
+   *
+   * @return bool - False if the end of the input was reached
+   */
+  bool next_line() noexcept;
+
+  /**
+   * @return std::string_view - The part of the current line which was not
+   * consumed as a field yet
+   */
+  [[nodiscard]] std::string_view line() const noexcept { return line_; }
+
+  /**
+   * @return bool - Whether the rest of the current line is only whitespace
+   */
+  [[nodiscard]] bool at_end_of_line() noexcept;
+
+  /**
+   * Consume the next whitespace separated field of the current line.
+   *
+   * @return std::optional<std::string_view> - The field, or std::nullopt at
+   * the end of the line
+   */
+  std::optional<std::string_view> next_field() noexcept;
+
+  /**
+   * Consume the next field of the current line and parse it as a number.
+   *
+   * @return T - The parsed number
+   * @throws invalid_argument - If there is no field or it is not a number
+   */
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  T next_number();
+
+  [[nodiscard]] std::size_t line_number() const noexcept {
+    return line_number_;
+  }
+
+  /**
+   * @throws invalid_argument - Always, mentioning the format and the line
+   */
+  [[noreturn]] void fail(const std::string& message) const;
+
+ private:
+  std::string_view input_;
+  std::string_view format_name_;
+  std::size_t position_{0};
+  std::size_t line_number_{0};
+  std::string_view line_{};
+};
+
+/**
+ * @brief Assigns the vertices of a graph contiguous indices [0, n), ordered by
+ * vertex id, as required by formats which identify vertices by their index.
+ *
+ * If the vertex ids of the graph already are contiguous, which holds for all
+ * graphs without removed vertices, no lookup table is built.
+ */
+template <typename GRAPH_T>
+class vertex_index_map {
+ public:
+  explicit vertex_index_map(const GRAPH_T& graph);
+
+  [[nodiscard]] std::size_t index_of(vertex_id_t vertex_id) const {
+    return is_identity_ ? vertex_id : indices_.at(vertex_id);
+  }
+
+  /**
+   * @return std::vector<vertex_id_t> - The vertex ids ordered by their index
+   */
+  [[nodiscard]] const std::vector<vertex_id_t>& vertex_ids() const noexcept {
+    return vertex_ids_;
+  }
+
+ private:
+  std::vector<vertex_id_t> vertex_ids_{};
+  std::unordered_map<vertex_id_t, std::size_t> indices_{};
+  bool is_identity_{true};
+};
+
+}  // namespace detail
+
+}  // namespace graaf::io
+
+#include "common.tpp"
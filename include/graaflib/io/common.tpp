@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace graaf::io {
+
+namespace detail {
+
+template <typename INTEGRAL_T>
+  requires std::integral<INTEGRAL_T>
+void append_integral(std::string& str, INTEGRAL_T value) {
+  // Enough room for all digits and the sign of any integral type
+  char digits[std::numeric_limits<INTEGRAL_T>::digits10 + 2];
+  const auto result{std::to_chars(std::begin(digits), std::end(digits), value)};
+  str.append(std::begin(digits), result.ptr);
+}
+
+template <typename T>
+  requires std::is_arithmetic_v<T>
+void append_number(std::string& str, T value) {
+  if constexpr (std::is_integral_v<T>) {
+    append_integral(str, value);
+  } else {
+    // The shortest round trip representation of any floating point type
+    char digits[64];
+    const auto result{
+        std::to_chars(std::begin(digits), std::end(digits), value)};
+    str.append(std::begin(digits), result.ptr);
+  }
+}
+
+template <typename T>
+  requires std::is_arithmetic_v<T>
+std::optional<T> try_parse_number(std::string_view str) {
+  constexpr std::string_view whitespace{" \t\r\n"};
+  const auto first{str.find_first_not_of(whitespace)};
+  const auto last{str.find_last_not_of(whitespace)};
+  auto trimmed{first == std::string_view::npos
+                   ? std::string_view{}
+                   : str.substr(first, last - first + 1)};
+
+  // std::from_chars does not accept an explicit plus sign
+  if (trimmed.starts_with('+')) {
+    trimmed.remove_prefix(1);
+  }
+
+  T value{};
+  const auto [end, error]{
+      std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), value)};
+  if (trimmed.empty() || error != std::errc{} ||
+      end != trimmed.data() + trimmed.size()) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+template <typename T>
+  requires std::is_arithmetic_v<T>
+T parse_number(std::string_view str) {
+  const auto value{try_parse_number<T>(str)};
+  if (!value) {
+    throw std::invalid_argument{"Unable to parse [" + std::string{str} +
+                                "] as a number."};
+  }
+  return *value;
+}
+
+inline std::string read_stream(std::istream& stream) {
+  return {std::istreambuf_iterator<char>{stream},
+          std::istreambuf_iterator<char>{}};
+}
+
+inline void write_if_full(std::ostream& stream, std::string& buffer) {
+  if (buffer.size() >= output_buffer_size) {
+    write_buffer(stream, buffer);
+  }
+}
+
+inline void write_buffer(std::ostream& stream, std::string& buffer) {
+  stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  buffer.clear();
+}
+
+inline mapped_file::mapped_file(const std::filesystem::path& path) {
+#if defined(__unix__) || defined(__APPLE__)
+  const int file_descriptor{::open(path.c_str(), O_RDONLY)};
+  if (file_descriptor >= 0) {
+    struct stat file_status {};
+    // Only regular files can be mapped, anything else (e.g. pipes) is read
+    const bool is_regular_file{::fstat(file_descriptor, &file_status) == 0 &&
+                               S_ISREG(file_status.st_mode)};
+    const auto file_size{static_cast<std::size_t>(file_status.st_size)};
+
+    if (is_regular_file && file_size > 0) {
+      void* mapping{::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE,
+                           file_descriptor, 0)};
+      if (mapping != MAP_FAILED) {
+        // Parsers read the file front to back
+        ::madvise(mapping, file_size, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+        size_ = file_size;
+        is_mapped_ = true;
+      }
+    }
+    ::close(file_descriptor);
+
+    // Mapping an empty file is not allowed, an empty view suffices
+    if (is_mapped_ || (is_regular_file && file_size == 0)) {
+      return;
+    }
+  }
+#endif
+
+  // Fall back to reading the entire file into memory
+  std::ifstream file{path, std::ios::binary};
+  if (!file) {
+    throw std::invalid_argument{"Unable to open file [" + path.string() +
+                                "]."};
+  }
+  fallback_contents_.assign(std::istreambuf_iterator<char>{file},
+                            std::istreambuf_iterator<char>{});
+  data_ = fallback_contents_.data();
+  size_ = fallback_contents_.size();
+}
+
+inline mapped_file::~mapped_file() {
+#if defined(__unix__) || defined(__APPLE__)
+  if (is_mapped_) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+}
+
+inline bool line_tokenizer::next_line() noexcept {
+  if (position_ >= input_.size()) {
+    line_ = {};
+    return false;
+  }
+
+  const auto line_end{input_.find('\n', position_)};
+  const auto next_position{line_end == std::string_view::npos ? input_.size()
+                                                              : line_end + 1};
+  line_ = input_.substr(position_, next_position - position_);
+  position_ = next_position;
+  ++line_number_;
+
+  while (!line_.empty() && (line_.back() == '\n' || line_.back() == '\r')) {
+    line_.remove_suffix(1);
+  }
+  return true;
+}
+
+inline bool line_tokenizer::at_end_of_line() noexcept {
+  const auto first{line_.find_first_not_of(" \t")};
+  line_.remove_prefix(first == std::string_view::npos ? line_.size() : first);
+  return line_.empty();
+}
+
+inline std::optional<std::string_view> line_tokenizer::next_field() noexcept {
+  if (at_end_of_line()) {
+    return std::nullopt;
+  }
+
+  const auto field_end{std::min(line_.find_first_of(" \t"), line_.size())};
+  const auto field{line_.substr(0, field_end)};
+  line_.remove_prefix(field_end);
+  return field;
+}
+
+template <typename T>
+  requires std::is_arithmetic_v<T>
+T line_tokenizer::next_number() {
+  const auto field{next_field()};
+  if (!field) {
+    fail("expected a number.");
+  }
+
+  const auto value{try_parse_number<T>(*field)};
+  if (!value) {
+    fail("unable to parse [" + std::string{*field} + "] as a number.");
+  }
+  return *value;
+}
+
+inline void line_tokenizer::fail(const std::string& message) const {
+  throw std::invalid_argument{"Invalid " + std::string{format_name_} +
+                              " input at line " +
+                              std::to_string(line_number_) + ": " + message};
+}
+
+template <typename GRAPH_T>
+vertex_index_map<GRAPH_T>::vertex_index_map(const GRAPH_T& graph) {
+  vertex_ids_.reserve(graph.vertex_count());
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    vertex_ids_.push_back(vertex_id);
+  }
+  std::sort(vertex_ids_.begin(), vertex_ids_.end());
+
+  // Vertex ids are unique, so they are contiguous iff the largest equals n - 1
+  is_identity_ =
+      vertex_ids_.empty() || vertex_ids_.back() == vertex_ids_.size() - 1;
+  if (!is_identity_) {
+    indices_.reserve(vertex_ids_.size());
+    for (std::size_t index{0}; index < vertex_ids_.size(); ++index) {
+      indices_.emplace(vertex_ids_[index], index);
+    }
+  }
+}
+
+}  // namespace detail
+
+}  // namespace graaf::io
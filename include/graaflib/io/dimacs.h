@@ -0,0 +1,65 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/io/common.h>
+
+#include <concepts>
+#include <filesystem>
+#include <istream>
+#include <ostream>
+
+namespace graaf::io {
+
+/**
+ * @brief Serializes a graph in the DIMACS shortest path format (.gr) and
+ * writes the result to a file.
+ *
+ * Vertices are numbered 1..n in order of increasing vertex id. Every edge of an
+ * undirected graph is written as an arc in both directions. Arc weights are
+ * obtained through graaf::get_weight.
+ *
+ * @param graph The graph we want to serialize.
+ * @param path Path to the output file.
+ */
+template <typename V, typename E, graph_type T>
+void to_dimacs(const graph<V, E, T>& graph, const std::filesystem::path& path);
+
+/**
+ * @brief Serializes a graph in the DIMACS shortest path format (.gr) and
+ * writes the result to a stream.
+ *
+ * @see to_dimacs(graph, path)
+ */
+template <typename V, typename E, graph_type T>
+void to_dimacs(const graph<V, E, T>& graph, std::ostream& stream);
+
+/**
+ * @brief Reads a graph from a file in the DIMACS shortest path format (.gr).
+ *
+ * Arc "a u v w" becomes an edge from the vertex with id u - 1 to the vertex
+ * with id v - 1, all vertices are default constructed. Read into an undirected
+ * graph, the arcs in both directions of an edge collapse into a single edge.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph, arc weights are parsed as an E.
+ * @tparam T The graph type (directed or undirected).
+ * @param path Path to the input file.
+ * @return graph<V, E, T> The graph read from the file.
+ * @throws invalid_argument - If the file cannot be read or is not valid DIMACS.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+[[nodiscard]] graph<V, E, T> from_dimacs(const std::filesystem::path& path);
+
+/**
+ * @brief Reads a graph in the DIMACS shortest path format (.gr) from a stream.
+ *
+ * @see from_dimacs(path)
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+[[nodiscard]] graph<V, E, T> from_dimacs(std::istream& stream);
+
+}  // namespace graaf::io
+
+#include "dimacs.tpp"
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <graaflib/graph_builder.h>
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace graaf::io {
+
+namespace detail {
+
+template <typename V, typename E, graph_type T>
+void write_dimacs(const graph<V, E, T>& graph, std::ostream& stream) {
+  const vertex_index_map index_map{graph};
+
+  std::size_t arc_count{graph.edge_count()};
+  if constexpr (T == graph_type::UNDIRECTED) {
+    // Self loops are written as a single arc
+    for (const auto& [edge_id, _] : graph.get_edges()) {
+      arc_count += edge_id.first == edge_id.second ? 0 : 1;
+    }
+  }
+
+  std::string buffer{"p sp "};
+  append_integral(buffer, graph.vertex_count());
+  buffer += ' ';
+  append_integral(buffer, arc_count);
+  buffer += '\n';
+
+  const auto append_arc{[&buffer](std::size_t source, std::size_t target,
+                                  const auto weight) {
+    buffer += "a ";
+    append_integral(buffer, source);
+    buffer += ' ';
+    append_integral(buffer, target);
+    buffer += ' ';
+    append_number(buffer, weight);
+    buffer += '\n';
+  }};
+
+  for (const auto& [edge_id, edge] : graph.get_edges()) {
+    const auto source{index_map.index_of(edge_id.first) + 1};
+    const auto target{index_map.index_of(edge_id.second) + 1};
+    const auto weight{get_weight(edge)};
+
+    append_arc(source, target, weight);
+    if constexpr (T == graph_type::UNDIRECTED) {
+      if (source != target) {
+        append_arc(target, source, weight);
+      }
+    }
+    write_if_full(stream, buffer);
+  }
+  write_buffer(stream, buffer);
+}
+
+template <typename V, typename E, graph_type T>
+[[nodiscard]] graph<V, E, T> read_dimacs(std::string_view input) {
+  line_tokenizer tokenizer{input, "DIMACS"};
+
+  graph_builder<graph<V, E, T>> builder{};
+  bool has_problem_line{false};
+  std::size_t vertex_count{0};
+  std::size_t arc_count{0};
+  std::size_t arcs_read{0};
+
+  const auto read_vertex_index{[&tokenizer, &vertex_count]() {
+    const auto index{tokenizer.next_number<std::size_t>()};
+    if (index == 0 || index > vertex_count) {
+      tokenizer.fail("vertex [" + std::to_string(index) + "] out of range.");
+    }
+    return index - 1;
+  }};
+
+  while (tokenizer.next_line()) {
+    const auto descriptor{tokenizer.next_field()};
+    if (!descriptor || *descriptor == "c") {
+      continue;
+    }
+
+    if (*descriptor == "p") {
+      if (has_problem_line) {
+        tokenizer.fail("duplicate problem line.");
+      }
+      if (tokenizer.next_field() != "sp") {
+        tokenizer.fail("expected a shortest path ('sp') problem.");
+      }
+      vertex_count = tokenizer.next_number<std::size_t>();
+      arc_count = tokenizer.next_number<std::size_t>();
+      has_problem_line = true;
+
+      builder.reserve(vertex_count, arc_count);
+      for (std::size_t vertex_index{0}; vertex_index < vertex_count;
+           ++vertex_index) {
+        [[maybe_unused]] const auto builder_index{builder.add_vertex(V{})};
+      }
+    } else if (*descriptor == "a") {
+      if (!has_problem_line) {
+        tokenizer.fail("arc before the problem line.");
+      }
+      if (++arcs_read > arc_count) {
+        tokenizer.fail("more arcs than declared in the problem line.");
+      }
+
+      const auto source{read_vertex_index()};
+      const auto target{read_vertex_index()};
+      builder.add_edge(source, target, tokenizer.next_number<E>());
+    } else {
+      tokenizer.fail("unexpected line descriptor [" +
+                     std::string{*descriptor} + "].");
+    }
+
+    if (!tokenizer.at_end_of_line()) {
+      tokenizer.fail("expected end of line.");
+    }
+  }
+
+  if (!has_problem_line) {
+    tokenizer.fail("missing problem line.");
+  }
+  if (arcs_read != arc_count) {
+    tokenizer.fail("expected " + std::to_string(arc_count) +
+                   " arcs, found " + std::to_string(arcs_read) + ".");
+  }
+
+  return std::move(builder).build();
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T>
+void to_dimacs(const graph<V, E, T>& graph, const std::filesystem::path& path) {
+  std::ofstream file{path};
+  to_dimacs(graph, file);
+}
+
+template <typename V, typename E, graph_type T>
+void to_dimacs(const graph<V, E, T>& graph, std::ostream& stream) {
+  detail::write_dimacs(graph, stream);
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+graph<V, E, T> from_dimacs(const std::filesystem::path& path) {
+  const detail::mapped_file file{path};
+  return detail::read_dimacs<V, E, T>(file.contents());
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+graph<V, E, T> from_dimacs(std::istream& stream) {
+  const auto contents{detail::read_stream(stream)};
+  return detail::read_dimacs<V, E, T>(contents);
+}
+
+}  // namespace graaf::io
@@ -1,11 +1,21 @@
 #pragma once
 
+#include <graaflib/executor.h>
 #include <graaflib/graph.h>
+#include <graaflib/io/common.h>
 
 #include <concepts>
+#include <cstddef>
 #include <filesystem>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace graaf::io {
 
@@ -30,6 +40,104 @@ const auto default_edge_writer{
     }};
 }  // namespace detail
 
+/**
+ * @brief The attributes of a vertex or edge as read from a dot file.
+ *
+ * Names and values are views into the dot input and are only valid for the
+ * duration of a vertex or edge reader call. Quotes around values are removed,
+ * escape sequences are kept as is.
+ */
+class dot_attributes {
+ public:
+  using attribute_t = std::pair<std::string_view, std::string_view>;
+  using const_iterator = typename std::vector<attribute_t>::const_iterator;
+
+  /**
+   * @brief Get the value of an attribute. If an attribute is specified more
+   * than once, the last value is returned.
+   *
+   * @param name The name of the attribute.
+   * @return std::optional<std::string_view> The value if the attribute exists.
+   */
+  [[nodiscard]] std::optional<std::string_view> get(
+      std::string_view name) const;
+
+  [[nodiscard]] std::size_t size() const noexcept { return attributes_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return attributes_.empty(); }
+  [[nodiscard]] const_iterator begin() const noexcept {
+    return attributes_.begin();
+  }
+  [[nodiscard]] const_iterator end() const noexcept {
+    return attributes_.end();
+  }
+
+  void add(std::string_view name, std::string_view value) {
+    attributes_.emplace_back(name, value);
+  }
+  void clear() noexcept { attributes_.clear(); }
+
+ private:
+  std::vector<attribute_t> attributes_{};
+};
+
+namespace detail {
+
+/**
+ * @brief Reads a vertex serialized by the default_vertex_writer. The label is
+ * expected to be of the form "<vertex_id>: <vertex>", but a label containing
+ * only the vertex is accepted as well.
+ */
+template <typename T>
+  requires string_parsable<T>
+const auto default_vertex_reader{
+    [](std::string_view /*dot_id*/, const dot_attributes& attributes) -> T {
+      const auto label{attributes.get("label")};
+      if (!label) {
+        return T{};
+      }
+
+      const auto separator{label->rfind(": ")};
+      return parse_number<T>(separator == std::string_view::npos
+                                 ? *label
+                                 : label->substr(separator + 2));
+    }};
+
+/**
+ * @brief Reads an edge serialized by the default_edge_writer. Edges without a
+ * label are given a unit weight.
+ */
+template <typename T>
+  requires string_parsable<T>
+const auto default_edge_reader{
+    [](const edge_id_t& /*edge_id*/, const dot_attributes& attributes) -> T {
+      const auto label{attributes.get("label")};
+      return label ? parse_number<T>(*label) : T{1};
+    }};
+
+}  // namespace detail
+
+/**
+ * @brief Options to tune the throughput of the dot serialization.
+ */
+struct dot_options {
+  // Number of threads used to format vertices and edges. With a single thread
+  // everything is formatted on the calling thread. When formatting in
+  // parallel, the vertex and edge writers are invoked concurrently.
+  std::size_t thread_count{1};
+
+  // Executor to format on when thread_count is larger than one, if null the
+  // default_executor is used.
+  graaf::executor* executor{nullptr};
+
+  // Number of vertices or edges which are formatted together as one unit of
+  // work when formatting in parallel.
+  std::size_t chunk_size{1 << 14};
+
+  // Size in bytes of the internal buffer, output is only handed to the
+  // underlying stream once this buffer is full.
+  std::size_t buffer_size{1 << 16};
+};
+
 /**
  * @brief Serializes a graph to dot format and writes the result to a file.
  *
@@ -43,6 +151,7 @@ const auto default_edge_writer{
  * edge_id_t and a graph::edge_t and serialize it to a string. Default
  * implementations are provided for primitive numeric types.
  * @param path Path to the output dot file.
+ * @param options Options to tune the serialization throughput.
  */
 template <typename V, typename E, graph_type T,
           typename VERTEX_WRITER_T = decltype(detail::default_vertex_writer<V>),
@@ -55,7 +164,116 @@ template <typename V, typename E, graph_type T,
 void to_dot(
     const graph<V, E, T>& graph, const std::filesystem::path& path,
     const VERTEX_WRITER_T& vertex_writer = detail::default_vertex_writer<V>,
-    const EDGE_WRITER_T& edge_writer = detail::default_edge_writer);
+    const EDGE_WRITER_T& edge_writer = detail::default_edge_writer,
+    const dot_options& options = {});
+
+/**
+ * @brief Serializes a graph to dot format and writes the result to a stream.
+ *
+ * Output is accumulated in an internal buffer and written to the stream in
+ * large blocks. The stream is not flushed.
+ *
+ * @param graph The graph we want to serialize.
+ * @param stream The stream to write the dot output to.
+ * @param vertex_writer Function used for serializing the vertices.
+ * @param edge_writer Function used for serializing the edges.
+ * @param options Options to tune the serialization throughput.
+ * @see to_dot(graph, path, vertex_writer, edge_writer, options)
+ */
+template <typename V, typename E, graph_type T,
+          typename VERTEX_WRITER_T = decltype(detail::default_vertex_writer<V>),
+          typename EDGE_WRITER_T = decltype(detail::default_edge_writer)>
+  requires std::is_invocable_r_v<std::string, const VERTEX_WRITER_T&,
+                                 vertex_id_t, const V&> &&
+           std::is_invocable_r_v<std::string, const EDGE_WRITER_T&,
+                                 const graaf::edge_id_t&,
+                                 const typename graph<V, E, T>::edge_t&>
+void to_dot(
+    const graph<V, E, T>& graph, std::ostream& stream,
+    const VERTEX_WRITER_T& vertex_writer = detail::default_vertex_writer<V>,
+    const EDGE_WRITER_T& edge_writer = detail::default_edge_writer,
+    const dot_options& options = {});
+
+/**
+ * @brief Serializes a graph to dot format and writes the result to an output
+ * iterator.
+ *
+ * @param graph The graph we want to serialize.
+ * @param output Output iterator accepting the characters of the dot output.
+ * @param vertex_writer Function used for serializing the vertices.
+ * @param edge_writer Function used for serializing the edges.
+ * @param options Options to tune the serialization throughput.
+ * @return OUTPUT_IT The output iterator past the last written character.
+ * @see to_dot(graph, path, vertex_writer, edge_writer, options)
+ */
+template <typename V, typename E, graph_type T, typename OUTPUT_IT,
+          typename VERTEX_WRITER_T = decltype(detail::default_vertex_writer<V>),
+          typename EDGE_WRITER_T = decltype(detail::default_edge_writer)>
+  requires std::output_iterator<OUTPUT_IT, char> &&
+           std::is_invocable_r_v<std::string, const VERTEX_WRITER_T&,
+                                 vertex_id_t, const V&> &&
+           std::is_invocable_r_v<std::string, const EDGE_WRITER_T&,
+                                 const graaf::edge_id_t&,
+                                 const typename graph<V, E, T>::edge_t&>
+OUTPUT_IT to_dot(
+    const graph<V, E, T>& graph, OUTPUT_IT output,
+    const VERTEX_WRITER_T& vertex_writer = detail::default_vertex_writer<V>,
+    const EDGE_WRITER_T& edge_writer = detail::default_edge_writer,
+    const dot_options& options = {});
+
+/**
+ * @brief Reads a graph from a file in dot format.
+ *
+ * The file is memory mapped and tokenized without copying, after which all
+ * vertices and edges are inserted into the graph in bulk. Vertices are given
+ * new vertex ids in the order in which they first appear in the file. Edge
+ * chains (a -> b -> c) and subgraphs as edge endpoints are supported. Default
+ * attributes (node [...], edge [...]) are not applied to individual vertices
+ * and edges.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph.
+ * @tparam T The graph type (directed or undirected).
+ * @param path Path to the input dot file.
+ * @param vertex_reader Function used for deserializing the vertices. Should
+ * accept the vertex id as written in the dot file and the dot_attributes of
+ * the vertex and return a V. Default implementations are provided for
+ * primitive numeric types which read files written by the default writers.
+ * @param edge_reader Function used for deserializing the edges. Should accept
+ * the edge_id_t in the new graph and the dot_attributes of the edge and return
+ * an E. Default implementations are provided for primitive numeric types.
+ * @return graph<V, E, T> The graph read from the file.
+ * @throws invalid_argument - If the file cannot be read, is not valid dot, or
+ * describes a graph of the other graph type.
+ */
+template <typename V, typename E, graph_type T,
+          typename VERTEX_READER_T = decltype(detail::default_vertex_reader<V>),
+          typename EDGE_READER_T = decltype(detail::default_edge_reader<E>)>
+  requires std::is_invocable_r_v<V, const VERTEX_READER_T&, std::string_view,
+                                 const dot_attributes&> &&
+           std::is_invocable_r_v<E, const EDGE_READER_T&, const edge_id_t&,
+                                 const dot_attributes&>
+[[nodiscard]] graph<V, E, T> from_dot(
+    const std::filesystem::path& path,
+    const VERTEX_READER_T& vertex_reader = detail::default_vertex_reader<V>,
+    const EDGE_READER_T& edge_reader = detail::default_edge_reader<E>);
+
+/**
+ * @brief Reads a graph in dot format from a stream.
+ *
+ * @see from_dot(path, vertex_reader, edge_reader)
+ */
+template <typename V, typename E, graph_type T,
+          typename VERTEX_READER_T = decltype(detail::default_vertex_reader<V>),
+          typename EDGE_READER_T = decltype(detail::default_edge_reader<E>)>
+  requires std::is_invocable_r_v<V, const VERTEX_READER_T&, std::string_view,
+                                 const dot_attributes&> &&
+           std::is_invocable_r_v<E, const EDGE_READER_T&, const edge_id_t&,
+                                 const dot_attributes&>
+[[nodiscard]] graph<V, E, T> from_dot(
+    std::istream& stream,
+    const VERTEX_READER_T& vertex_reader = detail::default_vertex_reader<V>,
+    const EDGE_READER_T& edge_reader = detail::default_edge_reader<E>);
 
 }  // namespace graaf::io
 
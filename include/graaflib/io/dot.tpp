@@ -1,9 +1,17 @@
 #pragma once
 
 #include <graaflib/graph.h>
+#include <graaflib/graph_builder.h>
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace graaf::io {
 
@@ -60,6 +68,761 @@ constexpr const char* graph_type_to_edge_specifier(const graph_type& type) {
       // LCOV_EXCL_STOP
   }
 }
+
+template <typename V, typename VERTEX_WRITER_T>
+void append_vertex(std::string& buffer, vertex_id_t vertex_id,
+                   const V& vertex, const VERTEX_WRITER_T& vertex_writer) {
+  buffer.push_back('\t');
+  append_integral(buffer, vertex_id);
+  buffer.append(" [");
+  buffer.append(vertex_writer(vertex_id, vertex));
+  buffer.append("];\n");
+}
+
+template <graph_type T, typename EDGE_T, typename EDGE_WRITER_T>
+void append_edge(std::string& buffer, const edge_id_t& edge_id,
+                 const EDGE_T& edge, const EDGE_WRITER_T& edge_writer) {
+  const auto [source_id, target_id]{edge_id};
+  buffer.push_back('\t');
+  append_integral(buffer, source_id);
+  buffer.push_back(' ');
+  buffer.append(graph_type_to_edge_specifier(T));
+  buffer.push_back(' ');
+  append_integral(buffer, target_id);
+  buffer.append(" [");
+  buffer.append(edge_writer(edge_id, edge));
+  buffer.append("];\n");
+}
+
+/**
+ * @brief Formats all elements on the calling thread. The buffer is handed to
+ * the sink each time it grows beyond the configured buffer size.
+ */
+template <typename CONTAINER_T, typename FORMATTER_T, typename SINK_T>
+void format_sequential(const CONTAINER_T& elements,
+                       const FORMATTER_T& formatter, const dot_options& options,
+                       std::string& buffer, SINK_T& sink) {
+  for (const auto& element : elements) {
+    formatter(buffer, element);
+    if (buffer.size() >= options.buffer_size) {
+      sink(std::string_view{buffer});
+      buffer.clear();
+    }
+  }
+}
+
+/**
+ * @brief Splits the elements in chunks which are formatted in parallel. The
+ * formatted chunks are handed to the sink in their original order, such that
+ * the output is identical to the sequential formatting.
+ */
+template <typename CONTAINER_T, typename FORMATTER_T, typename SINK_T>
+void format_parallel(const CONTAINER_T& elements, const FORMATTER_T& formatter,
+                     const dot_options& options, SINK_T& sink) {
+  // The unordered containers of the graph do not offer random access, so we
+  // first collect pointers to all elements
+  std::vector<const typename CONTAINER_T::value_type*> element_ptrs{};
+  element_ptrs.reserve(elements.size());
+  for (const auto& element : elements) {
+    element_ptrs.push_back(&element);
+  }
+
+  const auto chunk_size{std::max<std::size_t>(options.chunk_size, 1)};
+  const auto chunk_count{(element_ptrs.size() + chunk_size - 1) / chunk_size};
+
+  const auto format_chunk{
+      [&element_ptrs, &formatter, chunk_size](std::size_t chunk_index) {
+        const auto begin{chunk_index * chunk_size};
+        const auto end{std::min(begin + chunk_size, element_ptrs.size())};
+
+        std::string chunk{};
+        for (auto index{begin}; index < end; ++index) {
+          formatter(chunk, *element_ptrs[index]);
+        }
+        return chunk;
+      }};
+
+  auto& executor{
+      graaf::detail::select_executor(options.executor, options.thread_count)};
+
+  // Chunks are formatted in waves of thread_count chunks, this bounds the
+  // number of formatted chunks we keep in memory
+  std::vector<std::string> formatted_chunks(
+      std::min(options.thread_count, chunk_count));
+  for (std::size_t wave_begin{0}; wave_begin < chunk_count;
+       wave_begin += options.thread_count) {
+    const auto wave_size{
+        std::min(options.thread_count, chunk_count - wave_begin)};
+
+    parallel_for(
+        executor, 0, wave_size,
+        [&](std::size_t first_chunk, std::size_t last_chunk) {
+          for (auto chunk{first_chunk}; chunk < last_chunk; ++chunk) {
+            formatted_chunks[chunk] = format_chunk(wave_begin + chunk);
+          }
+        },
+        {.max_concurrency = options.thread_count});
+
+    for (std::size_t chunk{0}; chunk < wave_size; ++chunk) {
+      sink(std::string_view{formatted_chunks[chunk]});
+    }
+  }
+}
+
+template <typename V, typename E, graph_type T, typename VERTEX_WRITER_T,
+          typename EDGE_WRITER_T, typename SINK_T>
+void write_dot(const graph<V, E, T>& graph,
+               const VERTEX_WRITER_T& vertex_writer,
+               const EDGE_WRITER_T& edge_writer, const dot_options& options,
+               SINK_T& sink) {
+  const auto vertex_formatter{
+      [&vertex_writer](std::string& buffer, const auto& vertex_entry) {
+        const auto& [vertex_id, vertex]{vertex_entry};
+        append_vertex(buffer, vertex_id, vertex, vertex_writer);
+      }};
+
+  const auto edge_formatter{
+      [&edge_writer](std::string& buffer, const auto& edge_entry) {
+        const auto& [edge_id, edge]{edge_entry};
+        append_edge<T>(buffer, edge_id, edge, edge_writer);
+      }};
+
+  std::string buffer{};
+  buffer.reserve(options.buffer_size);
+
+  buffer.append(graph_type_to_string(T));
+  buffer.append(" {\n");
+
+  if (options.thread_count > 1) {
+    sink(std::string_view{buffer});
+    buffer.clear();
+
+    format_parallel(graph.get_vertices(), vertex_formatter, options, sink);
+    format_parallel(graph.get_edges(), edge_formatter, options, sink);
+  } else {
+    format_sequential(graph.get_vertices(), vertex_formatter, options, buffer,
+                      sink);
+    format_sequential(graph.get_edges(), edge_formatter, options, buffer,
+                      sink);
+  }
+
+  buffer.append("}\n");
+  sink(std::string_view{buffer});
+}
+
+
+/**
+ * Dot tokenizer and parser. The tokenizer hands out views into the input, such
+ * that no strings are allocated while parsing.
+ */
+enum class dot_token_type {
+  ID,
+  LEFT_BRACE,
+  RIGHT_BRACE,
+  LEFT_BRACKET,
+  RIGHT_BRACKET,
+  SEMICOLON,
+  COMMA,
+  EQUALS,
+  COLON,
+  DIRECTED_EDGE,
+  UNDIRECTED_EDGE,
+  END
+};
+
+struct dot_token {
+  dot_token_type type{dot_token_type::END};
+  std::string_view text{};
+
+  // Quoted ids are never interpreted as keywords
+  bool is_quoted{false};
+
+  // Position of the token in the input, used for error reporting
+  std::size_t offset{0};
+};
+
+class dot_tokenizer {
+ public:
+  explicit dot_tokenizer(std::string_view input) : input_{input} {}
+
+  [[nodiscard]] dot_token next();
+  [[nodiscard]] const dot_token& peek();
+
+  /**
+   * @brief Throws an invalid_argument exception mentioning the line of the
+   * offending token.
+   */
+  [[noreturn]] void fail(const dot_token& token,
+                         std::string_view message) const;
+
+ private:
+  [[nodiscard]] dot_token read_token();
+  [[nodiscard]] dot_token read_quoted_id();
+  [[nodiscard]] dot_token read_html_id();
+  [[nodiscard]] dot_token read_plain_id();
+  void skip_whitespace_and_comments();
+
+  std::string_view input_;
+  std::size_t position_{0};
+  std::optional<dot_token> peeked_{};
+};
+
+[[nodiscard]] inline bool is_id_character(char character) {
+  const auto uchar{static_cast<unsigned char>(character)};
+  return std::isalnum(uchar) || character == '_' || uchar >= 0x80;
+}
+
+[[nodiscard]] inline bool is_keyword(const dot_token& token,
+                                     std::string_view keyword) {
+  // Dot keywords are case-independent
+  return token.type == dot_token_type::ID && !token.is_quoted &&
+         std::ranges::equal(token.text, keyword, [](char lhs, char rhs) {
+           return std::tolower(static_cast<unsigned char>(lhs)) == rhs;
+         });
+}
+
+inline dot_token dot_tokenizer::next() {
+  if (peeked_) {
+    const auto token{*peeked_};
+    peeked_.reset();
+    return token;
+  }
+  return read_token();
+}
+
+inline const dot_token& dot_tokenizer::peek() {
+  if (!peeked_) {
+    peeked_ = read_token();
+  }
+  return *peeked_;
+}
+
+inline void dot_tokenizer::fail(const dot_token& token,
+                                std::string_view message) const {
+  const auto line{std::count(input_.begin(),
+                             input_.begin() + static_cast<std::ptrdiff_t>(
+                                                  token.offset),
+                             '\n') +
+                  1};
+  throw std::invalid_argument{"Invalid dot input at line " +
+                              std::to_string(line) + ": " +
+                              std::string{message}};
+}
+
+inline void dot_tokenizer::skip_whitespace_and_comments() {
+  while (position_ < input_.size()) {
+    const auto character{input_[position_]};
+
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      ++position_;
+    } else if (character == '#' || input_.substr(position_, 2) == "//") {
+      // Preprocessor output and line comments run until the end of the line
+      const auto line_end{input_.find('\n', position_)};
+      position_ = line_end == std::string_view::npos ? input_.size() : line_end;
+    } else if (input_.substr(position_, 2) == "/*") {
+      const auto comment_end{input_.find("*/", position_ + 2)};
+      if (comment_end == std::string_view::npos) {
+        fail(dot_token{.offset = position_}, "unterminated comment");
+      }
+      position_ = comment_end + 2;
+    } else {
+      return;
+    }
+  }
+}
+
+inline dot_token dot_tokenizer::read_token() {
+  skip_whitespace_and_comments();
+
+  if (position_ >= input_.size()) {
+    return dot_token{.type = dot_token_type::END, .offset = position_};
+  }
+
+  const auto single_character_token{[this](dot_token_type type) {
+    const dot_token token{type, input_.substr(position_, 1), false, position_};
+    ++position_;
+    return token;
+  }};
+
+  using enum dot_token_type;
+  switch (input_[position_]) {
+    case '{':
+      return single_character_token(LEFT_BRACE);
+    case '}':
+      return single_character_token(RIGHT_BRACE);
+    case '[':
+      return single_character_token(LEFT_BRACKET);
+    case ']':
+      return single_character_token(RIGHT_BRACKET);
+    case ';':
+      return single_character_token(SEMICOLON);
+    case ',':
+      return single_character_token(COMMA);
+    case '=':
+      return single_character_token(EQUALS);
+    case ':':
+      return single_character_token(COLON);
+    case '"':
+      return read_quoted_id();
+    case '<':
+      return read_html_id();
+    case '-':
+      if (input_.substr(position_, 2) == "->" ||
+          input_.substr(position_, 2) == "--") {
+        const dot_token token{input_[position_ + 1] == '>' ? DIRECTED_EDGE
+                                                           : UNDIRECTED_EDGE,
+                              input_.substr(position_, 2), false, position_};
+        position_ += 2;
+        return token;
+      }
+      return read_plain_id();
+    default:
+      return read_plain_id();
+  }
+}
+
+inline dot_token dot_tokenizer::read_quoted_id() {
+  const auto start{position_ + 1};
+  auto current{start};
+
+  while (current < input_.size() && input_[current] != '"') {
+    // Skip over escaped characters, these are kept as is
+    current += input_[current] == '\\' ? 2 : 1;
+  }
+
+  if (current >= input_.size()) {
+    fail(dot_token{.offset = position_}, "unterminated quoted string");
+  }
+
+  const dot_token token{dot_token_type::ID,
+                        input_.substr(start, current - start), true,
+                        position_};
+  position_ = current + 1;
+  return token;
+}
+
+inline dot_token dot_tokenizer::read_html_id() {
+  const auto start{position_ + 1};
+  auto current{start};
+
+  // HTML strings can contain nested angle brackets
+  std::size_t depth{1};
+  for (; current < input_.size(); ++current) {
+    if (input_[current] == '<') {
+      ++depth;
+    } else if (input_[current] == '>' && --depth == 0) {
+      break;
+    }
+  }
+
+  if (current >= input_.size()) {
+    fail(dot_token{.offset = position_}, "unterminated HTML string");
+  }
+
+  const dot_token token{dot_token_type::ID,
+                        input_.substr(start, current - start), true,
+                        position_};
+  position_ = current + 1;
+  return token;
+}
+
+inline dot_token dot_tokenizer::read_plain_id() {
+  const auto start{position_};
+  const auto first_character{input_[start]};
+
+  if (first_character == '-' || first_character == '.' ||
+      std::isdigit(static_cast<unsigned char>(first_character))) {
+    // Numeral: [-]?(.[0-9]+ | [0-9]+(.[0-9]*)?)
+    auto current{first_character == '-' ? start + 1 : start};
+    while (current < input_.size() &&
+           (std::isdigit(static_cast<unsigned char>(input_[current])) ||
+            input_[current] == '.')) {
+      ++current;
+    }
+    position_ = current;
+  } else if (is_id_character(first_character)) {
+    auto current{start};
+    while (current < input_.size() && is_id_character(input_[current])) {
+      ++current;
+    }
+    position_ = current;
+  }
+
+  if (position_ == start ||
+      (first_character == '-' && position_ == start + 1)) {
+    fail(dot_token{.offset = start},
+         "unexpected character '" + std::string(1, first_character) + "'");
+  }
+
+  return dot_token{dot_token_type::ID,
+                   input_.substr(start, position_ - start), false, start};
+}
+
+inline constexpr std::size_t no_attribute_block{
+    std::numeric_limits<std::size_t>::max()};
+
+/**
+ * Attributes are stored in one shared pool. Each attribute list in the input
+ * is a block in this pool. Vertices which are declared in multiple statements
+ * refer to their last block, which links to the blocks before it.
+ */
+struct dot_attribute_block {
+  std::size_t begin;
+  std::size_t end;
+  std::size_t previous_block;
+};
+
+struct dot_parsed_edge {
+  std::size_t vertex_index_lhs;
+  std::size_t vertex_index_rhs;
+  std::size_t attribute_block;
+};
+
+struct dot_document {
+  bool is_directed{false};
+
+  // Indexed by the order in which vertices first appear in the input
+  std::vector<std::string_view> vertex_ids{};
+  std::vector<std::size_t> vertex_attribute_blocks{};
+
+  std::vector<dot_parsed_edge> edges{};
+
+  std::vector<dot_attributes::attribute_t> attribute_pool{};
+  std::vector<dot_attribute_block> attribute_blocks{};
+};
+
+class dot_parser {
+ public:
+  explicit dot_parser(std::string_view input) : tokenizer_{input} {}
+
+  [[nodiscard]] dot_document parse() &&;
+
+ private:
+  // Edge endpoints are either a single vertex or all vertices of a subgraph
+  struct edge_operand {
+    std::size_t vertex_index{0};
+    bool is_subgraph{false};
+    std::vector<std::size_t> subgraph_vertex_indices{};
+
+    [[nodiscard]] std::span<const std::size_t> vertex_indices() const {
+      return is_subgraph ? std::span<const std::size_t>{subgraph_vertex_indices}
+                         : std::span<const std::size_t>{&vertex_index, 1};
+    }
+  };
+
+  using members_t = std::vector<std::size_t>;
+
+  void parse_statement_list(members_t* members);
+  void parse_statement(members_t* members);
+  void parse_edge_chain(edge_operand first_operand, members_t* members);
+  [[nodiscard]] edge_operand parse_edge_operand(members_t* members);
+  void parse_subgraph(members_t* members, members_t& subgraph_members);
+  void parse_port();
+  [[nodiscard]] std::size_t parse_attribute_list();
+  [[nodiscard]] std::size_t add_vertex(std::string_view dot_id,
+                                       members_t* members);
+  dot_token expect(dot_token_type type, std::string_view description);
+
+  dot_tokenizer tokenizer_;
+  dot_document document_{};
+  std::unordered_map<std::string_view, std::size_t> vertex_indices_{};
+
+  // Operand buffers per nesting level, reused between edge statements
+  std::vector<std::vector<edge_operand>> edge_chains_{};
+  std::size_t edge_chain_depth_{0};
+};
+
+inline dot_document dot_parser::parse() && {
+  auto token{tokenizer_.next()};
+  if (is_keyword(token, "strict")) {
+    token = tokenizer_.next();
+  }
+
+  if (is_keyword(token, "digraph")) {
+    document_.is_directed = true;
+  } else if (!is_keyword(token, "graph")) {
+    tokenizer_.fail(token, "expected 'graph' or 'digraph'");
+  }
+
+  // Optional graph name
+  if (tokenizer_.peek().type == dot_token_type::ID) {
+    (void)tokenizer_.next();
+  }
+
+  expect(dot_token_type::LEFT_BRACE, "'{'");
+  parse_statement_list(nullptr);
+  expect(dot_token_type::RIGHT_BRACE, "'}'");
+  expect(dot_token_type::END, "end of input");
+
+  return std::move(document_);
+}
+
+inline void dot_parser::parse_statement_list(members_t* members) {
+  while (tokenizer_.peek().type != dot_token_type::RIGHT_BRACE) {
+    parse_statement(members);
+    if (tokenizer_.peek().type == dot_token_type::SEMICOLON) {
+      (void)tokenizer_.next();
+    }
+  }
+}
+
+inline void dot_parser::parse_statement(members_t* members) {
+  const auto token{tokenizer_.peek()};
+
+  if (is_keyword(token, "graph") || is_keyword(token, "node") ||
+      is_keyword(token, "edge")) {
+    // Default attributes are not applied, so they are discarded after parsing
+    (void)tokenizer_.next();
+    const auto pool_size{document_.attribute_pool.size()};
+    const auto block_count{document_.attribute_blocks.size()};
+    if (parse_attribute_list() == no_attribute_block) {
+      tokenizer_.fail(tokenizer_.peek(), "expected '['");
+    }
+    document_.attribute_pool.resize(pool_size);
+    document_.attribute_blocks.resize(block_count);
+    return;
+  }
+
+  if (token.type == dot_token_type::ID && !is_keyword(token, "subgraph")) {
+    (void)tokenizer_.next();
+    if (tokenizer_.peek().type == dot_token_type::EQUALS) {
+      // Graph attribute assignment (ID = ID)
+      (void)tokenizer_.next();
+      expect(dot_token_type::ID, "attribute value");
+      return;
+    }
+
+    edge_operand operand{.vertex_index = add_vertex(token.text, members)};
+    parse_port();
+
+    if (tokenizer_.peek().type == dot_token_type::DIRECTED_EDGE ||
+        tokenizer_.peek().type == dot_token_type::UNDIRECTED_EDGE) {
+      parse_edge_chain(std::move(operand), members);
+      return;
+    }
+
+    const auto attribute_block{parse_attribute_list()};
+    if (attribute_block != no_attribute_block) {
+      document_.attribute_blocks[attribute_block].previous_block =
+          document_.vertex_attribute_blocks[operand.vertex_index];
+      document_.vertex_attribute_blocks[operand.vertex_index] =
+          attribute_block;
+    }
+    return;
+  }
+
+  auto operand{parse_edge_operand(members)};
+  if (tokenizer_.peek().type == dot_token_type::DIRECTED_EDGE ||
+      tokenizer_.peek().type == dot_token_type::UNDIRECTED_EDGE) {
+    parse_edge_chain(std::move(operand), members);
+  }
+}
+
+inline void dot_parser::parse_edge_chain(edge_operand first_operand,
+                                         members_t* members) {
+  if (edge_chains_.size() <= edge_chain_depth_) {
+    edge_chains_.resize(edge_chain_depth_ + 1);
+  }
+  // Subgraphs in the chain may contain edge statements of their own
+  const auto depth{edge_chain_depth_++};
+  edge_chains_[depth].clear();
+  edge_chains_[depth].push_back(std::move(first_operand));
+
+  while (tokenizer_.peek().type == dot_token_type::DIRECTED_EDGE ||
+         tokenizer_.peek().type == dot_token_type::UNDIRECTED_EDGE) {
+    const auto edge_operator{tokenizer_.next()};
+    if ((edge_operator.type == dot_token_type::DIRECTED_EDGE) !=
+        document_.is_directed) {
+      tokenizer_.fail(edge_operator,
+                      document_.is_directed
+                          ? "'--' is not allowed in a digraph"
+                          : "'->' is not allowed in an undirected graph");
+    }
+    auto operand{parse_edge_operand(members)};
+    edge_chains_[depth].push_back(std::move(operand));
+  }
+  --edge_chain_depth_;
+
+  const auto attribute_block{parse_attribute_list()};
+
+  const auto& chain{edge_chains_[depth]};
+  for (std::size_t i{1}; i < chain.size(); ++i) {
+    for (const auto vertex_index_lhs : chain[i - 1].vertex_indices()) {
+      for (const auto vertex_index_rhs : chain[i].vertex_indices()) {
+        document_.edges.push_back(
+            {vertex_index_lhs, vertex_index_rhs, attribute_block});
+      }
+    }
+  }
+}
+
+inline dot_parser::edge_operand dot_parser::parse_edge_operand(
+    members_t* members) {
+  const auto token{tokenizer_.peek()};
+
+  if (token.type == dot_token_type::LEFT_BRACE ||
+      is_keyword(token, "subgraph")) {
+    edge_operand operand{.is_subgraph = true};
+    parse_subgraph(members, operand.subgraph_vertex_indices);
+    return operand;
+  }
+
+  if (token.type != dot_token_type::ID) {
+    tokenizer_.fail(token, "expected a vertex or subgraph");
+  }
+
+  (void)tokenizer_.next();
+  edge_operand operand{.vertex_index = add_vertex(token.text, members)};
+  parse_port();
+  return operand;
+}
+
+inline void dot_parser::parse_subgraph(members_t* members,
+                                       members_t& subgraph_members) {
+  if (is_keyword(tokenizer_.peek(), "subgraph")) {
+    (void)tokenizer_.next();
+    // Optional subgraph name
+    if (tokenizer_.peek().type == dot_token_type::ID) {
+      (void)tokenizer_.next();
+    }
+  }
+
+  expect(dot_token_type::LEFT_BRACE, "'{'");
+  parse_statement_list(&subgraph_members);
+  expect(dot_token_type::RIGHT_BRACE, "'}'");
+
+  // Vertices of a subgraph are also part of the enclosing (sub)graph
+  if (members) {
+    members->insert(members->end(), subgraph_members.begin(),
+                    subgraph_members.end());
+  }
+}
+
+inline void dot_parser::parse_port() {
+  // Ports (vertex:port:compass_point) are not represented in the graph
+  while (tokenizer_.peek().type == dot_token_type::COLON) {
+    (void)tokenizer_.next();
+    expect(dot_token_type::ID, "port");
+  }
+}
+
+inline std::size_t dot_parser::parse_attribute_list() {
+  if (tokenizer_.peek().type != dot_token_type::LEFT_BRACKET) {
+    return no_attribute_block;
+  }
+
+  const auto begin{document_.attribute_pool.size()};
+  while (tokenizer_.peek().type == dot_token_type::LEFT_BRACKET) {
+    (void)tokenizer_.next();
+    while (tokenizer_.peek().type != dot_token_type::RIGHT_BRACKET) {
+      const auto name{expect(dot_token_type::ID, "attribute name")};
+      expect(dot_token_type::EQUALS, "'='");
+      const auto value{expect(dot_token_type::ID, "attribute value")};
+      document_.attribute_pool.emplace_back(name.text, value.text);
+
+      if (tokenizer_.peek().type == dot_token_type::SEMICOLON ||
+          tokenizer_.peek().type == dot_token_type::COMMA) {
+        (void)tokenizer_.next();
+      }
+    }
+    (void)tokenizer_.next();
+  }
+
+  document_.attribute_blocks.push_back(
+      {begin, document_.attribute_pool.size(), no_attribute_block});
+  return document_.attribute_blocks.size() - 1;
+}
+
+inline std::size_t dot_parser::add_vertex(std::string_view dot_id,
+                                          members_t* members) {
+  const auto [it, inserted]{
+      vertex_indices_.try_emplace(dot_id, document_.vertex_ids.size())};
+  if (inserted) {
+    document_.vertex_ids.push_back(dot_id);
+    document_.vertex_attribute_blocks.push_back(no_attribute_block);
+  }
+
+  if (members) {
+    members->push_back(it->second);
+  }
+  return it->second;
+}
+
+inline dot_token dot_parser::expect(dot_token_type type,
+                                    std::string_view description) {
+  const auto token{tokenizer_.next()};
+  if (token.type != type) {
+    tokenizer_.fail(token, "expected " + std::string{description});
+  }
+  return token;
+}
+
+/**
+ * @brief Collects all attributes of a vertex or edge, in the order in which
+ * they appear in the input.
+ */
+inline void collect_attributes(const dot_document& document,
+                               std::size_t attribute_block,
+                               std::vector<std::size_t>& block_stack,
+                               dot_attributes& attributes) {
+  attributes.clear();
+
+  block_stack.clear();
+  for (auto block{attribute_block}; block != no_attribute_block;
+       block = document.attribute_blocks[block].previous_block) {
+    block_stack.push_back(block);
+  }
+
+  for (auto block{block_stack.rbegin()}; block != block_stack.rend();
+       ++block) {
+    const auto& [begin, end, _]{document.attribute_blocks[*block]};
+    for (auto index{begin}; index < end; ++index) {
+      const auto& [name, value]{document.attribute_pool[index]};
+      attributes.add(name, value);
+    }
+  }
+}
+
+template <typename V, typename E, graph_type T, typename VERTEX_READER_T,
+          typename EDGE_READER_T>
+[[nodiscard]] graph<V, E, T> read_dot(std::string_view input,
+                                      const VERTEX_READER_T& vertex_reader,
+                                      const EDGE_READER_T& edge_reader) {
+  const auto document{dot_parser{input}.parse()};
+
+  if (document.is_directed != (T == graph_type::DIRECTED)) {
+    throw std::invalid_argument{
+        document.is_directed
+            ? "Cannot read a digraph into an undirected graph."
+            : "Cannot read an undirected graph into a directed graph."};
+  }
+
+  graph_builder<graph<V, E, T>> builder{};
+  builder.reserve(document.vertex_ids.size(), document.edges.size());
+
+  dot_attributes attributes{};
+  std::vector<std::size_t> block_stack{};
+
+  for (std::size_t vertex_index{0}; vertex_index < document.vertex_ids.size();
+       ++vertex_index) {
+    collect_attributes(document, document.vertex_attribute_blocks[vertex_index],
+                       block_stack, attributes);
+    [[maybe_unused]] const auto builder_index{builder.add_vertex(
+        vertex_reader(document.vertex_ids[vertex_index], attributes))};
+  }
+
+  for (const auto& [vertex_index_lhs, vertex_index_rhs, attribute_block] :
+       document.edges) {
+    collect_attributes(document, attribute_block, block_stack, attributes);
+    // Vertex ids of the built graph equal the builder indices
+    builder.add_edge(
+        vertex_index_lhs, vertex_index_rhs,
+        edge_reader(edge_id_t{vertex_index_lhs, vertex_index_rhs}, attributes));
+  }
+
+  return std::move(builder).build();
+}
+
 }  // namespace detail
 
 template <typename V, typename E, graph_type T, typename VERTEX_WRITER_T,
@@ -71,29 +834,82 @@ template <typename V, typename E, graph_type T, typename VERTEX_WRITER_T,
                                  const typename graph<V, E, T>::edge_t&>
 void to_dot(const graph<V, E, T>& graph, const std::filesystem::path& path,
             const VERTEX_WRITER_T& vertex_writer,
-            const EDGE_WRITER_T& edge_writer) {
+            const EDGE_WRITER_T& edge_writer, const dot_options& options) {
   std::ofstream dot_file{path};
+  to_dot(graph, dot_file, vertex_writer, edge_writer, options);
+}
+
+template <typename V, typename E, graph_type T, typename VERTEX_WRITER_T,
+          typename EDGE_WRITER_T>
+  requires std::is_invocable_r_v<std::string, const VERTEX_WRITER_T&,
+                                 vertex_id_t, const V&> &&
+           std::is_invocable_r_v<std::string, const EDGE_WRITER_T&,
+                                 const graaf::edge_id_t&,
+                                 const typename graph<V, E, T>::edge_t&>
+void to_dot(const graph<V, E, T>& graph, std::ostream& stream,
+            const VERTEX_WRITER_T& vertex_writer,
+            const EDGE_WRITER_T& edge_writer, const dot_options& options) {
+  const auto sink{[&stream](std::string_view block) {
+    stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+  }};
 
-  const auto append_line{
-      [&dot_file](const std::string& line) { dot_file << line << std::endl; }};
+  detail::write_dot(graph, vertex_writer, edge_writer, options, sink);
+}
 
-  // TODO(bluppes): replace with std::format once Clang supports it
-  append_line(std::string(detail::graph_type_to_string(T)) + " {");
+template <typename V, typename E, graph_type T, typename OUTPUT_IT,
+          typename VERTEX_WRITER_T, typename EDGE_WRITER_T>
+  requires std::output_iterator<OUTPUT_IT, char> &&
+           std::is_invocable_r_v<std::string, const VERTEX_WRITER_T&,
+                                 vertex_id_t, const V&> &&
+           std::is_invocable_r_v<std::string, const EDGE_WRITER_T&,
+                                 const graaf::edge_id_t&,
+                                 const typename graph<V, E, T>::edge_t&>
+OUTPUT_IT to_dot(const graph<V, E, T>& graph, OUTPUT_IT output,
+                 const VERTEX_WRITER_T& vertex_writer,
+                 const EDGE_WRITER_T& edge_writer, const dot_options& options) {
+  const auto sink{[&output](std::string_view block) {
+    output = std::ranges::copy(block, std::move(output)).out;
+  }};
 
-  for (const auto& [vertex_id, vertex] : graph.get_vertices()) {
-    append_line("\t" + std::to_string(vertex_id) + " [" +
-                vertex_writer(vertex_id, vertex) + "];");
-  }
+  detail::write_dot(graph, vertex_writer, edge_writer, options, sink);
+  return output;
+}
 
-  const auto edge_specifier{detail::graph_type_to_edge_specifier(T)};
-  for (const auto& [edge_id, edge] : graph.get_edges()) {
-    const auto [source_id, target_id]{edge_id};
-    append_line("\t" + std::to_string(source_id) + " " + edge_specifier + " " +
-                std::to_string(target_id) + " [" + edge_writer(edge_id, edge) +
-                "];");
+inline std::optional<std::string_view> dot_attributes::get(
+    std::string_view name) const {
+  const auto attribute{std::ranges::find(
+      attributes_.rbegin(), attributes_.rend(), name, &attribute_t::first)};
+  if (attribute == attributes_.rend()) {
+    return std::nullopt;
   }
+  return attribute->second;
+}
+
+template <typename V, typename E, graph_type T, typename VERTEX_READER_T,
+          typename EDGE_READER_T>
+  requires std::is_invocable_r_v<V, const VERTEX_READER_T&, std::string_view,
+                                 const dot_attributes&> &&
+           std::is_invocable_r_v<E, const EDGE_READER_T&, const edge_id_t&,
+                                 const dot_attributes&>
+graph<V, E, T> from_dot(const std::filesystem::path& path,
+                        const VERTEX_READER_T& vertex_reader,
+                        const EDGE_READER_T& edge_reader) {
+  const detail::mapped_file dot_file{path};
+  return detail::read_dot<V, E, T>(dot_file.contents(), vertex_reader,
+                                   edge_reader);
+}
 
-  append_line("}");
+template <typename V, typename E, graph_type T, typename VERTEX_READER_T,
+          typename EDGE_READER_T>
+  requires std::is_invocable_r_v<V, const VERTEX_READER_T&, std::string_view,
+                                 const dot_attributes&> &&
+           std::is_invocable_r_v<E, const EDGE_READER_T&, const edge_id_t&,
+                                 const dot_attributes&>
+graph<V, E, T> from_dot(std::istream& stream,
+                        const VERTEX_READER_T& vertex_reader,
+                        const EDGE_READER_T& edge_reader) {
+  const auto dot_content{detail::read_stream(stream)};
+  return detail::read_dot<V, E, T>(dot_content, vertex_reader, edge_reader);
 }
 
-}  // namespace graaf::io
\ No newline at end of file
+}  // namespace graaf::io
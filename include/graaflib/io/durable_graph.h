@@ -0,0 +1,189 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace graaf::io {
+
+namespace detail {
+
+struct file_closer {
+  void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+};
+
+using file_handle = std::unique_ptr<std::FILE, file_closer>;
+
+}  // namespace detail
+
+/**
+ * @brief Options to tune the durability and recovery time of a durable_graph.
+ */
+struct durable_graph_options {
+  // Mutations are buffered in memory and appended to the log together, either
+  // once this many bytes are pending or when commit is called.
+  std::size_t group_commit_bytes{1 << 16};
+
+  // Once the log grows beyond this many bytes, the next commit writes a
+  // snapshot of the graph and starts a new log. This bounds the number of
+  // mutations replayed on recovery. Zero disables automatic snapshots.
+  std::size_t snapshot_threshold_bytes{std::size_t{1} << 26};
+
+  // Whether commits wait until the written data reached stable storage.
+  bool sync{true};
+};
+
+/**
+ * @brief A graph which records all mutations in a write-ahead log, such that
+ * its state can be recovered after a crash.
+ *
+ * The state is persisted in a directory as a snapshot of the graph plus a log
+ * of the mutations since that snapshot. Both are written in a compact binary
+ * form in the byte order of the host. Constructing a durable_graph loads the
+ * snapshot and replays the log, which is truncated at the first incomplete or
+ * corrupt record.
+ *
+ * Mutations are only durable once they are committed. Commits are grouped:
+ * buffered mutations are written and synced together, either explicitly
+ * through commit or once options.group_commit_bytes are pending.
+ *
+ * Vertices and edges are stored as their object representation, hence they
+ * must be trivially copyable.
+ *
+ * @tparam GRAPH_T The type of the underlying graph.
+ */
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+class durable_graph {
+ public:
+  using graph_t = GRAPH_T;
+  using vertex_t = typename GRAPH_T::vertex_t;
+  using edge_t = typename GRAPH_T::edge_t;
+
+  /**
+   * Open the durable graph stored in the given directory, recovering its
+   * state from the snapshot and the log. The directory is created if it does
+   * not exist.
+   *
+   * @param  directory The directory containing the snapshot and the log
+   * @param  options Options to tune durability and recovery time
+   * @throws invalid_argument - If the snapshot is corrupt
+   * @throws runtime_error - If the snapshot or log cannot be written
+   */
+  explicit durable_graph(std::filesystem::path directory,
+                         durable_graph_options options = {});
+
+  /**
+   * Attempts to commit pending mutations. Errors are ignored, call commit to
+   * find out whether mutations are durable.
+   */
+  ~durable_graph();
+
+  durable_graph(const durable_graph&) = delete;
+  durable_graph& operator=(const durable_graph&) = delete;
+
+  /**
+   * @return graph_t - The current state of the graph, including mutations
+   * which are not committed yet
+   */
+  [[nodiscard]] const graph_t& get_graph() const noexcept { return graph_; }
+
+  /**
+   * Add a vertex to the graph and log the mutation
+   *
+   * @param  vertex The vertex to be added
+   * @return vertices_id_t - The ID of the new vertex
+   */
+  [[nodiscard]] vertex_id_t add_vertex(auto&& vertex);
+
+  /**
+   * Remove a vertex from the graph and log the mutation
+   *
+   * @param  vertex_id - The ID of the vertex
+   */
+  void remove_vertex(vertex_id_t vertex_id);
+
+  /**
+   * Add a new edge between two existing vertices and log the mutation
+   *
+   * @param  vertex_id_lhs The ID of the first vertex
+   * @param  vertex_id_rhs The ID of the second vertex
+   * @param  edge The edge to be added
+   * @throws invalid_argument - If either of the vertices does not exist
+   */
+  void add_edge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs,
+                auto&& edge);
+
+  /**
+   * Remove the edge between two vertices and log the mutation
+   *
+   * @param  vertex_id_lhs The ID of the first vertex
+   * @param  vertex_id_rhs The ID of the second vertex
+   */
+  void remove_edge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs);
+
+  /**
+   * Append all pending mutations to the log and, if enabled, wait until they
+   * reached stable storage. Takes a snapshot once the log exceeds
+   * options.snapshot_threshold_bytes.
+   *
+   * @throws runtime_error - If the log cannot be written
+   */
+  void commit();
+
+  /**
+   * Write a snapshot of the current graph and start a new, empty log.
+   *
+   * @throws runtime_error - If the snapshot cannot be written
+   */
+  void snapshot();
+
+  /**
+   * @return size_t - Size in bytes of the log, including pending mutations
+   */
+  [[nodiscard]] std::size_t log_size() const noexcept {
+    return log_bytes_ + pending_.size();
+  }
+
+ private:
+  enum class operation : std::uint8_t {
+    ADD_VERTEX,
+    REMOVE_VERTEX,
+    ADD_EDGE,
+    REMOVE_EDGE
+  };
+
+  void load_snapshot();
+  void replay_log();
+  void apply_record(std::string_view payload);
+  void start_log();
+
+  void begin_record(operation op);
+  void end_record();
+  void write_pending();
+
+  std::filesystem::path directory_;
+  durable_graph_options options_;
+
+  graph_t graph_{};
+  vertex_id_t next_vertex_id_{0};
+  std::uint64_t generation_{0};
+
+  detail::file_handle log_file_{};
+  std::size_t log_bytes_{0};
+  std::string pending_{};
+  std::size_t record_begin_{0};
+};
+
+}  // namespace graaf::io
+
+#include "durable_graph.tpp"
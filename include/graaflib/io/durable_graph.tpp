@@ -0,0 +1,494 @@
+#pragma once
+
+#include <graaflib/io/common.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace graaf::io {
+
+namespace detail {
+
+inline constexpr std::string_view log_magic{"GRAAFLOG"};
+inline constexpr std::string_view snapshot_magic{"GRAAFSNP"};
+inline constexpr std::string_view log_file_name{"graph.log"};
+inline constexpr std::string_view snapshot_file_name{"graph.snapshot"};
+
+// Every log record is prefixed by the size and checksum of its payload
+inline constexpr std::size_t record_header_size{2 * sizeof(std::uint32_t)};
+
+inline constexpr auto crc32_table{[] {
+  std::array<std::uint32_t, 256> table{};
+  for (std::uint32_t index{0}; index < table.size(); ++index) {
+    std::uint32_t crc{index};
+    for (int bit{0}; bit < 8; ++bit) {
+      crc = (crc & 1) ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+    }
+    table[index] = crc;
+  }
+  return table;
+}()};
+
+/**
+ * @brief Computes the CRC-32 (IEEE 802.3) checksum of the data, optionally
+ * continuing from the checksum of preceding data.
+ */
+[[nodiscard]] inline std::uint32_t crc32(std::string_view data,
+                                         std::uint32_t crc = 0) noexcept {
+  crc = ~crc;
+  for (const char byte : data) {
+    crc = crc32_table[(crc ^ static_cast<unsigned char>(byte)) & 0xFF] ^
+          (crc >> 8);
+  }
+  return ~crc;
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+void append_binary(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Reads trivially copyable values from a binary buffer.
+ */
+class binary_reader {
+ public:
+  explicit binary_reader(std::string_view data) noexcept : data_{data} {}
+
+  [[nodiscard]] bool has_remaining(std::size_t size) const noexcept {
+    return data_.size() - position_ >= size;
+  }
+
+  [[nodiscard]] std::size_t position() const noexcept { return position_; }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  [[nodiscard]] T read() {
+    if (!has_remaining(sizeof(T))) {
+      throw std::invalid_argument{"Unexpected end of binary data."};
+    }
+    T value;
+    std::memcpy(&value, data_.data() + position_, sizeof(T));
+    position_ += sizeof(T);
+    return value;
+  }
+
+  [[nodiscard]] std::string_view read_bytes(std::size_t size) {
+    if (!has_remaining(size)) {
+      throw std::invalid_argument{"Unexpected end of binary data."};
+    }
+    const auto bytes{data_.substr(position_, size)};
+    position_ += size;
+    return bytes;
+  }
+
+ private:
+  std::string_view data_;
+  std::size_t position_{0};
+};
+
+[[nodiscard]] inline file_handle open_file(const std::filesystem::path& path,
+                                           const char* mode) {
+  file_handle file{std::fopen(path.c_str(), mode)};
+  if (!file) {
+    throw std::runtime_error{"Unable to open file [" + path.string() + "]."};
+  }
+  return file;
+}
+
+inline void write_file(std::FILE* file, std::string_view data) {
+  if (std::fwrite(data.data(), 1, data.size(), file) != data.size() ||
+      std::fflush(file) != 0) {
+    throw std::runtime_error{"Unable to write to file."};
+  }
+}
+
+/**
+ * @brief Waits until the written contents of the file reached stable storage.
+ */
+inline void sync_file([[maybe_unused]] std::FILE* file) {
+#if defined(__unix__) || defined(__APPLE__)
+  if (::fsync(::fileno(file)) != 0) {
+    throw std::runtime_error{"Unable to sync file."};
+  }
+#endif
+}
+
+/**
+ * @brief Waits until the entries of the directory, e.g. a renamed file,
+ * reached stable storage.
+ */
+inline void sync_directory(
+    [[maybe_unused]] const std::filesystem::path& directory) {
+#if defined(__unix__) || defined(__APPLE__)
+  const int file_descriptor{::open(directory.c_str(), O_RDONLY)};
+  if (file_descriptor >= 0) {
+    ::fsync(file_descriptor);
+    ::close(file_descriptor);
+  }
+#endif
+}
+
+}  // namespace detail
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+durable_graph<GRAPH_T>::durable_graph(std::filesystem::path directory,
+                                      durable_graph_options options)
+    : directory_{std::move(directory)}, options_{options} {
+  std::filesystem::create_directories(directory_);
+  load_snapshot();
+  replay_log();
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+durable_graph<GRAPH_T>::~durable_graph() {
+  try {
+    write_pending();
+  } catch (...) {
+    // Destructors must not throw, uncommitted mutations are lost
+  }
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+vertex_id_t durable_graph<GRAPH_T>::add_vertex(auto&& vertex) {
+  const auto vertex_id{graph_.add_vertex(std::forward<decltype(vertex)>(vertex),
+                                         next_vertex_id_)};
+  ++next_vertex_id_;
+
+  begin_record(operation::ADD_VERTEX);
+  detail::append_binary(pending_, std::uint64_t{vertex_id});
+  detail::append_binary(pending_, graph_.get_vertex(vertex_id));
+  end_record();
+  return vertex_id;
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::remove_vertex(vertex_id_t vertex_id) {
+  graph_.remove_vertex(vertex_id);
+
+  begin_record(operation::REMOVE_VERTEX);
+  detail::append_binary(pending_, std::uint64_t{vertex_id});
+  end_record();
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::add_edge(vertex_id_t vertex_id_lhs,
+                                      vertex_id_t vertex_id_rhs, auto&& edge) {
+  graph_.add_edge(vertex_id_lhs, vertex_id_rhs,
+                  std::forward<decltype(edge)>(edge));
+
+  begin_record(operation::ADD_EDGE);
+  detail::append_binary(pending_, std::uint64_t{vertex_id_lhs});
+  detail::append_binary(pending_, std::uint64_t{vertex_id_rhs});
+  detail::append_binary(pending_,
+                        graph_.get_edge(vertex_id_lhs, vertex_id_rhs));
+  end_record();
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::remove_edge(vertex_id_t vertex_id_lhs,
+                                         vertex_id_t vertex_id_rhs) {
+  graph_.remove_edge(vertex_id_lhs, vertex_id_rhs);
+
+  begin_record(operation::REMOVE_EDGE);
+  detail::append_binary(pending_, std::uint64_t{vertex_id_lhs});
+  detail::append_binary(pending_, std::uint64_t{vertex_id_rhs});
+  end_record();
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::commit() {
+  write_pending();
+  if (options_.sync) {
+    detail::sync_file(log_file_.get());
+  }
+
+  if (options_.snapshot_threshold_bytes > 0 &&
+      log_bytes_ >= options_.snapshot_threshold_bytes) {
+    snapshot();
+  }
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::snapshot() {
+  // Mutations in the current log are included in the snapshot, which belongs
+  // to the next generation. A log of an older generation is ignored during
+  // recovery, so a crash at any point leaves a consistent state behind.
+  write_pending();
+  const auto generation{generation_ + 1};
+
+  const auto snapshot_path{directory_ / detail::snapshot_file_name};
+  auto temporary_path{snapshot_path};
+  temporary_path += ".tmp";
+  auto file{detail::open_file(temporary_path, "wb")};
+  detail::write_file(file.get(), detail::snapshot_magic);
+
+  // The checksum covers everything following the magic
+  std::uint32_t crc{0};
+  std::string buffer{};
+  const auto write_block{[&crc, &buffer, &file]() {
+    crc = detail::crc32(buffer, crc);
+    detail::write_file(file.get(), buffer);
+    buffer.clear();
+  }};
+
+  detail::append_binary(buffer, generation);
+  detail::append_binary(buffer, std::uint64_t{next_vertex_id_});
+  detail::append_binary(buffer, std::uint64_t{graph_.vertex_count()});
+  detail::append_binary(buffer, std::uint64_t{graph_.edge_count()});
+
+  for (const auto& [vertex_id, vertex] : graph_.get_vertices()) {
+    detail::append_binary(buffer, std::uint64_t{vertex_id});
+    detail::append_binary(buffer, vertex);
+    if (buffer.size() >= detail::output_buffer_size) {
+      write_block();
+    }
+  }
+  for (const auto& [edge_id, edge] : graph_.get_edges()) {
+    detail::append_binary(buffer, std::uint64_t{edge_id.first});
+    detail::append_binary(buffer, std::uint64_t{edge_id.second});
+    detail::append_binary(buffer, edge);
+    if (buffer.size() >= detail::output_buffer_size) {
+      write_block();
+    }
+  }
+  write_block();
+  detail::append_binary(buffer, crc);
+  detail::write_file(file.get(), buffer);
+
+  if (options_.sync) {
+    detail::sync_file(file.get());
+  }
+  file.reset();
+
+  std::filesystem::rename(temporary_path, snapshot_path);
+  if (options_.sync) {
+    detail::sync_directory(directory_);
+  }
+
+  generation_ = generation;
+  start_log();
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::load_snapshot() {
+  const auto snapshot_path{directory_ / detail::snapshot_file_name};
+  if (!std::filesystem::exists(snapshot_path)) {
+    return;
+  }
+
+  const detail::mapped_file file{snapshot_path};
+  const auto contents{file.contents()};
+  const auto is_valid{[contents]() {
+    constexpr auto overhead{detail::snapshot_magic.size() +
+                            sizeof(std::uint32_t)};
+    if (!contents.starts_with(detail::snapshot_magic) ||
+        contents.size() < overhead) {
+      return false;
+    }
+    const auto body{contents.substr(detail::snapshot_magic.size(),
+                                    contents.size() - overhead)};
+    std::uint32_t crc{};
+    std::memcpy(&crc, contents.data() + contents.size() - sizeof(crc),
+                sizeof(crc));
+    return detail::crc32(body) == crc;
+  }};
+  if (!is_valid()) {
+    throw std::invalid_argument{"Corrupt snapshot [" + snapshot_path.string() +
+                                "]."};
+  }
+
+  detail::binary_reader reader{contents.substr(detail::snapshot_magic.size())};
+  generation_ = reader.read<std::uint64_t>();
+  next_vertex_id_ = reader.read<std::uint64_t>();
+  const auto vertex_count{reader.read<std::uint64_t>()};
+  const auto edge_count{reader.read<std::uint64_t>()};
+
+  graph_.reserve(vertex_count, edge_count);
+  for (std::uint64_t vertex{0}; vertex < vertex_count; ++vertex) {
+    const auto vertex_id{reader.read<std::uint64_t>()};
+    [[maybe_unused]] const auto added_vertex_id{graph_.add_vertex(
+        reader.read<vertex_t>(), vertex_id)};
+  }
+  for (std::uint64_t edge{0}; edge < edge_count; ++edge) {
+    const auto vertex_id_lhs{reader.read<std::uint64_t>()};
+    const auto vertex_id_rhs{reader.read<std::uint64_t>()};
+    graph_.add_edge(vertex_id_lhs, vertex_id_rhs,
+                    reader.read<edge_t>());
+  }
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::replay_log() {
+  const auto log_path{directory_ / detail::log_file_name};
+  if (!std::filesystem::exists(log_path)) {
+    start_log();
+    return;
+  }
+
+  std::size_t valid_size{0};
+  {
+    const detail::mapped_file file{log_path};
+    const auto contents{file.contents()};
+    detail::binary_reader reader{contents};
+
+    // A log of another generation is already contained in the snapshot
+    if (!contents.starts_with(detail::log_magic) ||
+        !reader.has_remaining(detail::log_magic.size() +
+                              sizeof(std::uint64_t))) {
+      start_log();
+      return;
+    }
+    [[maybe_unused]] const auto magic{
+        reader.read_bytes(detail::log_magic.size())};
+    if (reader.read<std::uint64_t>() != generation_) {
+      start_log();
+      return;
+    }
+
+    // Replay up to the first incomplete or corrupt record, which is the
+    // remainder of a write interrupted by a crash
+    valid_size = reader.position();
+    while (reader.has_remaining(detail::record_header_size)) {
+      const auto payload_size{reader.read<std::uint32_t>()};
+      const auto crc{reader.read<std::uint32_t>()};
+      if (payload_size == 0 || !reader.has_remaining(payload_size)) {
+        break;
+      }
+      const auto payload{reader.read_bytes(payload_size)};
+      if (detail::crc32(payload) != crc) {
+        break;
+      }
+
+      apply_record(payload);
+      valid_size = reader.position();
+    }
+  }
+
+  std::filesystem::resize_file(log_path, valid_size);
+  log_file_ = detail::open_file(log_path, "ab");
+  log_bytes_ = valid_size;
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::apply_record(std::string_view payload) {
+  detail::binary_reader reader{payload};
+  const auto op{reader.read<operation>()};
+
+  switch (op) {
+    case operation::ADD_VERTEX: {
+      const auto vertex_id{reader.read<std::uint64_t>()};
+      [[maybe_unused]] const auto added_vertex_id{
+          graph_.add_vertex(reader.read<vertex_t>(), vertex_id)};
+      next_vertex_id_ = std::max<vertex_id_t>(next_vertex_id_, vertex_id + 1);
+      break;
+    }
+    case operation::REMOVE_VERTEX:
+      graph_.remove_vertex(reader.read<std::uint64_t>());
+      break;
+    case operation::ADD_EDGE: {
+      const auto vertex_id_lhs{reader.read<std::uint64_t>()};
+      const auto vertex_id_rhs{reader.read<std::uint64_t>()};
+      graph_.add_edge(vertex_id_lhs, vertex_id_rhs,
+                      reader.read<edge_t>());
+      break;
+    }
+    case operation::REMOVE_EDGE: {
+      const auto vertex_id_lhs{reader.read<std::uint64_t>()};
+      const auto vertex_id_rhs{reader.read<std::uint64_t>()};
+      graph_.remove_edge(vertex_id_lhs, vertex_id_rhs);
+      break;
+    }
+    default:
+      throw std::invalid_argument{"Unknown operation in log."};
+  }
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::start_log() {
+  std::string header{detail::log_magic};
+  detail::append_binary(header, generation_);
+
+  log_file_ = detail::open_file(directory_ / detail::log_file_name, "wb");
+  detail::write_file(log_file_.get(), header);
+  if (options_.sync) {
+    detail::sync_file(log_file_.get());
+  }
+  log_bytes_ = header.size();
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::begin_record(operation op) {
+  // The header is filled in once the payload is complete
+  record_begin_ = pending_.size();
+  pending_.append(detail::record_header_size, '\0');
+  detail::append_binary(pending_, op);
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::end_record() {
+  const auto payload_begin{record_begin_ + detail::record_header_size};
+  const auto payload{std::string_view{pending_}.substr(payload_begin)};
+  const auto payload_size{static_cast<std::uint32_t>(payload.size())};
+  const auto crc{detail::crc32(payload)};
+
+  std::memcpy(pending_.data() + record_begin_, &payload_size,
+              sizeof(payload_size));
+  std::memcpy(pending_.data() + record_begin_ + sizeof(payload_size), &crc,
+              sizeof(crc));
+
+  if (pending_.size() >= options_.group_commit_bytes) {
+    commit();
+  }
+}
+
+template <typename GRAPH_T>
+  requires std::is_trivially_copyable_v<typename GRAPH_T::vertex_t> &&
+           std::is_trivially_copyable_v<typename GRAPH_T::edge_t>
+void durable_graph<GRAPH_T>::write_pending() {
+  if (pending_.empty()) {
+    return;
+  }
+  detail::write_file(log_file_.get(), pending_);
+  log_bytes_ += pending_.size();
+  pending_.clear();
+}
+
+}  // namespace graaf::io
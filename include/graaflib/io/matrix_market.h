@@ -0,0 +1,71 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/io/common.h>
+
+#include <concepts>
+#include <filesystem>
+#include <istream>
+#include <ostream>
+
+namespace graaf::io {
+
+/**
+ * @brief Serializes a graph in Matrix Market coordinate format and writes the
+ * result to a file.
+ *
+ * Directed graphs are written as general matrices, undirected graphs as
+ * symmetric matrices containing only the lower triangle. Vertices are numbered
+ * 1..n in order of increasing vertex id. Edge weights are obtained through
+ * graaf::get_weight; graphs with edges without a weight are written as pattern
+ * matrices.
+ *
+ * @param graph The graph we want to serialize.
+ * @param path Path to the output file.
+ */
+template <typename V, typename E, graph_type T>
+void to_matrix_market(const graph<V, E, T>& graph,
+                      const std::filesystem::path& path);
+
+/**
+ * @brief Serializes a graph in Matrix Market coordinate format and writes the
+ * result to a stream.
+ *
+ * @see to_matrix_market(graph, path)
+ */
+template <typename V, typename E, graph_type T>
+void to_matrix_market(const graph<V, E, T>& graph, std::ostream& stream);
+
+/**
+ * @brief Reads a graph from a file in Matrix Market coordinate format.
+ *
+ * The matrix must be square. Entry (i, j) becomes an edge between the vertices
+ * with ids i - 1 and j - 1, all vertices are default constructed. Symmetric
+ * matrices read into a directed graph yield edges in both directions. Pattern
+ * matrices yield edges with a unit weight.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph, the entries are parsed as an E.
+ * @tparam T The graph type (directed or undirected).
+ * @param path Path to the input file.
+ * @return graph<V, E, T> The graph read from the file.
+ * @throws invalid_argument - If the file cannot be read, is not valid Matrix
+ * Market or uses an unsupported field or symmetry.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+[[nodiscard]] graph<V, E, T> from_matrix_market(
+    const std::filesystem::path& path);
+
+/**
+ * @brief Reads a graph in Matrix Market coordinate format from a stream.
+ *
+ * @see from_matrix_market(path)
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+[[nodiscard]] graph<V, E, T> from_matrix_market(std::istream& stream);
+
+}  // namespace graaf::io
+
+#include "matrix_market.tpp"
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <graaflib/graph_builder.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace graaf::io {
+
+namespace detail {
+
+[[nodiscard]] inline bool is_matrix_market_keyword(std::string_view field,
+                                                   std::string_view keyword) {
+  // Matrix Market header keywords are case-independent
+  return std::ranges::equal(field, keyword, [](char lhs, char rhs) {
+    return std::tolower(static_cast<unsigned char>(lhs)) == rhs;
+  });
+}
+
+template <typename V, typename E, graph_type T>
+void write_matrix_market(const graph<V, E, T>& graph, std::ostream& stream) {
+  using weight_t = decltype(get_weight(std::declval<const E&>()));
+
+  std::string buffer{"%%MatrixMarket matrix coordinate "};
+  if constexpr (!graaf::detail::has_edge_weight<E>) {
+    buffer += "pattern";
+  } else if constexpr (std::is_integral_v<weight_t>) {
+    buffer += "integer";
+  } else {
+    buffer += "real";
+  }
+  buffer += T == graph_type::DIRECTED ? " general\n" : " symmetric\n";
+
+  const auto vertex_count{graph.vertex_count()};
+  append_integral(buffer, vertex_count);
+  buffer += ' ';
+  append_integral(buffer, vertex_count);
+  buffer += ' ';
+  append_integral(buffer, graph.edge_count());
+  buffer += '\n';
+
+  const vertex_index_map index_map{graph};
+  for (const auto& [edge_id, edge] : graph.get_edges()) {
+    auto row{index_map.index_of(edge_id.first) + 1};
+    auto column{index_map.index_of(edge_id.second) + 1};
+    if constexpr (T == graph_type::UNDIRECTED) {
+      // Symmetric matrices only store the lower triangle
+      if (row < column) {
+        std::swap(row, column);
+      }
+    }
+
+    append_integral(buffer, row);
+    buffer += ' ';
+    append_integral(buffer, column);
+    if constexpr (graaf::detail::has_edge_weight<E>) {
+      buffer += ' ';
+      append_number(buffer, get_weight(edge));
+    }
+    buffer += '\n';
+    write_if_full(stream, buffer);
+  }
+  write_buffer(stream, buffer);
+}
+
+/**
+ * @brief Advances the tokenizer to the next line which is neither a comment
+ * nor empty.
+ */
+[[nodiscard]] inline bool next_matrix_market_line(line_tokenizer& tokenizer) {
+  while (tokenizer.next_line()) {
+    if (!tokenizer.at_end_of_line() && !tokenizer.line().starts_with('%')) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename V, typename E, graph_type T>
+[[nodiscard]] graph<V, E, T> read_matrix_market(std::string_view input) {
+  line_tokenizer tokenizer{input, "Matrix Market"};
+
+  const auto header_field{[&tokenizer]() {
+    const auto field{tokenizer.next_field()};
+    if (!field) {
+      tokenizer.fail("incomplete header.");
+    }
+    return *field;
+  }};
+
+  if (!tokenizer.next_line() ||
+      !is_matrix_market_keyword(header_field(), "%%matrixmarket") ||
+      !is_matrix_market_keyword(header_field(), "matrix")) {
+    tokenizer.fail("expected '%%MatrixMarket matrix' header.");
+  }
+  if (!is_matrix_market_keyword(header_field(), "coordinate")) {
+    tokenizer.fail("only the coordinate format is supported.");
+  }
+
+  const auto field{header_field()};
+  const bool is_pattern{is_matrix_market_keyword(field, "pattern")};
+  if (!is_pattern && !is_matrix_market_keyword(field, "real") &&
+      !is_matrix_market_keyword(field, "double") &&
+      !is_matrix_market_keyword(field, "integer")) {
+    tokenizer.fail("unsupported field [" + std::string{field} + "].");
+  }
+
+  const auto symmetry{header_field()};
+  const bool is_symmetric{is_matrix_market_keyword(symmetry, "symmetric")};
+  if (!is_symmetric && !is_matrix_market_keyword(symmetry, "general")) {
+    tokenizer.fail("unsupported symmetry [" + std::string{symmetry} + "].");
+  }
+
+  if (!next_matrix_market_line(tokenizer)) {
+    tokenizer.fail("missing size line.");
+  }
+  const auto row_count{tokenizer.next_number<std::size_t>()};
+  const auto column_count{tokenizer.next_number<std::size_t>()};
+  const auto entry_count{tokenizer.next_number<std::size_t>()};
+  if (row_count != column_count) {
+    tokenizer.fail("the matrix must be square to describe a graph.");
+  }
+
+  // A symmetric matrix read into a directed graph yields an edge per direction
+  const bool add_reverse_edges{is_symmetric && T == graph_type::DIRECTED};
+
+  graph_builder<graph<V, E, T>> builder{};
+  builder.reserve(row_count, add_reverse_edges ? 2 * entry_count : entry_count);
+  for (std::size_t vertex_index{0}; vertex_index < row_count; ++vertex_index) {
+    [[maybe_unused]] const auto builder_index{builder.add_vertex(V{})};
+  }
+
+  const auto read_vertex_index{[&tokenizer, row_count]() {
+    const auto index{tokenizer.next_number<std::size_t>()};
+    if (index == 0 || index > row_count) {
+      tokenizer.fail("index [" + std::to_string(index) + "] out of range.");
+    }
+    return index - 1;
+  }};
+
+  std::size_t entries_read{0};
+  while (next_matrix_market_line(tokenizer)) {
+    if (++entries_read > entry_count) {
+      tokenizer.fail("more entries than declared in the size line.");
+    }
+
+    const auto vertex_index_lhs{read_vertex_index()};
+    const auto vertex_index_rhs{read_vertex_index()};
+    const E edge{is_pattern ? E{1} : tokenizer.next_number<E>()};
+    if (!tokenizer.at_end_of_line()) {
+      tokenizer.fail("expected end of line.");
+    }
+
+    if (add_reverse_edges && vertex_index_lhs != vertex_index_rhs) {
+      builder.add_edge(vertex_index_rhs, vertex_index_lhs, edge);
+    }
+    builder.add_edge(vertex_index_lhs, vertex_index_rhs, edge);
+  }
+
+  if (entries_read != entry_count) {
+    tokenizer.fail("expected " + std::to_string(entry_count) +
+                   " entries, found " + std::to_string(entries_read) + ".");
+  }
+
+  return std::move(builder).build();
+}
+
+}  // namespace detail
+
+template <typename V, typename E, graph_type T>
+void to_matrix_market(const graph<V, E, T>& graph,
+                      const std::filesystem::path& path) {
+  std::ofstream file{path};
+  to_matrix_market(graph, file);
+}
+
+template <typename V, typename E, graph_type T>
+void to_matrix_market(const graph<V, E, T>& graph, std::ostream& stream) {
+  detail::write_matrix_market(graph, stream);
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+graph<V, E, T> from_matrix_market(const std::filesystem::path& path) {
+  const detail::mapped_file file{path};
+  return detail::read_matrix_market<V, E, T>(file.contents());
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+graph<V, E, T> from_matrix_market(std::istream& stream) {
+  const auto contents{detail::read_stream(stream)};
+  return detail::read_matrix_market<V, E, T>(contents);
+}
+
+}  // namespace graaf::io
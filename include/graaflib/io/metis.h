@@ -0,0 +1,73 @@
+#pragma once
+
+#include <graaflib/graph.h>
+#include <graaflib/io/common.h>
+
+#include <concepts>
+#include <filesystem>
+#include <istream>
+#include <ostream>
+
+namespace graaf::io {
+
+/**
+ * @brief Serializes an undirected graph in METIS adjacency format and writes
+ * the result to a file.
+ *
+ * Vertices are numbered 1..n in order of increasing vertex id. METIS weights
+ * are non-negative integers, so integral vertices are written as vertex
+ * weights and integral edge weights, obtained through graaf::get_weight, as
+ * edge weights. Graphs with other vertex or edge types, e.g. floating point
+ * weights, are written without vertex or edge weights respectively.
+ *
+ * @param graph The graph we want to serialize.
+ * @param path Path to the output file.
+ * @throws invalid_argument - If the graph contains self loops or negative
+ * weights, which the format does not support.
+ */
+template <typename V, typename E>
+void to_metis(const graph<V, E, graph_type::UNDIRECTED>& graph,
+              const std::filesystem::path& path);
+
+/**
+ * @brief Serializes an undirected graph in METIS adjacency format and writes
+ * the result to a stream.
+ *
+ * @see to_metis(graph, path)
+ */
+template <typename V, typename E>
+void to_metis(const graph<V, E, graph_type::UNDIRECTED>& graph,
+              std::ostream& stream);
+
+/**
+ * @brief Reads a graph from a file in METIS adjacency format.
+ *
+ * The i-th vertex line describes the vertex with id i - 1. When the file
+ * contains vertex weights and V is arithmetic, the first vertex weight is used
+ * as the vertex, otherwise vertices are default constructed. Edges without a
+ * weight are given a unit weight. Read into a directed graph, each undirected
+ * edge yields an edge in both directions.
+ *
+ * @tparam V The vertex type of the graph.
+ * @tparam E The edge type of the graph, edge weights are parsed as an E.
+ * @tparam T The graph type (directed or undirected).
+ * @param path Path to the input file.
+ * @return graph<V, E, T> The graph read from the file.
+ * @throws invalid_argument - If the file cannot be read or is not valid METIS.
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+[[nodiscard]] graph<V, E, T> from_metis(const std::filesystem::path& path);
+
+/**
+ * @brief Reads a graph in METIS adjacency format from a stream.
+ *
+ * @see from_metis(path)
+ */
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+[[nodiscard]] graph<V, E, T> from_metis(std::istream& stream);
+
+}  // namespace graaf::io
+
+#include "metis.tpp"
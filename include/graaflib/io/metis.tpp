@@ -0,0 +1,240 @@
+#pragma once
+
+#include <graaflib/graph_builder.h>
+
+#include <concepts>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace graaf::io {
+
+namespace detail {
+
+// METIS weights are non-negative integers
+template <typename T>
+concept metis_weight = std::integral<T> && !std::is_same_v<T, bool>;
+
+template <metis_weight T>
+void check_metis_weight(T weight, std::string_view element) {
+  if constexpr (std::is_signed_v<T>) {
+    if (weight < 0) {
+      throw std::invalid_argument{
+          "The METIS format does not support negative weights, found [" +
+          std::to_string(weight) + "] on " + std::string{element} + "."};
+    }
+  }
+}
+
+template <typename V, typename E>
+void write_metis(const graph<V, E, graph_type::UNDIRECTED>& graph,
+                 std::ostream& stream) {
+  constexpr bool has_vertex_weights{metis_weight<V>};
+  constexpr bool has_edge_weights{
+      graaf::detail::has_edge_weight<E> &&
+      metis_weight<decltype(get_weight(std::declval<E>()))>};
+
+  std::string buffer{};
+  append_integral(buffer, graph.vertex_count());
+  buffer += ' ';
+  append_integral(buffer, graph.edge_count());
+  if constexpr (has_vertex_weights || has_edge_weights) {
+    buffer += has_vertex_weights ? " 01" : " 00";
+    buffer += has_edge_weights ? '1' : '0';
+  }
+  buffer += '\n';
+
+  const vertex_index_map index_map{graph};
+  for (const auto vertex_id : index_map.vertex_ids()) {
+    // Separates the fields of the line, without a leading space
+    bool is_first_field{true};
+    const auto append_field{[&buffer, &is_first_field](auto value) {
+      if (!is_first_field) {
+        buffer += ' ';
+      }
+      append_number(buffer, value);
+      is_first_field = false;
+    }};
+
+    if constexpr (has_vertex_weights) {
+      const auto& vertex_weight{graph.get_vertex(vertex_id)};
+      check_metis_weight(vertex_weight,
+                         "vertex [" + std::to_string(vertex_id) + "]");
+      append_field(vertex_weight);
+    }
+
+    for (const auto neighbor_id : graph.get_neighbors(vertex_id)) {
+      if (neighbor_id == vertex_id) {
+        throw std::invalid_argument{
+            "The METIS format does not support self loops, found one on "
+            "vertex [" +
+            std::to_string(vertex_id) + "]."};
+      }
+
+      append_field(index_map.index_of(neighbor_id) + 1);
+      if constexpr (has_edge_weights) {
+        const auto edge_weight{
+            get_weight(graph.get_edge(vertex_id, neighbor_id))};
+        check_metis_weight(edge_weight, "the edge between vertices [" +
+                                            std::to_string(vertex_id) +
+                                            "] and [" +
+                                            std::to_string(neighbor_id) + "]");
+        append_field(edge_weight);
+      }
+    }
+    buffer += '\n';
+    write_if_full(stream, buffer);
+  }
+  write_buffer(stream, buffer);
+}
+
+/**
+ * @brief Advances the tokenizer to the next line which is not a comment. In
+ * contrast to other formats, empty lines are significant in METIS files: they
+ * describe vertices without neighbors.
+ */
+[[nodiscard]] inline bool next_metis_line(line_tokenizer& tokenizer) {
+  while (tokenizer.next_line()) {
+    if (!tokenizer.line().starts_with('%')) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename V, typename E, graph_type T>
+[[nodiscard]] graph<V, E, T> read_metis(std::string_view input) {
+  line_tokenizer tokenizer{input, "METIS"};
+
+  if (!next_metis_line(tokenizer) || tokenizer.at_end_of_line()) {
+    tokenizer.fail("missing header.");
+  }
+  const auto vertex_count{tokenizer.next_number<std::size_t>()};
+  const auto edge_count{tokenizer.next_number<std::size_t>()};
+
+  // The format code is up to three binary digits: vertex sizes, vertex
+  // weights and edge weights, where leading zeros may be omitted
+  std::string_view format{};
+  if (const auto format_field{tokenizer.next_field()}) {
+    format = *format_field;
+    if (format.size() > 3 || format.find_first_not_of("01") != format.npos) {
+      tokenizer.fail("invalid format code [" + std::string{format} + "].");
+    }
+  }
+  const auto has_format_flag{[format](std::size_t digit) {
+    return format.size() > digit && format[format.size() - 1 - digit] == '1';
+  }};
+  const bool has_edge_weights{has_format_flag(0)};
+  const bool has_vertex_weights{has_format_flag(1)};
+  const bool has_vertex_sizes{has_format_flag(2)};
+
+  const auto constraint_count{tokenizer.at_end_of_line()
+                                  ? std::size_t{has_vertex_weights ? 1U : 0U}
+                                  : tokenizer.next_number<std::size_t>()};
+  if (!tokenizer.at_end_of_line()) {
+    tokenizer.fail("expected end of line.");
+  }
+
+  // Every undirected edge is listed by both of its endpoints. Adjacency lists
+  // may refer to vertices described later on, so all vertices are added first
+  graph_builder<graph<V, E, T>> builder{};
+  builder.reserve(vertex_count,
+                  T == graph_type::DIRECTED ? 2 * edge_count : edge_count);
+  for (std::size_t vertex_index{0}; vertex_index < vertex_count;
+       ++vertex_index) {
+    [[maybe_unused]] const auto builder_index{builder.add_vertex(V{})};
+  }
+
+  std::size_t adjacency_count{0};
+  for (std::size_t vertex_index{0}; vertex_index < vertex_count;
+       ++vertex_index) {
+    if (!next_metis_line(tokenizer)) {
+      tokenizer.fail("expected " + std::to_string(vertex_count) +
+                     " vertex lines, found " + std::to_string(vertex_index) +
+                     ".");
+    }
+
+    if (has_vertex_sizes) {
+      [[maybe_unused]] const auto vertex_size{
+          tokenizer.next_number<std::size_t>()};
+    }
+    for (std::size_t constraint{0}; constraint < constraint_count;
+         ++constraint) {
+      // Only the first vertex weight is kept
+      if constexpr (string_parsable<V>) {
+        const auto vertex_weight{tokenizer.next_number<V>()};
+        if (constraint == 0) {
+          builder.get_vertex(vertex_index) = vertex_weight;
+        }
+      } else {
+        [[maybe_unused]] const auto vertex_weight{
+            tokenizer.next_number<double>()};
+      }
+    }
+
+    while (!tokenizer.at_end_of_line()) {
+      const auto neighbor{tokenizer.next_number<std::size_t>()};
+      if (neighbor == 0 || neighbor > vertex_count) {
+        tokenizer.fail("vertex [" + std::to_string(neighbor) +
+                       "] out of range.");
+      }
+      if (neighbor - 1 == vertex_index) {
+        tokenizer.fail("self loops are not allowed.");
+      }
+      const E edge{has_edge_weights ? tokenizer.next_number<E>() : E{1}};
+      ++adjacency_count;
+
+      if (T == graph_type::DIRECTED || neighbor - 1 > vertex_index) {
+        builder.add_edge(vertex_index, neighbor - 1, edge);
+      }
+    }
+  }
+
+  while (next_metis_line(tokenizer)) {
+    if (!tokenizer.at_end_of_line()) {
+      tokenizer.fail("more vertex lines than declared in the header.");
+    }
+  }
+  if (adjacency_count != 2 * edge_count) {
+    throw std::invalid_argument{
+        "Invalid METIS input: expected " + std::to_string(edge_count) +
+        " edges listed by both endpoints, found " +
+        std::to_string(adjacency_count) + " adjacencies."};
+  }
+
+  return std::move(builder).build();
+}
+
+}  // namespace detail
+
+template <typename V, typename E>
+void to_metis(const graph<V, E, graph_type::UNDIRECTED>& graph,
+              const std::filesystem::path& path) {
+  std::ofstream file{path};
+  to_metis(graph, file);
+}
+
+template <typename V, typename E>
+void to_metis(const graph<V, E, graph_type::UNDIRECTED>& graph,
+              std::ostream& stream) {
+  detail::write_metis(graph, stream);
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+graph<V, E, T> from_metis(const std::filesystem::path& path) {
+  const detail::mapped_file file{path};
+  return detail::read_metis<V, E, T>(file.contents());
+}
+
+template <typename V, typename E, graph_type T>
+  requires std::default_initializable<V> && detail::string_parsable<E>
+graph<V, E, T> from_metis(std::istream& stream) {
+  const auto contents{detail::read_stream(stream)};
+  return detail::read_metis<V, E, T>(contents);
+}
+
+}  // namespace graaf::io
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <graaflib/csr_graph.h>
+#include <graaflib/execution_policy.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace graaf::properties {
+
+/**
+ * Counts the triangles of an undirected graph in compressed sparse row
+ * format, i.e. the sets of three vertices which are pairwise adjacent.
+ *
+ * Every edge is oriented from the vertex of lower degree to the vertex of
+ * higher degree, ties broken by index, which leaves every vertex with at most
+ * O(sqrt|E|) outgoing edges. Every triangle is then found exactly once, as a
+ * common outgoing neighbor of the two ends of one of its oriented edges, by
+ * intersecting their sorted neighbors. This takes O(|E| sqrt|E|) time and
+ * O(|V| + |E|) additional memory. Self loops are ignored.
+ *
+ * @param graph The graph to count the triangles of.
+ * @return size_t - The number of triangles.
+ */
+template <typename V, typename E>
+[[nodiscard]] std::size_t triangle_count(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * Counts the triangles of a graph with the given execution policy. With a
+ * parallel policy, the vertices are processed in parallel on the
+ * default_executor.
+ *
+ * @param policy The execution policy, e.g. graaf::execution::par.
+ * @see triangle_count
+ */
+template <execution_policy POLICY_T, typename V, typename E>
+[[nodiscard]] std::size_t triangle_count(
+    POLICY_T&& policy, const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * Converts the graph to compressed sparse row format and counts its
+ * triangles. To compute several properties of the same graph, convert it once
+ * with make_csr_graph instead.
+ *
+ * @see triangle_count
+ */
+template <typename V, typename E>
+[[nodiscard]] std::size_t triangle_count(
+    const graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * Counts the triangles every vertex of a graph is part of.
+ *
+ * @return The number of triangles of every vertex, indexed by the index of
+ * the vertex in the csr_graph.
+ * @see triangle_count
+ */
+template <typename V, typename E>
+[[nodiscard]] std::vector<std::size_t> vertex_triangle_counts(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * @see vertex_triangle_counts
+ */
+template <execution_policy POLICY_T, typename V, typename E>
+[[nodiscard]] std::vector<std::size_t> vertex_triangle_counts(
+    POLICY_T&& policy, const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * @return An unordered_map from every vertex to the number of triangles it is
+ * part of.
+ * @see vertex_triangle_counts
+ */
+template <typename V, typename E>
+[[nodiscard]] std::unordered_map<vertex_id_t, std::size_t>
+vertex_triangle_counts(const graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * Computes the local clustering coefficient of every vertex of a graph: the
+ * fraction of the pairs of its neighbors which are adjacent themselves.
+ * Vertices with fewer than two neighbors have a coefficient of zero.
+ *
+ * @return The coefficient of every vertex, indexed by the index of the vertex
+ * in the csr_graph.
+ * @see vertex_triangle_counts
+ */
+template <typename V, typename E>
+[[nodiscard]] std::vector<double> local_clustering_coefficients(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * @see local_clustering_coefficients
+ */
+template <execution_policy POLICY_T, typename V, typename E>
+[[nodiscard]] std::vector<double> local_clustering_coefficients(
+    POLICY_T&& policy, const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * @return An unordered_map from every vertex to its local clustering
+ * coefficient.
+ * @see local_clustering_coefficients
+ */
+template <typename V, typename E>
+[[nodiscard]] std::unordered_map<vertex_id_t, double>
+local_clustering_coefficients(const graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * Computes the global clustering coefficient, or transitivity, of a graph:
+ * three times the number of triangles divided by the number of paths of
+ * length two. A graph without such paths has a coefficient of zero.
+ *
+ * @see triangle_count
+ */
+template <typename V, typename E>
+[[nodiscard]] double global_clustering_coefficient(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * @see global_clustering_coefficient
+ */
+template <execution_policy POLICY_T, typename V, typename E>
+[[nodiscard]] double global_clustering_coefficient(
+    POLICY_T&& policy, const csr_graph<V, E, graph_type::UNDIRECTED>& graph);
+
+/**
+ * @see global_clustering_coefficient
+ */
+template <typename V, typename E>
+[[nodiscard]] double global_clustering_coefficient(
+    const graph<V, E, graph_type::UNDIRECTED>& graph);
+
+}  // namespace graaf::properties
+
+#include "triangle_properties.tpp"
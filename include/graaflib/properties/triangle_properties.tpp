@@ -0,0 +1,363 @@
+#pragma once
+
+#include <graaflib/executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <span>
+
+namespace graaf::properties {
+
+namespace detail {
+
+/**
+ * @brief The edges of an undirected graph, each oriented from the vertex
+ * which comes first in the order by degree to the other one. The neighbors of
+ * every vertex are sorted by index.
+ */
+struct oriented_adjacency {
+  std::vector<std::size_t> offsets{};
+  std::vector<std::size_t> targets{};
+
+  [[nodiscard]] std::span<const std::size_t> neighbors(
+      std::size_t index) const noexcept {
+    return {targets.data() + offsets[index],
+            offsets[index + 1] - offsets[index]};
+  }
+};
+
+template <typename V, typename E>
+[[nodiscard]] oriented_adjacency orient_by_degree(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph, executor& executor) {
+  const auto vertex_count{graph.vertex_count()};
+  // Orders the vertices by degree, ties broken by index. Self loops point
+  // neither way.
+  const auto comes_first{[&graph](std::size_t lhs, std::size_t rhs) {
+    const auto lhs_degree{graph.degree(lhs)};
+    const auto rhs_degree{graph.degree(rhs)};
+    return lhs_degree < rhs_degree || (lhs_degree == rhs_degree && lhs < rhs);
+  }};
+
+  oriented_adjacency adjacency{};
+  adjacency.offsets.assign(vertex_count + 1, 0);
+  parallel_for(
+      executor, 0, vertex_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto index{begin}; index < end; ++index) {
+          adjacency.offsets[index + 1] = static_cast<std::size_t>(
+              std::ranges::count_if(graph.neighbors(index),
+                                    [&](std::size_t neighbor) {
+                                      return comes_first(index, neighbor);
+                                    }));
+        }
+      },
+      {.grain_size = 1024});
+  for (std::size_t index{0}; index < vertex_count; ++index) {
+    adjacency.offsets[index + 1] += adjacency.offsets[index];
+  }
+
+  adjacency.targets.resize(adjacency.offsets.back());
+  parallel_for(
+      executor, 0, vertex_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto index{begin}; index < end; ++index) {
+          std::ranges::copy_if(graph.neighbors(index),
+                               adjacency.targets.begin() +
+                                   static_cast<std::ptrdiff_t>(
+                                       adjacency.offsets[index]),
+                               [&](std::size_t neighbor) {
+                                 return comes_first(index, neighbor);
+                               });
+        }
+      },
+      {.grain_size = 1024});
+  return adjacency;
+}
+
+// Beyond this ratio of the sizes of two lists, the elements of the shorter one
+// are searched for in the longer one rather than merging both
+inline constexpr std::size_t galloping_ratio{32};
+
+/**
+ * Calls the function with every element of the smaller sorted list which is
+ * also in the larger one, searching for each with exponentially growing steps
+ * from the previous position.
+ */
+template <typename FUNCTION_T>
+void for_each_common_galloping(std::span<const std::size_t> smaller,
+                               std::span<const std::size_t> larger,
+                               const FUNCTION_T& function) {
+  auto position{larger.begin()};
+  for (const auto element : smaller) {
+    // Every element before low is smaller than the element, high is the end
+    // or not smaller
+    auto low{position};
+    auto high{position};
+    std::ptrdiff_t step{1};
+    while (high != larger.end() && *high < element) {
+      low = high + 1;
+      high = larger.end() - high > step ? high + step : larger.end();
+      step *= 2;
+    }
+
+    position = std::lower_bound(low, high, element);
+    if (position == larger.end()) {
+      return;
+    }
+    if (*position == element) {
+      function(element);
+    }
+  }
+}
+
+/**
+ * Calls the function with every element which is in both sorted lists.
+ *
+ * Lists of similar size are merged, advancing both positions by comparison
+ * results rather than branching on them, which the processor cannot predict.
+ */
+template <typename FUNCTION_T>
+void for_each_common(std::span<const std::size_t> lhs,
+                     std::span<const std::size_t> rhs,
+                     const FUNCTION_T& function) {
+  if (lhs.size() > rhs.size()) {
+    std::swap(lhs, rhs);
+  }
+  if (lhs.empty()) {
+    return;
+  }
+  if (lhs.size() * galloping_ratio < rhs.size()) {
+    for_each_common_galloping(lhs, rhs, function);
+    return;
+  }
+
+  std::size_t lhs_position{0};
+  std::size_t rhs_position{0};
+  while (lhs_position < lhs.size() && rhs_position < rhs.size()) {
+    const auto lhs_element{lhs[lhs_position]};
+    const auto rhs_element{rhs[rhs_position]};
+    if (lhs_element == rhs_element) {
+      function(lhs_element);
+    }
+    lhs_position += lhs_element <= rhs_element;
+    rhs_position += rhs_element <= lhs_element;
+  }
+}
+
+// Calls the function with the other two vertices of every triangle in which
+// the vertex comes first
+template <typename FUNCTION_T>
+void for_each_oriented_triangle(const oriented_adjacency& adjacency,
+                                std::size_t vertex,
+                                const FUNCTION_T& function) {
+  const auto neighbors{adjacency.neighbors(vertex)};
+  for (const auto neighbor : neighbors) {
+    for_each_common(neighbors, adjacency.neighbors(neighbor),
+                    [&](std::size_t common_neighbor) {
+                      function(neighbor, common_neighbor);
+                    });
+  }
+}
+
+template <typename V, typename E>
+[[nodiscard]] std::size_t count_triangles(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph, executor& executor) {
+  const auto adjacency{orient_by_degree(graph, executor)};
+
+  std::atomic<std::size_t> triangle_count{0};
+  parallel_for(
+      executor, 0, graph.vertex_count(),
+      [&](std::size_t begin, std::size_t end) {
+        std::size_t local_count{0};
+        for (auto vertex{begin}; vertex < end; ++vertex) {
+          for_each_oriented_triangle(
+              adjacency, vertex,
+              [&local_count](std::size_t /*second*/, std::size_t /*third*/) {
+                ++local_count;
+              });
+        }
+        triangle_count.fetch_add(local_count, std::memory_order_relaxed);
+      },
+      {.grain_size = 256});
+  return triangle_count.load();
+}
+
+template <typename V, typename E>
+[[nodiscard]] std::vector<std::size_t> count_vertex_triangles(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph, executor& executor) {
+  const auto adjacency{orient_by_degree(graph, executor)};
+  std::vector<std::size_t> triangle_counts(graph.vertex_count(), 0);
+
+  // The other two vertices of a triangle may be counted by several threads
+  const auto concurrent{executor.concurrency() > 1};
+  const auto increment{[&triangle_counts, concurrent](std::size_t vertex) {
+    if (concurrent) {
+      std::atomic_ref{triangle_counts[vertex]}.fetch_add(
+          1, std::memory_order_relaxed);
+    } else {
+      ++triangle_counts[vertex];
+    }
+  }};
+
+  parallel_for(
+      executor, 0, graph.vertex_count(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto vertex{begin}; vertex < end; ++vertex) {
+          std::size_t local_count{0};
+          for_each_oriented_triangle(
+              adjacency, vertex,
+              [&](std::size_t second, std::size_t third) {
+                ++local_count;
+                increment(second);
+                increment(third);
+              });
+          if (concurrent) {
+            std::atomic_ref{triangle_counts[vertex]}.fetch_add(
+                local_count, std::memory_order_relaxed);
+          } else {
+            triangle_counts[vertex] += local_count;
+          }
+        }
+      },
+      {.grain_size = 256});
+  return triangle_counts;
+}
+
+// The number of neighbors of the vertex other than itself
+template <typename V, typename E>
+[[nodiscard]] std::size_t distinct_neighbor_count(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph, std::size_t index) {
+  return graph.degree(index) - (graph.has_edge(index, index) ? 1 : 0);
+}
+
+template <typename V, typename E>
+[[nodiscard]] std::vector<double> clustering_coefficients(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph, executor& executor) {
+  const auto triangle_counts{count_vertex_triangles(graph, executor)};
+
+  std::vector<double> coefficients(graph.vertex_count(), 0);
+  for (std::size_t index{0}; index < graph.vertex_count(); ++index) {
+    const auto degree{
+        static_cast<double>(distinct_neighbor_count(graph, index))};
+    if (degree >= 2) {
+      coefficients[index] = 2 * static_cast<double>(triangle_counts[index]) /
+                            (degree * (degree - 1));
+    }
+  }
+  return coefficients;
+}
+
+template <typename V, typename E>
+[[nodiscard]] double global_clustering_coefficient(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph, executor& executor) {
+  double path_count{0};
+  for (std::size_t index{0}; index < graph.vertex_count(); ++index) {
+    const auto degree{
+        static_cast<double>(distinct_neighbor_count(graph, index))};
+    path_count += degree * (degree - 1) / 2;
+  }
+  if (path_count == 0) {
+    return 0;
+  }
+  return 3 * static_cast<double>(count_triangles(graph, executor)) /
+         path_count;
+}
+
+}  // namespace detail
+
+template <typename V, typename E>
+std::size_t triangle_count(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return triangle_count(execution::seq, graph);
+}
+
+template <execution_policy POLICY_T, typename V, typename E>
+std::size_t triangle_count(
+    POLICY_T&& /*policy*/,
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return detail::count_triangles(graph,
+                                 graaf::detail::policy_executor<POLICY_T>());
+}
+
+template <typename V, typename E>
+std::size_t triangle_count(const graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return triangle_count(make_csr_graph(graph));
+}
+
+template <typename V, typename E>
+std::vector<std::size_t> vertex_triangle_counts(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return vertex_triangle_counts(execution::seq, graph);
+}
+
+template <execution_policy POLICY_T, typename V, typename E>
+std::vector<std::size_t> vertex_triangle_counts(
+    POLICY_T&& /*policy*/,
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return detail::count_vertex_triangles(
+      graph, graaf::detail::policy_executor<POLICY_T>());
+}
+
+template <typename V, typename E>
+std::unordered_map<vertex_id_t, std::size_t> vertex_triangle_counts(
+    const graph<V, E, graph_type::UNDIRECTED>& graph) {
+  const auto csr{make_csr_graph(graph)};
+  const auto triangle_counts{vertex_triangle_counts(csr)};
+
+  std::unordered_map<vertex_id_t, std::size_t> vertex_counts{};
+  vertex_counts.reserve(triangle_counts.size());
+  for (std::size_t index{0}; index < triangle_counts.size(); ++index) {
+    vertex_counts.emplace(csr.vertex_id(index), triangle_counts[index]);
+  }
+  return vertex_counts;
+}
+
+template <typename V, typename E>
+std::vector<double> local_clustering_coefficients(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return local_clustering_coefficients(execution::seq, graph);
+}
+
+template <execution_policy POLICY_T, typename V, typename E>
+std::vector<double> local_clustering_coefficients(
+    POLICY_T&& /*policy*/,
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return detail::clustering_coefficients(
+      graph, graaf::detail::policy_executor<POLICY_T>());
+}
+
+template <typename V, typename E>
+std::unordered_map<vertex_id_t, double> local_clustering_coefficients(
+    const graph<V, E, graph_type::UNDIRECTED>& graph) {
+  const auto csr{make_csr_graph(graph)};
+  const auto coefficients{local_clustering_coefficients(csr)};
+
+  std::unordered_map<vertex_id_t, double> vertex_coefficients{};
+  vertex_coefficients.reserve(coefficients.size());
+  for (std::size_t index{0}; index < coefficients.size(); ++index) {
+    vertex_coefficients.emplace(csr.vertex_id(index), coefficients[index]);
+  }
+  return vertex_coefficients;
+}
+
+template <typename V, typename E>
+double global_clustering_coefficient(
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return global_clustering_coefficient(execution::seq, graph);
+}
+
+template <execution_policy POLICY_T, typename V, typename E>
+double global_clustering_coefficient(
+    POLICY_T&& /*policy*/,
+    const csr_graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return detail::global_clustering_coefficient(
+      graph, graaf::detail::policy_executor<POLICY_T>());
+}
+
+template <typename V, typename E>
+double global_clustering_coefficient(
+    const graph<V, E, graph_type::UNDIRECTED>& graph) {
+  return global_clustering_coefficient(make_csr_graph(graph));
+}
+
+}  // namespace graaf::properties
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <graaflib/csr_graph.h>
+#include <graaflib/executor.h>
+#include <graaflib/graph.h>
+#include <graaflib/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace graaf {
+
+namespace detail {
+
+template <typename GRAPH_T>
+struct graph_type_of;
+
+template <typename V, typename E, graph_type T>
+struct graph_type_of<graph<V, E, T>> {
+  static constexpr graph_type value{T};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Options of a sharded_graph.
+ */
+struct sharded_graph_options {
+  // The number of shards the vertices are distributed over. Threads only
+  // contend when they access vertices of the same shard, so there should be
+  // several times as many shards as writing threads.
+  std::size_t shard_count{4 *
+                          std::max(1U, std::thread::hardware_concurrency())};
+
+  // Executor to freeze the graph on, if null the default_executor is used
+  graaf::executor* executor{nullptr};
+};
+
+/**
+ * @brief A graph into which many threads insert vertices and edges at the
+ * same time.
+ *
+ * The vertices are partitioned by a hash of their id into shards, each of
+ * which has its own lock. A shard holds its vertices and their outgoing
+ * edges, so inserting an edge only locks the shards of its two vertices, one
+ * after the other. Vertex ids are drawn from an atomic counter.
+ *
+ * The graph is meant for ingestion: vertices and edges cannot be removed, and
+ * once all insertions are done the graph is frozen into a csr_graph or
+ * converted into a graph for querying. As in graph, adding an edge which
+ * already exists keeps the existing edge.
+ *
+ * @tparam GRAPH_T The type of graph whose vertices and edges are stored.
+ */
+template <typename GRAPH_T>
+class sharded_graph {
+ public:
+  using vertex_t = typename GRAPH_T::vertex_t;
+  using edge_t = typename GRAPH_T::edge_t;
+  using csr_graph_t =
+      csr_graph<vertex_t, edge_t, detail::graph_type_of<GRAPH_T>::value>;
+
+  explicit sharded_graph(sharded_graph_options options = {});
+
+  sharded_graph(const sharded_graph&) = delete;
+  sharded_graph& operator=(const sharded_graph&) = delete;
+
+  /**
+   * Query the number of vertices. Concurrent insertions may or may not be
+   * counted.
+   *
+   * @return size_t - Number of vertices
+   */
+  [[nodiscard]] std::size_t vertex_count() const noexcept {
+    return vertex_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Query the number of edges. Concurrent insertions may or may not be
+   * counted.
+   *
+   * @return size_t - Number of edges
+   */
+  [[nodiscard]] std::size_t edge_count() const noexcept {
+    return edge_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Checks whether a vertex with a given ID is contained in the graph.
+   *
+   * @param  vertex_id The ID of the vertex
+   * @return boolean - True if the vertex is contained in the graph
+   */
+  [[nodiscard]] bool has_vertex(vertex_id_t vertex_id) const;
+
+  /**
+   * Checks whether two vertices are connected
+   *
+   * @param  vertex_id_lhs The ID of the first vertex
+   * @param  vertex_id_rhs The ID of the second vertex
+   * @return boolean - True if there is an edge between the two vertices
+   */
+  [[nodiscard]] bool has_edge(vertex_id_t vertex_id_lhs,
+                              vertex_id_t vertex_id_rhs) const;
+
+  /**
+   * Add a vertex to the graph. Safe to call from any thread.
+   *
+   * @param  vertex The vertex to be added
+   * @return vertices_id_t - The ID of the new vertex
+   */
+  [[nodiscard]] vertex_id_t add_vertex(auto&& vertex);
+
+  /**
+   * Add a vertex with a given ID to the graph. Vertices which are added later
+   * on without an explicit ID are given IDs larger than the given ID. Safe to
+   * call from any thread.
+   *
+   * @param  vertex The vertex to be added
+   * @param  vertex_id The ID of the new vertex
+   * @return vertices_id_t - The ID of the new vertex
+   * @throws invalid_argument - If a vertex with the given ID already exists
+   */
+  vertex_id_t add_vertex(auto&& vertex, vertex_id_t vertex_id);
+
+  /**
+   * Add a new edge between two existing vertices. Safe to call from any
+   * thread.
+   *
+   * @param  vertex_id_lhs The ID of the first vertex
+   * @param  vertex_id_rhs The ID of the second vertex
+   * @param  edge The edge to be added
+   * @throws invalid_argument - If either of the vertices does not exist
+   */
+  void add_edge(vertex_id_t vertex_id_lhs, vertex_id_t vertex_id_rhs,
+                auto&& edge);
+
+  /**
+   * Create a csr_graph of the vertices and edges. Must not be called while
+   * vertices or edges are being inserted.
+   *
+   * @return csr_graph - The frozen graph, built in parallel
+   */
+  [[nodiscard]] csr_graph_t freeze() const;
+
+  /**
+   * Create a graph with the vertices and edges, keeping their IDs. Must not
+   * be called while vertices or edges are being inserted.
+   *
+   * @return GRAPH_T - The newly built graph
+   */
+  [[nodiscard]] GRAPH_T to_graph() const;
+
+ private:
+  struct alignas(64) shard {
+    mutable std::mutex mutex{};
+    std::unordered_map<vertex_id_t, vertex_t> vertices{};
+    // The edges to the neighbors of each vertex of the shard
+    std::unordered_map<vertex_id_t, std::unordered_map<vertex_id_t, edge_t>>
+        adjacency{};
+  };
+
+  [[nodiscard]] shard& shard_of(vertex_id_t vertex_id) const noexcept;
+
+  // Inserts the edge into the shard of the source, returns whether the edge
+  // did not exist yet
+  bool insert_adjacency(vertex_id_t source, vertex_id_t target,
+                        const edge_t& edge);
+
+  [[nodiscard]] std::vector<vertex_id_t> sorted_vertex_ids() const;
+
+  sharded_graph_options options_;
+  std::unique_ptr<shard[]> shards_;
+
+  std::atomic<vertex_id_t> vertex_id_supplier_{0};
+  std::atomic<std::size_t> vertex_count_{0};
+  std::atomic<std::size_t> edge_count_{0};
+};
+
+}  // namespace graaf
+
+#include "sharded_graph.tpp"
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graaf {
+
+template <typename GRAPH_T>
+sharded_graph<GRAPH_T>::sharded_graph(sharded_graph_options options)
+    : options_{options} {
+  options_.shard_count = std::max<std::size_t>(options_.shard_count, 1);
+  shards_ = std::make_unique<shard[]>(options_.shard_count);
+}
+
+template <typename GRAPH_T>
+typename sharded_graph<GRAPH_T>::shard& sharded_graph<GRAPH_T>::shard_of(
+    vertex_id_t vertex_id) const noexcept {
+  // Vertex ids are mostly consecutive, multiplying by a large odd constant
+  // spreads ids with a common stride over all shards as well
+  const auto hash{(static_cast<std::uint64_t>(vertex_id) *
+                   0x9E3779B97F4A7C15ULL) >>
+                  32};
+  return shards_[hash % options_.shard_count];
+}
+
+template <typename GRAPH_T>
+bool sharded_graph<GRAPH_T>::has_vertex(vertex_id_t vertex_id) const {
+  const auto& vertex_shard{shard_of(vertex_id)};
+  const std::lock_guard lock{vertex_shard.mutex};
+  return vertex_shard.vertices.contains(vertex_id);
+}
+
+template <typename GRAPH_T>
+bool sharded_graph<GRAPH_T>::has_edge(vertex_id_t vertex_id_lhs,
+                                      vertex_id_t vertex_id_rhs) const {
+  const auto& source_shard{shard_of(vertex_id_lhs)};
+  const std::lock_guard lock{source_shard.mutex};
+  const auto adjacency{source_shard.adjacency.find(vertex_id_lhs)};
+  return adjacency != source_shard.adjacency.end() &&
+         adjacency->second.contains(vertex_id_rhs);
+}
+
+template <typename GRAPH_T>
+vertex_id_t sharded_graph<GRAPH_T>::add_vertex(auto&& vertex) {
+  while (true) {
+    const auto vertex_id{vertex_id_supplier_.fetch_add(1)};
+    auto& vertex_shard{shard_of(vertex_id)};
+    const std::lock_guard lock{vertex_shard.mutex};
+    // A concurrent insertion with an explicit ID may have taken the ID before
+    // the supplier was advanced past it
+    if (vertex_shard.vertices.contains(vertex_id)) {
+      continue;
+    }
+    vertex_shard.vertices.emplace(vertex_id,
+                                  std::forward<decltype(vertex)>(vertex));
+    vertex_count_.fetch_add(1, std::memory_order_relaxed);
+    return vertex_id;
+  }
+}
+
+template <typename GRAPH_T>
+vertex_id_t sharded_graph<GRAPH_T>::add_vertex(auto&& vertex,
+                                               vertex_id_t vertex_id) {
+  auto& vertex_shard{shard_of(vertex_id)};
+  {
+    const std::lock_guard lock{vertex_shard.mutex};
+    if (!vertex_shard.vertices
+             .try_emplace(vertex_id, std::forward<decltype(vertex)>(vertex))
+             .second) {
+      throw std::invalid_argument{"Vertex with ID [" +
+                                  std::to_string(vertex_id) +
+                                  "] already exists in graph."};
+    }
+  }
+  vertex_count_.fetch_add(1, std::memory_order_relaxed);
+
+  auto supplied_id{vertex_id_supplier_.load()};
+  while (supplied_id <= vertex_id &&
+         !vertex_id_supplier_.compare_exchange_weak(supplied_id,
+                                                    vertex_id + 1)) {
+  }
+  return vertex_id;
+}
+
+template <typename GRAPH_T>
+bool sharded_graph<GRAPH_T>::insert_adjacency(vertex_id_t source,
+                                              vertex_id_t target,
+                                              const edge_t& edge) {
+  auto& source_shard{shard_of(source)};
+  const std::lock_guard lock{source_shard.mutex};
+  return source_shard.adjacency[source].try_emplace(target, edge).second;
+}
+
+template <typename GRAPH_T>
+void sharded_graph<GRAPH_T>::add_edge(vertex_id_t vertex_id_lhs,
+                                      vertex_id_t vertex_id_rhs, auto&& edge) {
+  if (!has_vertex(vertex_id_lhs) || !has_vertex(vertex_id_rhs)) {
+    throw std::invalid_argument{
+        "Vertices with ID [" + std::to_string(vertex_id_lhs) + "] and [" +
+        std::to_string(vertex_id_rhs) + "] not found in graph."};
+  }
+
+  const edge_t edge_value(std::forward<decltype(edge)>(edge));
+  if constexpr (detail::graph_type_of<GRAPH_T>::value ==
+                graph_type::DIRECTED) {
+    if (insert_adjacency(vertex_id_lhs, vertex_id_rhs, edge_value)) {
+      edge_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+  } else {
+    // The shard of the smaller id decides whether the edge is new, such that
+    // concurrent insertions of both directions agree on a single edge
+    const auto [vertex_id_min, vertex_id_max]{
+        std::minmax(vertex_id_lhs, vertex_id_rhs)};
+    if (insert_adjacency(vertex_id_min, vertex_id_max, edge_value)) {
+      if (vertex_id_min != vertex_id_max) {
+        insert_adjacency(vertex_id_max, vertex_id_min, edge_value);
+      }
+      edge_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename GRAPH_T>
+std::vector<vertex_id_t> sharded_graph<GRAPH_T>::sorted_vertex_ids() const {
+  std::vector<vertex_id_t> vertex_ids{};
+  vertex_ids.reserve(vertex_count());
+  for (std::size_t shard_index{0}; shard_index < options_.shard_count;
+       ++shard_index) {
+    for (const auto& [vertex_id, _] : shards_[shard_index].vertices) {
+      vertex_ids.push_back(vertex_id);
+    }
+  }
+  std::ranges::sort(vertex_ids);
+  return vertex_ids;
+}
+
+template <typename GRAPH_T>
+typename sharded_graph<GRAPH_T>::csr_graph_t sharded_graph<GRAPH_T>::freeze()
+    const {
+  auto& executor{options_.executor != nullptr ? *options_.executor
+                                              : default_executor()};
+
+  return detail::assemble_csr_graph<vertex_t, edge_t,
+                                    detail::graph_type_of<GRAPH_T>::value>(
+      sorted_vertex_ids(),
+      [this](vertex_id_t vertex_id) -> const vertex_t& {
+        return shard_of(vertex_id).vertices.at(vertex_id);
+      },
+      [this](vertex_id_t vertex_id, const auto& callback) {
+        const auto& vertex_shard{shard_of(vertex_id)};
+        const auto adjacency{vertex_shard.adjacency.find(vertex_id)};
+        if (adjacency == vertex_shard.adjacency.end()) {
+          return;
+        }
+        for (const auto& [target, edge] : adjacency->second) {
+          callback(target, edge);
+        }
+      },
+      edge_count(), executor);
+}
+
+template <typename GRAPH_T>
+GRAPH_T sharded_graph<GRAPH_T>::to_graph() const {
+  GRAPH_T graph{};
+  graph.reserve(vertex_count(), edge_count());
+
+  const auto vertex_ids{sorted_vertex_ids()};
+  for (const auto vertex_id : vertex_ids) {
+    graph.add_vertex(vertex_t(shard_of(vertex_id).vertices.at(vertex_id)),
+                     vertex_id);
+  }
+
+  for (const auto vertex_id : vertex_ids) {
+    const auto& vertex_shard{shard_of(vertex_id)};
+    const auto adjacency{vertex_shard.adjacency.find(vertex_id)};
+    if (adjacency == vertex_shard.adjacency.end()) {
+      continue;
+    }
+    for (const auto& [target, edge] : adjacency->second) {
+      // Undirected edges are stored with both of their vertices
+      if (graph.is_directed() || vertex_id <= target) {
+        graph.add_edge(vertex_id, target, edge_t(edge));
+      }
+    }
+  }
+  return graph;
+}
+
+}  // namespace graaf
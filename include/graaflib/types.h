@@ -14,8 +14,10 @@ struct edge_id_hash {
     const auto h1{std::hash<vertex_id_t>{}(key.first)};
     const auto h2{std::hash<vertex_id_t>{}(key.second)};
 
-    // TODO: use something like boost::hash_combine
-    return h1 ^ h2;
+    // Combine the hashes as boost::hash_combine does. Unlike h1 ^ h2, this
+    // distinguishes (a, b) from (b, a) and avoids colliding edges between
+    // vertices with consecutive ids.
+    return h1 ^ (h2 + 0x9E3779B97F4A7C15 + (h1 << 6) + (h1 >> 2));
   }
 };
 
@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/coloring/greedy_graph_coloring.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+static void bm_greedy_graph_coloring(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::UNDIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::greedy_graph_coloring(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks
+BENCHMARK(bm_greedy_graph_coloring)->Apply(graph_arguments<1 << 17>);
@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/cycle_detection/dfs_cycle_detection.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+#include <cstddef>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::dag_arguments;
+using graaf::perf::get_dag;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+// The search stops at the first cycle. A DAG has none, so the whole graph is
+// traversed.
+static void bm_dfs_cycle_detection_directed(benchmark::State& state) {
+  const auto& graph{get_dag(static_cast<std::size_t>(state.range(0)),
+                            static_cast<std::size_t>(state.range(1)))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::dfs_cycle_detection(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_dfs_cycle_detection_undirected(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::UNDIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::dfs_cycle_detection(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks. Both searches are recursive, which limits the size
+// of the graphs.
+BENCHMARK(bm_dfs_cycle_detection_directed)->Apply(dag_arguments<1 << 14>);
+BENCHMARK(bm_dfs_cycle_detection_undirected)->Apply(graph_arguments<1 << 14>);
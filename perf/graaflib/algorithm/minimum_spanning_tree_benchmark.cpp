@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/minimum_spanning_tree/kruskal.h>
+#include <graaflib/algorithm/minimum_spanning_tree/prim.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+static void bm_kruskal_minimum_spanning_tree(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::UNDIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        graaf::algorithm::kruskal_minimum_spanning_tree(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+// Prim's algorithm returns early once it finds that the graph is not
+// connected, which is common in the sparse R-MAT and Erdős–Rényi graphs. Only
+// the grid family measures the construction of a complete spanning tree.
+static void bm_prim_minimum_spanning_tree(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::UNDIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        graaf::algorithm::prim_minimum_spanning_tree(graph, 0));
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks. Prim's algorithm runs in O(V * E), hence it is
+// limited to smaller graphs.
+BENCHMARK(bm_kruskal_minimum_spanning_tree)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_prim_minimum_spanning_tree)->Apply(graph_arguments<1 << 8>);
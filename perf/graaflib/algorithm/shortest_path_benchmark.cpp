@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/shortest_path/a_star.h>
+#include <graaflib/algorithm/shortest_path/bellman_ford.h>
+#include <graaflib/algorithm/shortest_path/bfs_shortest_path.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_path.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/algorithm/shortest_path/floyd_warshall.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+// The single pair searches run from the first to the last vertex. In the grid
+// family these are opposite corners.
+static void bm_bfs_shortest_path(benchmark::State& state) {
+  const auto parameters{get_graph_parameters(state)};
+  const auto& graph{get_graph<graph_type::DIRECTED>(parameters)};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::bfs_shortest_path(
+        graph, 0, parameters.vertex_count - 1));
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_dijkstra_shortest_path(benchmark::State& state) {
+  const auto parameters{get_graph_parameters(state)};
+  const auto& graph{get_graph<graph_type::DIRECTED>(parameters)};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::dijkstra_shortest_path(
+        graph, 0, parameters.vertex_count - 1));
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_a_star_search(benchmark::State& state) {
+  const auto parameters{get_graph_parameters(state)};
+  const auto& graph{get_graph<graph_type::DIRECTED>(parameters)};
+
+  // Without a meaningful heuristic, this measures the overhead of A* compared
+  // to Dijkstra
+  const auto heuristic{[](graaf::vertex_id_t) { return 0; }};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::a_star_search(
+        graph, 0, parameters.vertex_count - 1, heuristic));
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_dijkstra_shortest_paths(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        graaf::algorithm::dijkstra_shortest_paths(graph, 0));
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_bellman_ford_shortest_paths(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        graaf::algorithm::bellman_ford_shortest_paths(graph, 0));
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_floyd_warshall_shortest_paths(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        graaf::algorithm::floyd_warshall_shortest_paths(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks. Bellman-Ford runs in O(V * E) and Floyd-Warshall in
+// O(V^3), hence they are limited to smaller graphs.
+BENCHMARK(bm_bfs_shortest_path)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_dijkstra_shortest_path)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_a_star_search)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_dijkstra_shortest_paths)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_bellman_ford_shortest_paths)->Apply(graph_arguments<1 << 11>);
+BENCHMARK(bm_floyd_warshall_shortest_paths)->Apply(graph_arguments<1 << 8>);
@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/strongly_connected_components/tarjan.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+static void bm_tarjans_strongly_connected_components(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        graaf::algorithm::tarjans_strongly_connected_components(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks. Tarjan's algorithm is recursive, the graphs are
+// limited in size such that the recursion fits on the default stack.
+BENCHMARK(bm_tarjans_strongly_connected_components)
+    ->Apply(graph_arguments<1 << 14>);
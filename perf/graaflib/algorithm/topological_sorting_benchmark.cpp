@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/topological_sorting/dfs_topological_sorting.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+#include <cstddef>
+
+namespace {
+
+using graaf::perf::counters;
+using graaf::perf::dag_arguments;
+using graaf::perf::get_dag;
+
+// A topological order only exists for acyclic graphs, so this benchmark runs on
+// random DAGs rather than on the graph families
+static void bm_dfs_topological_sort(benchmark::State& state) {
+  const auto& graph{get_dag(static_cast<std::size_t>(state.range(0)),
+                            static_cast<std::size_t>(state.range(1)))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graaf::algorithm::dfs_topological_sort(graph));
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks. The sort recurses along the paths of the DAG, which
+// limits the size of the DAGs.
+BENCHMARK(bm_dfs_topological_sort)->Apply(dag_arguments<1 << 14>);
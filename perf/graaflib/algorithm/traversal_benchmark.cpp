@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/algorithm/graph_traversal/breadth_first_search.h>
+#include <graaflib/algorithm/graph_traversal/depth_first_search.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+#include <cstddef>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+static void bm_breadth_first_traverse(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    std::size_t visited_edges{0};
+    graaf::algorithm::breadth_first_traverse(
+        graph, 0, [&visited_edges](const auto&) { ++visited_edges; });
+    benchmark::DoNotOptimize(visited_edges);
+  }
+  counters.report(graph.edge_count());
+}
+
+static void bm_depth_first_traverse(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+
+  counters counters{state};
+  for (auto _ : state) {
+    std::size_t visited_edges{0};
+    graaf::algorithm::depth_first_traverse(
+        graph, 0, [&visited_edges](const auto&) { ++visited_edges; });
+    benchmark::DoNotOptimize(visited_edges);
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks. Depth first traversal recurses for every vertex on
+// the current path, hence it is limited to graphs whose depth fits on the
+// default stack.
+BENCHMARK(bm_breadth_first_traverse)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_depth_first_traverse)->Apply(graph_arguments<1 << 14>);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/io/dot.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::get_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+/**
+ * A stream buffer which discards its output, such that the benchmark measures
+ * serialization rather than I/O.
+ */
+class null_buffer : public std::streambuf {
+ protected:
+  std::streamsize xsputn(const char* /*characters*/,
+                         std::streamsize count) override {
+    return count;
+  }
+
+  int_type overflow(int_type character) override {
+    return traits_type::not_eof(character);
+  }
+};
+
+template <std::size_t THREAD_COUNT>
+static void bm_to_dot(benchmark::State& state) {
+  const auto& graph{
+      get_graph<graph_type::DIRECTED>(get_graph_parameters(state))};
+  const graaf::io::dot_options options{.thread_count = THREAD_COUNT};
+
+  null_buffer buffer{};
+  std::ostream stream{&buffer};
+
+  counters counters{state};
+  for (auto _ : state) {
+    graaf::io::to_dot(graph, stream,
+                      graaf::io::detail::default_vertex_writer<int>,
+                      graaf::io::detail::default_edge_writer, options);
+  }
+  counters.report(graph.edge_count());
+}
+
+}  // namespace
+
+// Register the benchmarks
+BENCHMARK(bm_to_dot<1>)->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_to_dot<4>)->Apply(graph_arguments<1 << 17>);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <graaflib/graph.h>
+#include <utils/counters/counters.h>
+#include <utils/graph_families/graph_families.h>
+#include <utils/memory/memory_tracking.h>
+
+#include <cstddef>
+
+namespace {
+
+using graaf::graph_type;
+using graaf::perf::counters;
+using graaf::perf::generate_graph;
+using graaf::perf::get_graph_parameters;
+using graaf::perf::graph_arguments;
+
+void report_memory_usage(benchmark::State& state,
+                         const graaf::graph_memory_usage& usage,
+                         std::size_t allocated_bytes, std::size_t edge_count) {
+  const auto bytes{[](std::size_t value) {
+    return benchmark::Counter(static_cast<double>(value),
+                              benchmark::Counter::kDefaults,
+                              benchmark::Counter::OneK::kIs1024);
+  }};
+
+  state.counters["vertex_bytes"] = bytes(usage.vertices);
+  state.counters["edge_bytes"] = bytes(usage.edges);
+  state.counters["adjacency_bytes"] = bytes(usage.adjacency);
+  state.counters["estimated_bytes"] = bytes(usage.total());
+  state.counters["allocated_bytes"] = bytes(allocated_bytes);
+  state.counters["bytes_per_edge"] = benchmark::Counter(
+      static_cast<double>(allocated_bytes) / static_cast<double>(edge_count));
+}
+
+// Measures the construction and the memory footprint of a graph. The estimate
+// of graph::memory_usage is reported next to the bytes which are actually
+// allocated for the graph.
+template <graph_type T>
+static void bm_graph_memory_usage(benchmark::State& state) {
+  const auto parameters{get_graph_parameters(state)};
+
+  graaf::graph_memory_usage usage{};
+  std::size_t allocated_bytes{0};
+  std::size_t edge_count{0};
+
+  counters counters{state};
+  for (auto _ : state) {
+    const auto bytes_before{graaf::perf::memory::current_bytes()};
+    const auto graph{generate_graph<T>(parameters)};
+    allocated_bytes = graaf::perf::memory::current_bytes() - bytes_before;
+
+    usage = graph.memory_usage();
+    edge_count = graph.edge_count();
+  }
+  counters.report(edge_count);
+  report_memory_usage(state, usage, allocated_bytes, edge_count);
+}
+
+}  // namespace
+
+// Register the benchmarks
+BENCHMARK(bm_graph_memory_usage<graph_type::DIRECTED>)
+    ->Apply(graph_arguments<1 << 17>);
+BENCHMARK(bm_graph_memory_usage<graph_type::UNDIRECTED>)
+    ->Apply(graph_arguments<1 << 17>);
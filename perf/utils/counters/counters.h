@@ -0,0 +1,71 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <utils/hardware_counters/hardware_counters.h>
+#include <utils/memory/memory_tracking.h>
+
+#include <cstddef>
+
+namespace graaf::perf {
+
+/**
+ * @brief Reports the throughput, peak memory and, where available, hardware
+ * counters of a benchmark as counters.
+ *
+ * Construct it right before the benchmark loop, such that memory allocated
+ * while setting up the benchmark is not attributed to the benchmarked code.
+ *
+ * Usage:
+ *   counters counters{state};
+ *   for (auto _ : state) { ... }
+ *   counters.report(graph.edge_count());
+ */
+class counters {
+ public:
+  explicit counters(benchmark::State& state)
+      : state_{state},
+        baseline_bytes_{memory::current_bytes()},
+        baseline_allocations_{memory::allocation_count()} {
+    memory::reset_peak();
+    hardware_counters_.start();
+  }
+
+  /**
+   * Sets the counters edges_per_second, the number of edges processed per
+   * second of benchmark time, peak_memory, the largest number of bytes
+   * allocated at once on top of the memory in use before the benchmark loop,
+   * and allocations, the number of allocations per iteration. Hardware
+   * counters are reported per iteration, see hardware_counters.
+   *
+   * @param edges_per_iteration The number of edges processed per iteration.
+   */
+  void report(std::size_t edges_per_iteration) {
+    // Adding the counters allocates, read the memory statistics first
+    const auto peak_memory{memory::peak_bytes() - baseline_bytes_};
+    const auto allocations{memory::allocation_count() -
+                           baseline_allocations_};
+    hardware_counters_.stop();
+    hardware_counters_.report(state_);
+
+    state_.counters["edges_per_second"] = benchmark::Counter(
+        static_cast<double>(edges_per_iteration) *
+            static_cast<double>(state_.iterations()),
+        benchmark::Counter::kIsRate);
+    state_.counters["peak_memory"] = benchmark::Counter(
+        static_cast<double>(peak_memory), benchmark::Counter::kDefaults,
+        benchmark::Counter::OneK::kIs1024);
+    state_.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(allocations),
+                           benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  benchmark::State& state_;
+  // Opened before the baseline is taken, its allocations are not attributed
+  // to the benchmark
+  hardware_counters hardware_counters_{};
+  std::size_t baseline_bytes_;
+  std::size_t baseline_allocations_;
+};
+
+}  // namespace graaf::perf
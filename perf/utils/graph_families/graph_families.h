@@ -0,0 +1,87 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <graaflib/graph.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graaf::perf {
+
+/**
+ * @brief The families of graphs the algorithm benchmarks are run on.
+ */
+enum class graph_family : std::int64_t {
+  // Skewed, power law degree distribution, like social and web graphs
+  RMAT,
+  // Uniform degree distribution
+  ERDOS_RENYI,
+  // Low degree and large diameter, like road networks. The density of a grid
+  // is fixed, so the requested number of edges per vertex is ignored.
+  GRID
+};
+
+/**
+ * @brief The parameters of a benchmark graph, which are passed to a benchmark
+ * as its arguments.
+ */
+struct graph_parameters {
+  graph_family family;
+  std::size_t vertex_count;
+  std::size_t edges_per_vertex;
+};
+
+/**
+ * @brief Reads the graph parameters from the arguments of a benchmark, which
+ * are registered through graph_arguments.
+ */
+[[nodiscard]] inline graph_parameters get_graph_parameters(
+    const benchmark::State& state);
+
+/**
+ * @brief Registers the arguments family, vertex_count and edges_per_vertex for
+ * every graph family, for vertex counts of 2^8 up to MAX_VERTEX_COUNT in steps
+ * of a factor 8 and for 4 and 16 edges per vertex.
+ *
+ * Usage: BENCHMARK(bm_...)->Apply(graph_arguments<1 << 16>);
+ */
+template <std::int64_t MAX_VERTEX_COUNT>
+void graph_arguments(benchmark::internal::Benchmark* benchmark);
+
+/**
+ * @brief Registers the arguments vertex_count and edges_per_vertex of random
+ * DAGs, for the same vertex counts and densities as graph_arguments.
+ */
+template <std::int64_t MAX_VERTEX_COUNT>
+void dag_arguments(benchmark::internal::Benchmark* benchmark);
+
+/**
+ * @brief Generates the graph with the given parameters and integer weights in
+ * [1, 100]. Vertex ids are [0, vertex_count).
+ */
+template <graph_type T>
+[[nodiscard]] graph<int, int, T> generate_graph(
+    const graph_parameters& parameters);
+
+/**
+ * @brief Returns the graph with the given parameters, as generated by
+ * generate_graph.
+ *
+ * Google benchmark runs a benchmark several times with the same arguments to
+ * determine the number of iterations, so the most recently generated graph is
+ * kept, rather than generating it again.
+ */
+template <graph_type T>
+[[nodiscard]] const graph<int, int, T>& get_graph(
+    const graph_parameters& parameters);
+
+/**
+ * @brief Returns the random DAG with the given number of vertices and expected
+ * number of edges per vertex, which is kept like the graphs of get_graph.
+ */
+[[nodiscard]] inline const directed_graph<int, int>& get_dag(
+    std::size_t vertex_count, std::size_t edges_per_vertex);
+
+}  // namespace graaf::perf
+
+#include "graph_families.tpp"
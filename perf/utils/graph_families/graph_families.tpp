@@ -0,0 +1,137 @@
+#pragma once
+
+#include <graaflib/generators/erdos_renyi.h>
+#include <graaflib/generators/grid.h>
+#include <graaflib/generators/random_dag.h>
+#include <graaflib/generators/rmat.h>
+
+#include <bit>
+#include <optional>
+#include <tuple>
+
+namespace graaf::perf {
+
+namespace detail {
+
+constexpr std::int64_t min_vertex_count{1 << 8};
+constexpr std::int64_t vertex_count_multiplier{8};
+constexpr std::int64_t edges_per_vertex_values[]{4, 16};
+
+inline generators::generator_options benchmark_generator_options() {
+  return {.seed = 42, .min_weight = 1, .max_weight = 100};
+}
+
+/**
+ * @brief Keeps the most recently generated graph for the given key.
+ */
+template <typename GRAPH_T, typename KEY_T, typename GENERATOR_T>
+const GRAPH_T& get_cached(const KEY_T& key, const GENERATOR_T& generate) {
+  static std::optional<std::pair<KEY_T, GRAPH_T>> cache{};
+
+  if (!cache || cache->first != key) {
+    // Release the previous graph first, large graphs do not fit twice
+    cache.reset();
+    cache.emplace(key, generate());
+  }
+  return cache->second;
+}
+
+}  // namespace detail
+
+inline graph_parameters get_graph_parameters(const benchmark::State& state) {
+  return {static_cast<graph_family>(state.range(0)),
+          static_cast<std::size_t>(state.range(1)),
+          static_cast<std::size_t>(state.range(2))};
+}
+
+template <std::int64_t MAX_VERTEX_COUNT>
+void graph_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"family", "vertex_count", "edges_per_vertex"});
+
+  for (const auto family :
+       {graph_family::RMAT, graph_family::ERDOS_RENYI, graph_family::GRID}) {
+    for (auto vertex_count{detail::min_vertex_count};
+         vertex_count <= MAX_VERTEX_COUNT;
+         vertex_count *= detail::vertex_count_multiplier) {
+      for (const auto edges_per_vertex : detail::edges_per_vertex_values) {
+        benchmark->Args({static_cast<std::int64_t>(family), vertex_count,
+                         edges_per_vertex});
+
+        if (family == graph_family::GRID) {
+          // The density of a grid is fixed
+          break;
+        }
+      }
+    }
+  }
+}
+
+template <std::int64_t MAX_VERTEX_COUNT>
+void dag_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"vertex_count", "edges_per_vertex"});
+
+  for (auto vertex_count{detail::min_vertex_count};
+       vertex_count <= MAX_VERTEX_COUNT;
+       vertex_count *= detail::vertex_count_multiplier) {
+    for (const auto edges_per_vertex : detail::edges_per_vertex_values) {
+      benchmark->Args({vertex_count, edges_per_vertex});
+    }
+  }
+}
+
+template <graph_type T>
+graph<int, int, T> generate_graph(const graph_parameters& parameters) {
+  const auto options{detail::benchmark_generator_options()};
+  const auto vertex_count{parameters.vertex_count};
+  const auto edges_per_vertex{parameters.edges_per_vertex};
+
+  switch (parameters.family) {
+    case graph_family::RMAT: {
+      const auto scale{
+          static_cast<std::size_t>(std::bit_width(vertex_count) - 1)};
+      return generators::rmat<int, int, T>(scale, edges_per_vertex, {},
+                                           options);
+    }
+    case graph_family::ERDOS_RENYI: {
+      // An undirected edge is counted once, as for the other families
+      const auto candidate_count{
+          T == graph_type::DIRECTED
+              ? static_cast<double>(vertex_count - 1)
+              : static_cast<double>(vertex_count - 1) / 2};
+      return generators::erdos_renyi_gnp<int, int, T>(
+          vertex_count, static_cast<double>(edges_per_vertex) / candidate_count,
+          options);
+    }
+    case graph_family::GRID: {
+      const auto row_count{std::size_t{1}
+                           << (std::bit_width(vertex_count) - 1) / 2};
+      return generators::grid<int, int, T>(row_count,
+                                           vertex_count / row_count, options);
+    }
+  }
+  return graph<int, int, T>{};
+}
+
+template <graph_type T>
+const graph<int, int, T>& get_graph(const graph_parameters& parameters) {
+  const std::tuple key{parameters.family, parameters.vertex_count,
+                       parameters.edges_per_vertex};
+
+  return detail::get_cached<graph<int, int, T>>(
+      key, [&parameters]() { return generate_graph<T>(parameters); });
+}
+
+inline const directed_graph<int, int>& get_dag(std::size_t vertex_count,
+                                               std::size_t edges_per_vertex) {
+  const std::pair key{vertex_count, edges_per_vertex};
+
+  return detail::get_cached<directed_graph<int, int>>(key, [&]() {
+    // Every vertex only connects to the vertices after it
+    const auto edge_probability{2.0 * static_cast<double>(edges_per_vertex) /
+                                static_cast<double>(vertex_count - 1)};
+    return generators::random_dag<int, int>(
+        vertex_count, edge_probability, detail::benchmark_generator_options());
+  });
+}
+
+}  // namespace graaf::perf
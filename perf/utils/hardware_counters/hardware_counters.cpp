@@ -0,0 +1,124 @@
+#include "hardware_counters.h"
+
+#ifdef GRAAF_PERF_HARDWARE_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#endif
+
+namespace graaf::perf {
+
+#ifdef GRAAF_PERF_HARDWARE_COUNTERS
+
+namespace {
+
+struct event {
+  const char* name;
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+constexpr std::uint64_t cache_event(std::uint64_t cache,
+                                    std::uint64_t operation,
+                                    std::uint64_t result) {
+  return cache | (operation << 8) | (result << 16);
+}
+
+constexpr event events[]{
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"llc_loads", PERF_TYPE_HW_CACHE,
+     cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+                 PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+    {"llc_load_misses", PERF_TYPE_HW_CACHE,
+     cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+                 PERF_COUNT_HW_CACHE_RESULT_MISS)}};
+
+int open_event(const event& event) {
+  perf_event_attr attributes{};
+  attributes.size = sizeof(attributes);
+  attributes.type = event.type;
+  attributes.config = event.config;
+  attributes.disabled = 1;
+  attributes.inherit = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1,
+                                  PERF_FLAG_FD_CLOEXEC));
+}
+
+/**
+ * Reads a counter, scaled up for the time the counter was not running when
+ * the kernel multiplexes more events than the CPU has counters.
+ */
+double read_event(int file_descriptor) {
+  struct {
+    std::uint64_t value;
+    std::uint64_t time_enabled;
+    std::uint64_t time_running;
+  } result{};
+
+  if (read(file_descriptor, &result, sizeof(result)) != sizeof(result) ||
+      result.time_running == 0) {
+    return 0;
+  }
+  return static_cast<double>(result.value) *
+         static_cast<double>(result.time_enabled) /
+         static_cast<double>(result.time_running);
+}
+
+}  // namespace
+
+hardware_counters::hardware_counters() {
+  for (const auto& event : events) {
+    if (const auto file_descriptor{open_event(event)}; file_descriptor >= 0) {
+      counters_.push_back({event.name, file_descriptor});
+    }
+  }
+}
+
+hardware_counters::~hardware_counters() {
+  for (const auto& counter : counters_) {
+    close(counter.file_descriptor);
+  }
+}
+
+void hardware_counters::start() {
+  for (const auto& counter : counters_) {
+    ioctl(counter.file_descriptor, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter.file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+void hardware_counters::stop() {
+  for (const auto& counter : counters_) {
+    ioctl(counter.file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+  }
+}
+
+void hardware_counters::report(benchmark::State& state) const {
+  for (const auto& counter : counters_) {
+    state.counters[counter.name] =
+        benchmark::Counter(read_event(counter.file_descriptor),
+                           benchmark::Counter::kAvgIterations);
+  }
+}
+
+#else
+
+hardware_counters::hardware_counters() = default;
+hardware_counters::~hardware_counters() = default;
+void hardware_counters::start() {}
+void hardware_counters::stop() {}
+void hardware_counters::report(benchmark::State& /*state*/) const {}
+
+#endif
+
+}  // namespace graaf::perf
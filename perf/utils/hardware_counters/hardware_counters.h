@@ -0,0 +1,53 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace graaf::perf {
+
+/**
+ * @brief Reads hardware performance counters of the calling process through
+ * the Linux perf_event_open interface.
+ *
+ * Counters which cannot be opened, because the kernel or CPU does not support
+ * them, the process lacks the permission (see
+ * /proc/sys/kernel/perf_event_paranoid) or the benchmarks are built without
+ * PERF_HARDWARE_COUNTERS, are silently left out. Only user space events are
+ * counted, including those of threads started while counting.
+ */
+class hardware_counters {
+ public:
+  hardware_counters();
+  ~hardware_counters();
+
+  hardware_counters(const hardware_counters&) = delete;
+  hardware_counters& operator=(const hardware_counters&) = delete;
+
+  /**
+   * Resets all counters and starts counting.
+   */
+  void start();
+
+  /**
+   * Stops counting.
+   */
+  void stop();
+
+  /**
+   * Adds every available counter to the benchmark counters, as the average
+   * value per iteration.
+   */
+  void report(benchmark::State& state) const;
+
+ private:
+  struct counter {
+    std::string name;
+    int file_descriptor;
+  };
+
+  std::vector<counter> counters_{};
+};
+
+}  // namespace graaf::perf
@@ -0,0 +1,111 @@
+#include "memory_tracking.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace graaf::perf::memory {
+
+namespace {
+
+std::atomic<std::size_t> current_bytes_{0};
+std::atomic<std::size_t> peak_bytes_{0};
+std::atomic<std::size_t> allocation_count_{0};
+
+// The size of every allocation is stored in front of the returned block, such
+// that the unsized operator delete knows how many bytes are released. The
+// header keeps the block aligned for every fundamental type.
+constexpr std::size_t header_size{alignof(std::max_align_t)};
+
+void record_allocation(std::size_t size) noexcept {
+  allocation_count_.fetch_add(1, std::memory_order_relaxed);
+  const auto current{
+      current_bytes_.fetch_add(size, std::memory_order_relaxed) + size};
+
+  auto peak{peak_bytes_.load(std::memory_order_relaxed)};
+  while (current > peak && !peak_bytes_.compare_exchange_weak(
+                               peak, current, std::memory_order_relaxed)) {
+  }
+}
+
+void* allocate(std::size_t size) noexcept {
+  auto* block{static_cast<std::byte*>(std::malloc(size + header_size))};
+  if (block == nullptr) {
+    return nullptr;
+  }
+  *reinterpret_cast<std::size_t*>(block) = size;
+  record_allocation(size);
+  return block + header_size;
+}
+
+void deallocate(void* pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto* block{static_cast<std::byte*>(pointer) - header_size};
+  current_bytes_.fetch_sub(*reinterpret_cast<std::size_t*>(block),
+                           std::memory_order_relaxed);
+  std::free(block);
+}
+
+}  // namespace
+
+std::size_t current_bytes() noexcept {
+  return current_bytes_.load(std::memory_order_relaxed);
+}
+
+std::size_t peak_bytes() noexcept {
+  return peak_bytes_.load(std::memory_order_relaxed);
+}
+
+std::size_t allocation_count() noexcept {
+  return allocation_count_.load(std::memory_order_relaxed);
+}
+
+void reset_peak() noexcept {
+  peak_bytes_.store(current_bytes(), std::memory_order_relaxed);
+}
+
+}  // namespace graaf::perf::memory
+
+void* operator new(std::size_t size) {
+  if (auto* pointer{graaf::perf::memory::allocate(size)}) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return graaf::perf::memory::allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return graaf::perf::memory::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+  graaf::perf::memory::deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  graaf::perf::memory::deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+  graaf::perf::memory::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept {
+  graaf::perf::memory::deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept {
+  graaf::perf::memory::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept {
+  graaf::perf::memory::deallocate(pointer);
+}
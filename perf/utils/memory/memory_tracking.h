@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * The perf target replaces the global allocation functions, such that every
+ * allocation made through operator new is counted. Allocations made through
+ * the aligned overloads are not tracked.
+ */
+namespace graaf::perf::memory {
+
+/**
+ * @brief The number of bytes currently allocated through operator new.
+ */
+[[nodiscard]] std::size_t current_bytes() noexcept;
+
+/**
+ * @brief The largest number of bytes allocated at once since the last call to
+ * reset_peak.
+ */
+[[nodiscard]] std::size_t peak_bytes() noexcept;
+
+/**
+ * @brief The total number of allocations made through operator new.
+ */
+[[nodiscard]] std::size_t allocation_count() noexcept;
+
+/**
+ * @brief Resets the peak to the number of bytes currently allocated.
+ */
+void reset_peak() noexcept;
+
+}  // namespace graaf::perf::memory
@@ -0,0 +1,137 @@
+#include <fmt/core.h>
+#include <graaflib/algorithm/centrality/betweenness_centrality.h>
+#include <graaflib/generators/erdos_renyi.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace graaf::algorithm {
+
+TEST(BetweennessCentralityTest, UndirectedStar) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto center{graph.add_vertex(0)};
+  for (int leaf{0}; leaf < 4; ++leaf) {
+    graph.add_edge(center, graph.add_vertex(0), 1);
+  }
+
+  // WHEN
+  const auto centrality{betweenness_centrality(graph)};
+  const auto normalized_centrality{
+      betweenness_centrality(graph, {.normalized = true})};
+
+  // THEN - The center lies between each of the 6 pairs of leaves
+  for (const auto& [vertex_id, score] : centrality) {
+    ASSERT_DOUBLE_EQ(score, vertex_id == center ? 6 : 0);
+  }
+  ASSERT_DOUBLE_EQ(normalized_centrality.at(center), 1);
+}
+
+TEST(BetweennessCentralityTest, DirectedPath) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+
+  // WHEN
+  const auto centrality{betweenness_centrality(graph)};
+
+  // THEN
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_1), 0);
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_2), 1);
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_3), 0);
+}
+
+TEST(BetweennessCentralityTest, WeightsDecideTheShortestPaths) {
+  // GIVEN - A cycle of four vertices with two heavy edges
+  undirected_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+  graph.add_edge(vertex_id_3, vertex_id_4, 5);
+  graph.add_edge(vertex_id_4, vertex_id_1, 5);
+
+  // WHEN
+  const auto centrality{betweenness_centrality(graph)};
+  const auto unweighted_centrality{
+      betweenness_centrality(graph, {.weighted = false})};
+
+  // THEN - Both paths between 2 and 4 are equally long
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_1), 0.5);
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_2), 1);
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_3), 0.5);
+  ASSERT_DOUBLE_EQ(centrality.at(vertex_id_4), 0);
+  for (const auto& [_, score] : unweighted_centrality) {
+    ASSERT_DOUBLE_EQ(score, 0.5);
+  }
+}
+
+TEST(BetweennessCentralityTest, ParallelMatchesSequential) {
+  // GIVEN
+  const auto graph{generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      400, 0.01, {.seed = 21, .min_weight = 1, .max_weight = 4})};
+
+  // WHEN
+  const auto centrality{betweenness_centrality(graph)};
+  const auto parallel_centrality{
+      betweenness_centrality(execution::par, graph)};
+
+  // THEN
+  for (const auto& [vertex_id, score] : centrality) {
+    ASSERT_NEAR(parallel_centrality.at(vertex_id), score, 1e-6);
+  }
+}
+
+TEST(BetweennessCentralityTest, SampledCentralityIsWithinErrorBound) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+          2000, 0.003, {.seed = 4})};
+  const double epsilon{0.1};
+  const auto sample_count{betweenness_sample_count(2000, epsilon, 0.1)};
+  ASSERT_LT(sample_count, 2000);
+
+  // WHEN
+  const auto centrality{betweenness_centrality(graph, {.normalized = true})};
+  const auto sampled_centrality{betweenness_centrality(
+      graph,
+      {.normalized = true, .sample_count = sample_count, .seed = 9})};
+
+  // THEN
+  for (const auto& [vertex_id, score] : centrality) {
+    ASSERT_NEAR(sampled_centrality.at(vertex_id), score, epsilon);
+  }
+}
+
+TEST(BetweennessCentralityTest, NegativeWeightThrows) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, -1);
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto centrality{
+              betweenness_centrality(graph)};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(),
+                       fmt::format("Negative edge weight [{}] between vertices "
+                                   "[{}] -> [{}].",
+                                   -1, vertex_id_1, vertex_id_2)
+                           .c_str());
+          throw;
+        }
+      },
+      std::invalid_argument);
+}
+
+}  // namespace graaf::algorithm
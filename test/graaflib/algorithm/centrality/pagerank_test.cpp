@@ -0,0 +1,188 @@
+#include <graaflib/algorithm/centrality/pagerank.h>
+#include <graaflib/csr_graph.h>
+#include <graaflib/generators/erdos_renyi.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace graaf::algorithm {
+
+TEST(PageRankTest, DanglingRankIsSpreadOverAllVertices) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+
+  // WHEN
+  const auto ranks{pagerank(graph, {.tolerance = 1e-12})};
+
+  // THEN - With r1 + r2 = 1 and r1 = 0.15 / 2 + 0.85 * r2 / 2
+  ASSERT_NEAR(ranks.at(vertex_id_1), 0.5 / 1.425, 1e-9);
+  ASSERT_NEAR(ranks.at(vertex_id_2), 1 - 0.5 / 1.425, 1e-9);
+}
+
+TEST(PageRankTest, SymmetricGraphHasUniformRanks) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+  graph.add_edge(vertex_id_3, vertex_id_1, 1);
+
+  // WHEN
+  const auto ranks{pagerank(graph)};
+
+  // THEN
+  ASSERT_EQ(ranks.size(), 3);
+  for (const auto& [_, rank] : ranks) {
+    ASSERT_NEAR(rank, 1.0 / 3, 1e-9);
+  }
+}
+
+TEST(PageRankTest, AllOverloadsAgree) {
+  // GIVEN
+  const auto graph{generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      2000, 0.002, {.seed = 3})};
+  const auto csr{make_csr_graph(graph)};
+
+  // WHEN
+  const auto ranks{pagerank(graph)};
+  const auto parallel_ranks{pagerank(execution::par, graph)};
+  const auto csr_ranks{pagerank(csr)};
+  const auto parallel_csr_ranks{pagerank(execution::par, csr)};
+
+  // THEN
+  double total_rank{0};
+  for (const auto& [vertex_id, rank] : ranks) {
+    total_rank += rank;
+    const auto index{csr.index(vertex_id)};
+    ASSERT_NEAR(parallel_ranks.at(vertex_id), rank, 1e-12);
+    ASSERT_NEAR(csr_ranks[index], rank, 1e-12);
+    ASSERT_NEAR(parallel_csr_ranks[index], rank, 1e-12);
+  }
+  ASSERT_NEAR(total_rank, 1, 1e-9);
+}
+
+TEST(PageRankTest, PersonalizedPageRankWithUniformTeleportIsPageRank) {
+  // GIVEN
+  const auto graph{generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      300, 0.01, {.seed = 8})};
+  std::unordered_map<vertex_id_t, double> teleport{};
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    teleport.emplace(vertex_id, 2);
+  }
+
+  // WHEN
+  const auto ranks{pagerank(graph, {.tolerance = 1e-12})};
+  const auto personalized_ranks{
+      personalized_pagerank(graph, teleport, {.epsilon = 1e-10})};
+
+  // THEN
+  for (const auto& [vertex_id, rank] : ranks) {
+    ASSERT_NEAR(personalized_ranks.at(vertex_id), rank, 1e-6);
+  }
+}
+
+TEST(PageRankTest, PersonalizedPageRankOnlyReachesConnectedVertices) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_1, 1);
+  graph.add_edge(vertex_id_3, vertex_id_4, 1);
+  const auto csr{make_csr_graph(graph)};
+
+  // WHEN
+  const auto ranks{personalized_pagerank(graph, {{vertex_id_1, 1}})};
+  const auto csr_ranks{personalized_pagerank(csr, {{vertex_id_1, 1}})};
+
+  // THEN - The teleport vertex ranks highest, others are not visited
+  ASSERT_EQ(ranks.size(), 2);
+  ASSERT_GT(ranks.at(vertex_id_1), ranks.at(vertex_id_2));
+  ASSERT_NEAR(ranks.at(vertex_id_1) + ranks.at(vertex_id_2), 1, 1e-5);
+  ASSERT_EQ(csr_ranks.size(), 2);
+  ASSERT_NEAR(csr_ranks.at(vertex_id_1), ranks.at(vertex_id_1), 1e-9);
+}
+
+TEST(PageRankTest, PersonalizedPageRankUnknownVertexThrows) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  [[maybe_unused]] const auto vertex_id_1{graph.add_vertex(10)};
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto ranks{
+              personalized_pagerank(graph, {{5, 1}})};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(), "Vertex with ID [5] not found in graph.");
+          throw;
+        }
+      },
+      std::invalid_argument);
+  ASSERT_THROW(
+      [[maybe_unused]] const auto ranks{
+          personalized_pagerank(graph, {{vertex_id_1, 0}})},
+      std::invalid_argument);
+}
+
+TEST(PageRankTest, PersonalizedPageRankInvalidDampingFactorThrows) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_1, 1);
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto ranks{personalized_pagerank(
+              graph, {{vertex_id_1, 1}}, {.damping_factor = 1})};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(), "Damping factor [1] must be in [0, 1).");
+          throw;
+        }
+      },
+      std::invalid_argument);
+  ASSERT_THROW(
+      [[maybe_unused]] const auto ranks{personalized_pagerank(
+          graph, {{vertex_id_1, 1}}, {.damping_factor = -0.5})},
+      std::invalid_argument);
+}
+
+TEST(PageRankTest, PersonalizedPageRankInvalidEpsilonThrows) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_1, 1);
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto ranks{personalized_pagerank(
+              graph, {{vertex_id_1, 1}}, {.epsilon = 0})};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(), "Epsilon [0] must be positive.");
+          throw;
+        }
+      },
+      std::invalid_argument);
+  ASSERT_THROW(
+      [[maybe_unused]] const auto ranks{personalized_pagerank(
+          make_csr_graph(graph), {{vertex_id_1, 1}}, {.epsilon = -1e-7})},
+      std::invalid_argument);
+}
+
+}  // namespace graaf::algorithm
@@ -1,4 +1,5 @@
 #include <graaflib/algorithm/coloring/greedy_graph_coloring.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
@@ -153,4 +154,20 @@ TYPED_TEST(GreedyGraphColoringTest, DisconnectedComponents) {
   }
 }
 
+TEST(GreedyGraphColoringParallelTest, ParallelColoringIsValid) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(2'000,
+                                                                    0.01)};
+
+  // WHEN
+  const auto coloring{greedy_graph_coloring(execution::par, graph)};
+
+  // THEN
+  ASSERT_EQ(coloring.size(), graph.vertex_count());
+  for (const auto& [edge_id, _] : graph.get_edges()) {
+    ASSERT_NE(coloring.at(edge_id.first), coloring.at(edge_id.second));
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
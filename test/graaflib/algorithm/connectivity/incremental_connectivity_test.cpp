@@ -0,0 +1,174 @@
+#include <graaflib/algorithm/connectivity/incremental_connectivity.h>
+#include <graaflib/algorithm/shortest_path/bfs_shortest_path.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace graaf::algorithm {
+
+namespace {
+
+undirected_graph<int, int> make_graph(std::size_t vertex_count) {
+  undirected_graph<int, int> graph{};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(0)};
+  }
+  return graph;
+}
+
+}  // namespace
+
+TEST(IncrementalConnectivityTest, AddedEdgesAreMergedWithoutRebuild) {
+  // GIVEN
+  auto graph{make_graph(4)};
+  incremental_connectivity connectivity{graph};
+  graph.set_observer(&connectivity);
+  ASSERT_FALSE(connectivity.connected(0, 1));
+  ASSERT_EQ(connectivity.component_count(), 4);
+
+  // WHEN
+  graph.add_edge(0, 1, 1);
+  graph.add_edge(2, 1, 1);
+  const auto vertex_id_4{graph.add_vertex(0)};
+  graph.add_edge(3, vertex_id_4, 1);
+
+  // THEN
+  ASSERT_TRUE(connectivity.connected(0, 2));
+  ASSERT_TRUE(connectivity.connected(vertex_id_4, 3));
+  ASSERT_FALSE(connectivity.connected(0, vertex_id_4));
+  ASSERT_EQ(connectivity.connected({{1, 2}, {2, 3}, {3, 3}}),
+            (std::vector<bool>{true, false, true}));
+  ASSERT_EQ(connectivity.component_count(), 2);
+  ASSERT_EQ(connectivity.rebuild_count(), 0);
+
+  graph.set_observer(nullptr);
+}
+
+TEST(IncrementalConnectivityTest, RemovalRebuildsLazily) {
+  // GIVEN
+  auto graph{make_graph(3)};
+  graph.add_edge(0, 1, 1);
+  graph.add_edge(1, 2, 1);
+  incremental_connectivity connectivity{graph};
+  graph.set_observer(&connectivity);
+
+  // WHEN
+  graph.remove_edge(1, 2);
+  graph.add_edge(0, 2, 1);
+  graph.remove_edge(0, 1);
+
+  // THEN - The index is rebuilt once, on the next query
+  ASSERT_EQ(connectivity.rebuild_count(), 0);
+  ASSERT_TRUE(connectivity.connected(0, 2));
+  ASSERT_FALSE(connectivity.connected(0, 1));
+  ASSERT_EQ(connectivity.rebuild_count(), 1);
+
+  // WHEN - THEN - Vertex removal is handled the same way
+  graph.remove_vertex(0);
+  ASSERT_EQ(connectivity.component_count(), 2);
+  ASSERT_EQ(connectivity.rebuild_count(), 2);
+
+  graph.set_observer(nullptr);
+}
+
+TEST(IncrementalConnectivityTest, UnobservedChangesAreDetected) {
+  // GIVEN
+  auto graph{make_graph(3)};
+  incremental_connectivity connectivity{graph};
+
+  // WHEN
+  graph.add_edge(0, 2, 1);
+
+  // THEN
+  ASSERT_TRUE(connectivity.connected(0, 2));
+  ASSERT_EQ(connectivity.rebuild_count(), 1);
+
+  // WHEN - The index is attached after another unobserved change
+  graph.add_edge(1, 2, 1);
+  graph.set_observer(&connectivity);
+  graph.add_edge(0, 1, 1);
+  graph.remove_edge(0, 2);
+
+  // THEN
+  ASSERT_TRUE(connectivity.connected(0, 2));
+  ASSERT_EQ(connectivity.component_count(), 1);
+
+  graph.set_observer(nullptr);
+}
+
+TEST(IncrementalConnectivityTest, AssignmentRebuildsLazily) {
+  // GIVEN - Two graphs with the same vertices but different edges
+  auto graph{make_graph(3)};
+  graph.add_edge(0, 1, 1);
+  auto other_graph{make_graph(3)};
+  other_graph.add_edge(1, 2, 1);
+  incremental_connectivity connectivity{graph};
+  graph.set_observer(&connectivity);
+  ASSERT_TRUE(connectivity.connected(0, 1));
+
+  // WHEN
+  graph = other_graph;
+  [[maybe_unused]] const auto vertex_id_3{graph.add_vertex(0)};
+
+  // THEN
+  ASSERT_FALSE(connectivity.connected(0, 1));
+  ASSERT_TRUE(connectivity.connected(1, 2));
+  ASSERT_EQ(connectivity.component_count(), 3);
+  ASSERT_EQ(connectivity.rebuild_count(), 1);
+
+  graph.set_observer(nullptr);
+}
+
+TEST(IncrementalConnectivityTest, UnknownVertexThrows) {
+  // GIVEN
+  auto graph{make_graph(2)};
+  incremental_connectivity connectivity{graph};
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto connected{connectivity.connected(0, 5)};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(), "Vertex with ID [5] not found in graph.");
+          throw;
+        }
+      },
+      std::invalid_argument);
+}
+
+TEST(IncrementalConnectivityTest, RandomChangesMatchBreadthFirstSearch) {
+  // GIVEN
+  constexpr std::size_t vertex_count{60};
+  auto graph{make_graph(vertex_count)};
+  incremental_connectivity connectivity{graph};
+  graph.set_observer(&connectivity);
+
+  std::mt19937 generator{11};
+  std::uniform_int_distribution<vertex_id_t> vertex_distribution{
+      0, vertex_count - 1};
+  std::uniform_int_distribution<int> action_distribution{0, 9};
+
+  for (std::size_t round{0}; round < 300; ++round) {
+    // WHEN - Mostly additions, with the occasional removal
+    const auto lhs{vertex_distribution(generator)};
+    const auto rhs{vertex_distribution(generator)};
+    if (action_distribution(generator) == 0 && graph.has_edge(lhs, rhs)) {
+      graph.remove_edge(lhs, rhs);
+    } else if (lhs != rhs) {
+      graph.add_edge(lhs, rhs, 1);
+    }
+
+    // THEN
+    const auto query_lhs{vertex_distribution(generator)};
+    const auto query_rhs{vertex_distribution(generator)};
+    ASSERT_EQ(connectivity.connected(query_lhs, query_rhs),
+              bfs_shortest_path(graph, query_lhs, query_rhs).has_value());
+  }
+
+  graph.set_observer(nullptr);
+}
+
+}  // namespace graaf::algorithm
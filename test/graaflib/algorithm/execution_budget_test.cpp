@@ -0,0 +1,132 @@
+#include <graaflib/algorithm/execution_budget.h>
+#include <graaflib/algorithm/graph_traversal/breadth_first_search.h>
+#include <graaflib/algorithm/shortest_path/bellman_ford.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_path.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/algorithm/shortest_path/floyd_warshall.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <stop_token>
+#include <vector>
+
+namespace graaf::algorithm {
+
+namespace {
+
+// A directed path 0 -> 1 -> ... -> vertex_count - 1 with unit weights
+directed_graph<int, int> create_path_graph(std::size_t vertex_count) {
+  directed_graph<int, int> graph{};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(0)};
+  }
+  for (std::size_t vertex{1}; vertex < vertex_count; ++vertex) {
+    graph.add_edge(vertex - 1, vertex, 1);
+  }
+  return graph;
+}
+
+}  // namespace
+
+TEST(ExecutionBudgetTest, UnlimitedBudgetCompletes) {
+  // GIVEN
+  const auto graph{create_path_graph(100)};
+  execution_budget budget{execution_limits{}};
+
+  // WHEN
+  const auto shortest_paths{dijkstra_shortest_paths(graph, 0, budget)};
+
+  // THEN
+  EXPECT_EQ(budget.status(), execution_status::COMPLETED);
+  EXPECT_EQ(shortest_paths.size(), 100);
+  EXPECT_EQ(budget.edges_relaxed(), 99);
+}
+
+TEST(ExecutionBudgetTest, WorkBudgetStopsDijkstraWithPartialResult) {
+  // GIVEN
+  const auto graph{create_path_graph(100)};
+  execution_budget budget{execution_limits{.max_edge_relaxations = 10}};
+
+  // WHEN
+  const auto shortest_paths{dijkstra_shortest_paths(graph, 0, budget)};
+
+  // THEN - Every vertex has at most one outgoing edge, so there is no overshoot
+  EXPECT_EQ(budget.status(), execution_status::WORK_BUDGET_EXHAUSTED);
+  EXPECT_EQ(budget.edges_relaxed(), 10);
+  ASSERT_EQ(shortest_paths.size(), 11);
+  EXPECT_EQ(shortest_paths.at(10).total_weight, 10);
+}
+
+TEST(ExecutionBudgetTest, StoppedSinglePairSearchReturnsNoPath) {
+  // GIVEN
+  const auto graph{create_path_graph(100)};
+  execution_budget budget{execution_limits{.max_edge_relaxations = 10}};
+
+  // WHEN
+  const auto path{dijkstra_shortest_path(graph, 0, 99, budget)};
+
+  // THEN
+  EXPECT_EQ(budget.status(), execution_status::WORK_BUDGET_EXHAUSTED);
+  EXPECT_FALSE(path.has_value());
+}
+
+TEST(ExecutionBudgetTest, ExhaustedBudgetStopsSubsequentAlgorithms) {
+  // GIVEN
+  const auto graph{create_path_graph(100)};
+  execution_budget budget{execution_limits{.max_edge_relaxations = 10}};
+  [[maybe_unused]] const auto first{dijkstra_shortest_paths(graph, 0, budget)};
+
+  // WHEN
+  std::vector<edge_id_t> traversed_edges{};
+  breadth_first_traverse(
+      graph, 0,
+      [&traversed_edges](const edge_id_t& edge) {
+        traversed_edges.push_back(edge);
+      },
+      detail::exhaustive_search_strategy{}, budget);
+
+  // THEN
+  EXPECT_TRUE(traversed_edges.empty());
+  EXPECT_EQ(budget.edges_relaxed(), 10);
+}
+
+TEST(ExecutionBudgetTest, CancellationStopsFloydWarshall) {
+  // GIVEN
+  const auto graph{create_path_graph(10)};
+  std::stop_source stop_source{};
+  stop_source.request_stop();
+  execution_budget budget{
+      execution_limits{.stop_token = stop_source.get_token()}};
+
+  // WHEN
+  const auto shortest_paths{floyd_warshall_shortest_paths(graph, budget)};
+
+  // THEN - Only the direct edges are known
+  EXPECT_EQ(budget.status(), execution_status::CANCELLED);
+  EXPECT_EQ(shortest_paths[0][1], 1);
+  EXPECT_EQ(shortest_paths[0][2], std::numeric_limits<int>::max());
+}
+
+TEST(ExecutionBudgetTest, DeadlineStopsBellmanFordBeforeNegativeCycleCheck) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(1)};
+  const auto vertex_id_2{graph.add_vertex(2)};
+  graph.add_edge(vertex_id_1, vertex_id_2, -1);
+  graph.add_edge(vertex_id_2, vertex_id_1, -1);
+
+  execution_budget budget{
+      execution_limits{.time_budget = std::chrono::nanoseconds{0}}};
+
+  // WHEN - THEN
+  EXPECT_NO_THROW({
+    [[maybe_unused]] const auto shortest_paths{
+        bellman_ford_shortest_paths(graph, vertex_id_1, budget)};
+  });
+  EXPECT_EQ(budget.status(), execution_status::DEADLINE_EXCEEDED);
+}
+
+}  // namespace graaf::algorithm
@@ -1,8 +1,10 @@
 #include <graaflib/algorithm/graph_traversal/breadth_first_search.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 #include <utils/scenarios/scenarios.h>
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -136,6 +138,38 @@ TYPED_TEST(TypedGraphTraversalTestBFS, MoreComplexGraphBFS) {
                   edge_order.at({vertex_ids[2], vertex_ids[4]}));
 }
 
+TYPED_TEST(TypedGraphTraversalTestBFS, DiamondGraphBFSVisitsVerticesOnce) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  const auto vertex_3{graph.add_vertex(30)};
+  const auto vertex_4{graph.add_vertex(40)};
+
+  // Vertex 4 is reachable through both vertex 2 and vertex 3
+  graph.add_edge(vertex_1, vertex_2, 100);
+  graph.add_edge(vertex_1, vertex_3, 200);
+  graph.add_edge(vertex_2, vertex_4, 300);
+  graph.add_edge(vertex_3, vertex_4, 400);
+
+  seen_edges_t seen_edges{};
+  edge_order_t edge_order{};
+
+  // WHEN
+  breadth_first_traverse(graph, vertex_1,
+                         record_edge_callback{seen_edges, edge_order});
+
+  // THEN - Every vertex is discovered through exactly one edge
+  ASSERT_EQ(seen_edges.size(), 3);
+  ASSERT_EQ(seen_edges.count({vertex_1, vertex_2}), 1);
+  ASSERT_EQ(seen_edges.count({vertex_1, vertex_3}), 1);
+  ASSERT_EQ(seen_edges.count({vertex_2, vertex_4}) +
+                seen_edges.count({vertex_3, vertex_4}),
+            1);
+}
+
 TYPED_TEST(TypedGraphTraversalTestBFS,
            MoreComplexGraphBFSImmediateTermination) {
   // GIVEN
@@ -247,4 +281,31 @@ TEST(GraphTraversalTest, MoreComplexDirectedGraphEdgeWrongDirectionBFS) {
   ASSERT_EQ(seen_edges, expected_edges);
 }
 
+TEST(GraphTraversalTest, ParallelBFSReachesSameVertices) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(2'000,
+                                                                  0.002)};
+
+  std::unordered_set<vertex_id_t> sequential_reached{0};
+  breadth_first_traverse(graph, 0, [&](const edge_id_t& edge) {
+    sequential_reached.insert(edge.second);
+  });
+
+  // WHEN
+  std::mutex mutex{};
+  std::unordered_multiset<vertex_id_t> parallel_reached{0};
+  breadth_first_traverse(execution::par, graph, 0,
+                         [&](const edge_id_t& edge) {
+                           const std::lock_guard lock{mutex};
+                           parallel_reached.insert(edge.second);
+                         });
+
+  // THEN - Every vertex is reached through exactly one edge
+  ASSERT_EQ(parallel_reached.size(), sequential_reached.size());
+  for (const auto vertex_id : sequential_reached) {
+    ASSERT_EQ(parallel_reached.count(vertex_id), 1);
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
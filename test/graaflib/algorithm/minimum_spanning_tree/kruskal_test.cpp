@@ -1,9 +1,11 @@
 #include <fmt/core.h>
 #include <graaflib/algorithm/minimum_spanning_tree/kruskal.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 #include <utils/scenarios/scenarios.h>
 
+#include <unordered_set>
 #include <utility>
 
 namespace graaf::algorithm {
@@ -168,4 +170,49 @@ TYPED_TEST(MSTTest, CustomEdgeVertexOneComponentGraph) {
   ASSERT_EQ(expected_mst, mst);
 }
 
+TEST(MSTEqualWeightTest, ManyEdgesWithEqualWeights) {
+  // GIVEN - Edges of equal weight are ordered by their vertices, which the
+  // sort requires to be a strict weak ordering
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+          2'000, 0.005, {.seed = 11, .min_weight = 1, .max_weight = 1})};
+
+  // WHEN
+  const auto mst{kruskal_minimum_spanning_tree(graph)};
+
+  // THEN - The graph is connected, so the tree spans every vertex
+  ASSERT_EQ(mst.size(), graph.vertex_count() - 1);
+  std::unordered_set<vertex_id_t> spanned_vertices{};
+  for (const auto& [vertex_a, vertex_b] : mst) {
+    ASSERT_TRUE(graph.has_edge(vertex_a, vertex_b));
+    spanned_vertices.insert(vertex_a);
+    spanned_vertices.insert(vertex_b);
+  }
+  ASSERT_EQ(spanned_vertices.size(), graph.vertex_count());
+}
+
+TEST(MSTParallelTest, ParallelKruskalHasMinimumWeight) {
+  // GIVEN - Two components, such that the result is a forest
+  auto graph{generators::erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+      2'000, 0.005, {.seed = 11, .min_weight = 1, .max_weight = 100})};
+  [[maybe_unused]] const auto isolated_vertex{graph.add_vertex(0)};
+
+  const auto total_weight{[&graph](const std::vector<edge_id_t>& edges) {
+    long weight{0};
+    for (const auto& [vertex_a, vertex_b] : edges) {
+      weight += graph.get_edge(vertex_a, vertex_b);
+    }
+    return weight;
+  }};
+
+  // WHEN
+  const auto sequential_mst{kruskal_minimum_spanning_tree(graph)};
+  const auto parallel_mst{
+      kruskal_minimum_spanning_tree(execution::par, graph)};
+
+  // THEN
+  ASSERT_EQ(parallel_mst.size(), sequential_mst.size());
+  ASSERT_EQ(total_weight(parallel_mst), total_weight(sequential_mst));
+}
+
 }  // namespace graaf::algorithm
@@ -0,0 +1,148 @@
+#include <graaflib/algorithm/graph_traversal/depth_first_search.h>
+#include <graaflib/algorithm/observer.h>
+#include <graaflib/algorithm/shortest_path/bfs_shortest_path.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace graaf::algorithm {
+
+namespace {
+
+// A directed path 0 -> 1 -> 2 -> 3 with unit weights
+directed_graph<int, int> create_path_graph() {
+  directed_graph<int, int> graph{};
+  const auto vertex_id_0{graph.add_vertex(0)};
+  const auto vertex_id_1{graph.add_vertex(1)};
+  const auto vertex_id_2{graph.add_vertex(2)};
+  const auto vertex_id_3{graph.add_vertex(3)};
+  graph.add_edge(vertex_id_0, vertex_id_1, 1);
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+  return graph;
+}
+
+void expect_statistics_eq(const algorithm_statistics& actual,
+                          const algorithm_statistics& expected) {
+  EXPECT_EQ(actual.vertices_settled, expected.vertices_settled);
+  EXPECT_EQ(actual.edges_relaxed, expected.edges_relaxed);
+  EXPECT_EQ(actual.queue_pushes, expected.queue_pushes);
+  EXPECT_EQ(actual.queue_pops, expected.queue_pops);
+  EXPECT_EQ(actual.peak_queue_size, expected.peak_queue_size);
+}
+
+}  // namespace
+
+TEST(ObserverTest, StatisticsObserverCountsDijkstraWork) {
+  // GIVEN
+  const auto graph{create_path_graph()};
+  statistics_observer observer{};
+
+  // WHEN
+  const auto shortest_paths{dijkstra_shortest_paths(graph, 0, observer)};
+
+  // THEN
+  ASSERT_EQ(shortest_paths.size(), 4);
+  expect_statistics_eq(observer.statistics(), {.vertices_settled = 4,
+                                               .edges_relaxed = 3,
+                                               .queue_pushes = 4,
+                                               .queue_pops = 4,
+                                               .peak_queue_size = 1});
+}
+
+TEST(ObserverTest, StatisticsObserverAccumulatesAndResets) {
+  // GIVEN
+  const auto graph{create_path_graph()};
+  statistics_observer observer{};
+
+  // WHEN
+  [[maybe_unused]] const auto first{
+      dijkstra_shortest_paths(graph, 0, observer)};
+  [[maybe_unused]] const auto second{
+      dijkstra_shortest_paths(graph, 2, observer)};
+
+  // THEN - The second run settles vertices 2 and 3
+  EXPECT_EQ(observer.statistics().vertices_settled, 6);
+  EXPECT_EQ(observer.statistics().edges_relaxed, 4);
+
+  // WHEN
+  observer.reset();
+
+  // THEN
+  expect_statistics_eq(observer.statistics(), {});
+}
+
+TEST(ObserverTest, StatisticsObserverDepthFirstTraverseQueueIsRecursionDepth) {
+  // GIVEN
+  const auto graph{create_path_graph()};
+  statistics_observer observer{};
+
+  // WHEN
+  depth_first_traverse(graph, 0, detail::noop_callback{},
+                       detail::exhaustive_search_strategy{}, observer);
+
+  // THEN
+  expect_statistics_eq(observer.statistics(), {.vertices_settled = 4,
+                                               .edges_relaxed = 3,
+                                               .queue_pushes = 4,
+                                               .queue_pops = 4,
+                                               .peak_queue_size = 4});
+}
+
+TEST(ObserverTest, TracingObserverReportsNestedSpans) {
+  // GIVEN
+  const auto graph{create_path_graph()};
+  std::vector<trace_span> spans{};
+  tracing_observer observer{
+      [&spans](const trace_span& span) { spans.push_back(span); }};
+
+  // WHEN
+  const auto path{bfs_shortest_path(graph, 0, 3, observer)};
+
+  // THEN - The traversal is reported before the enclosing shortest path
+  ASSERT_TRUE(path.has_value());
+  ASSERT_EQ(spans.size(), 2);
+
+  EXPECT_EQ(spans[0].algorithm, "breadth_first_traverse");
+  EXPECT_EQ(spans[0].depth, 1);
+  EXPECT_EQ(spans[1].algorithm, "bfs_shortest_path");
+  EXPECT_EQ(spans[1].depth, 0);
+  EXPECT_LE(spans[1].begin, spans[0].begin);
+  EXPECT_LE(spans[0].end, spans[1].end);
+
+  // The search terminates when vertex 3 is popped, before it is settled
+  const algorithm_statistics expected{.vertices_settled = 3,
+                                      .edges_relaxed = 3,
+                                      .queue_pushes = 4,
+                                      .queue_pops = 4,
+                                      .peak_queue_size = 1};
+  expect_statistics_eq(spans[0].statistics, expected);
+  expect_statistics_eq(spans[1].statistics, expected);
+}
+
+TEST(ObserverTest, TracingObserverReportsSpanOfThrowingAlgorithm) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(1)};
+  const auto vertex_id_2{graph.add_vertex(2)};
+  graph.add_edge(vertex_id_1, vertex_id_2, -1);
+
+  std::vector<std::string_view> algorithms{};
+  tracing_observer observer{[&algorithms](const trace_span& span) {
+    algorithms.push_back(span.algorithm);
+  }};
+
+  // WHEN - THEN
+  EXPECT_THROW(
+      { [[maybe_unused]] const auto paths{
+            dijkstra_shortest_paths(graph, vertex_id_1, observer)}; },
+      std::invalid_argument);
+  ASSERT_EQ(algorithms.size(), 1);
+  EXPECT_EQ(algorithms.front(), "dijkstra_shortest_paths");
+}
+
+}  // namespace graaf::algorithm
@@ -1,4 +1,5 @@
 #include <graaflib/algorithm/shortest_path/bellman_ford.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
@@ -155,4 +156,72 @@ TYPED_TEST(BellmanFordShortestPathsSignedTypesTest,
       std::invalid_argument);
 }
 
+TEST(BellmanFordShortestPathsTest, ParallelBellmanFordMatchesSequential) {
+  // GIVEN - A random graph with some negative edges but no negative cycles
+  auto graph{generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      500, 0.01, {.seed = 3, .min_weight = 1, .max_weight = 20})};
+  const auto extra_vertex{graph.add_vertex(0)};
+  graph.add_edge(0, extra_vertex, -5);
+  graph.add_edge(extra_vertex, 1, -5);
+
+  // WHEN
+  const auto sequential_paths{bellman_ford_shortest_paths(graph, 0)};
+  const auto parallel_paths{
+      bellman_ford_shortest_paths(execution::par, graph, 0)};
+
+  // THEN
+  ASSERT_EQ(parallel_paths.size(), sequential_paths.size());
+  for (const auto& [vertex_id, path] : sequential_paths) {
+    const auto& parallel_path{parallel_paths.at(vertex_id)};
+    ASSERT_EQ(parallel_path.total_weight, path.total_weight);
+    ASSERT_EQ(parallel_path.vertices.back(), vertex_id);
+  }
+}
+
+TEST(BellmanFordShortestPathsTest,
+     ParallelBellmanFordMatchesSequentialUndirected) {
+  // GIVEN - An undirected graph, including a negative edge
+  undirected_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 5);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+  graph.add_edge(vertex_id_3, vertex_id_4, -1);
+
+  for (const auto start_vertex :
+       {vertex_id_1, vertex_id_2, vertex_id_3, vertex_id_4}) {
+    // WHEN
+    const auto sequential_paths{
+        bellman_ford_shortest_paths(graph, start_vertex)};
+    const auto parallel_paths{
+        bellman_ford_shortest_paths(execution::par, graph, start_vertex)};
+
+    // THEN
+    ASSERT_EQ(parallel_paths.size(), sequential_paths.size());
+    for (const auto& [vertex_id, path] : sequential_paths) {
+      const auto& parallel_path{parallel_paths.at(vertex_id)};
+      ASSERT_EQ(parallel_path.total_weight, path.total_weight);
+      ASSERT_EQ(parallel_path.vertices, path.vertices);
+    }
+  }
+}
+
+TEST(BellmanFordShortestPathsTest, ParallelBellmanFordNegativeCycle) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, -3);
+  graph.add_edge(vertex_id_3, vertex_id_1, 1);
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      (void)bellman_ford_shortest_paths(execution::par, graph, vertex_id_1),
+      std::invalid_argument);
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
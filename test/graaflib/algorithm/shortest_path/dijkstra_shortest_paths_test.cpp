@@ -1,6 +1,7 @@
 #include <fmt/core.h>
 #include <graaflib/algorithm/shortest_path/common.h>
 #include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
@@ -152,4 +153,120 @@ TYPED_TEST(DijkstraShortestPathsSignedTypesTest, DijkstraNegativeWeightTree) {
       std::invalid_argument);
 }
 
+TYPED_TEST(DijkstraShortestPathsTest, DijkstraStopsAtTargets) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  using edge_t = typename TestFixture::edge_t;
+  using weight_t = decltype(get_weight(std::declval<edge_t>()));
+
+  graph_t graph{};
+
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, edge_t{static_cast<weight_t>(1)});
+  graph.add_edge(vertex_id_2, vertex_id_3, edge_t{static_cast<weight_t>(2)});
+  graph.add_edge(vertex_id_3, vertex_id_4, edge_t{static_cast<weight_t>(3)});
+
+  // WHEN
+  const auto path_map{
+      dijkstra_shortest_paths(graph, vertex_id_1, {.targets = {vertex_id_2}})};
+
+  // THEN - Vertex 3 was reached but not settled
+  std::unordered_map<vertex_id_t, graph_path<weight_t>> expected_path_map;
+  expected_path_map[vertex_id_1] = {{vertex_id_1}, 0};
+  expected_path_map[vertex_id_2] = {{vertex_id_1, vertex_id_2}, 1};
+  ASSERT_EQ(path_map, expected_path_map);
+}
+
+TYPED_TEST(DijkstraShortestPathsTest, DijkstraMaxDistanceAndMaxSettled) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  using edge_t = typename TestFixture::edge_t;
+  using weight_t = decltype(get_weight(std::declval<edge_t>()));
+
+  graph_t graph{};
+
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, edge_t{static_cast<weight_t>(1)});
+  graph.add_edge(vertex_id_2, vertex_id_3, edge_t{static_cast<weight_t>(2)});
+  graph.add_edge(vertex_id_1, vertex_id_4, edge_t{static_cast<weight_t>(5)});
+
+  // WHEN
+  const auto radius_path_map{dijkstra_shortest_paths(
+      graph, vertex_id_1, {.max_distance = static_cast<weight_t>(3)})};
+  const auto settled_path_map{
+      dijkstra_shortest_paths(graph, vertex_id_1, {.max_settled = 2})};
+
+  // THEN
+  std::unordered_map<vertex_id_t, graph_path<weight_t>> expected_path_map;
+  expected_path_map[vertex_id_1] = {{vertex_id_1}, 0};
+  expected_path_map[vertex_id_2] = {{vertex_id_1, vertex_id_2}, 1};
+  ASSERT_EQ(settled_path_map, expected_path_map);
+
+  expected_path_map[vertex_id_3] = {{vertex_id_1, vertex_id_2, vertex_id_3}, 3};
+  ASSERT_EQ(radius_path_map, expected_path_map);
+}
+
+TEST(DijkstraShortestPathsTest, BoundedDijkstraMatchesFullDijkstra) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+          1'000, 0.005, {.seed = 3, .min_weight = 1, .max_weight = 50})};
+  const auto full_paths{dijkstra_shortest_paths(graph, 0)};
+
+  // WHEN
+  const auto bounded_paths{
+      dijkstra_shortest_paths(graph, 0, {.max_distance = 60})};
+  const auto target_paths{
+      dijkstra_shortest_paths(graph, 0, {.targets = {17, 500}})};
+
+  // THEN - Exactly the vertices within the radius are returned
+  for (const auto& [vertex_id, path] : full_paths) {
+    ASSERT_EQ(bounded_paths.contains(vertex_id), path.total_weight <= 60);
+  }
+  for (const auto& [vertex_id, path] : bounded_paths) {
+    ASSERT_EQ(path.total_weight, full_paths.at(vertex_id).total_weight);
+  }
+
+  ASSERT_LT(target_paths.size(), full_paths.size());
+  for (const auto& [vertex_id, path] : target_paths) {
+    ASSERT_EQ(path.total_weight, full_paths.at(vertex_id).total_weight);
+  }
+  for (const vertex_id_t target : {17, 500}) {
+    ASSERT_EQ(target_paths.contains(target), full_paths.contains(target));
+  }
+}
+
+TEST(DijkstraShortestPathsTest, ParallelDijkstraMatchesSequentialDistances) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+          1'000, 0.005, {.seed = 7, .min_weight = 1, .max_weight = 50})};
+
+  // WHEN
+  const auto sequential_paths{dijkstra_shortest_paths(graph, 0)};
+  const auto parallel_paths{dijkstra_shortest_paths(execution::par, graph, 0)};
+
+  // THEN - Shortest paths may differ on ties, their lengths may not
+  ASSERT_EQ(parallel_paths.size(), sequential_paths.size());
+  for (const auto& [vertex_id, path] : sequential_paths) {
+    const auto& parallel_path{parallel_paths.at(vertex_id)};
+    ASSERT_EQ(parallel_path.total_weight, path.total_weight);
+    ASSERT_EQ(parallel_path.vertices.front(), 0);
+    ASSERT_EQ(parallel_path.vertices.back(), vertex_id);
+
+    int path_weight{0};
+    for (auto vertex{parallel_path.vertices.begin()};
+         std::next(vertex) != parallel_path.vertices.end(); ++vertex) {
+      path_weight += graph.get_edge(*vertex, *std::next(vertex));
+    }
+    ASSERT_EQ(path_weight, path.total_weight);
+  }
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include <fmt/core.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/algorithm/shortest_path/distance_table.h>
+#include <graaflib/generators/erdos_renyi.h>
+#include <gtest/gtest.h>
+#include <utils/fixtures/fixtures.h>
+
+#include <vector>
+
+namespace graaf::algorithm {
+
+namespace {
+
+template <typename T>
+struct DistanceTableTest : public testing::Test {
+  using graph_t = typename T::first_type;
+  using edge_t = typename T::second_type;
+};
+
+TYPED_TEST_SUITE(DistanceTableTest, utils::fixtures::weighted_graph_types);
+
+template <typename T>
+struct DistanceTableSignedTypesTest : public testing::Test {
+  using graph_t = typename T::first_type;
+  using edge_t = typename T::second_type;
+};
+
+TYPED_TEST_SUITE(DistanceTableSignedTypesTest,
+                 utils::fixtures::weighted_graph_signed_types);
+
+template <typename GRAPH_T>
+void expect_table_matches_dijkstra(const GRAPH_T& graph,
+                                   const std::vector<vertex_id_t>& sources,
+                                   const std::vector<vertex_id_t>& targets) {
+  const auto table{many_to_many_distances(graph, sources, targets)};
+
+  ASSERT_EQ(table.sources, sources);
+  ASSERT_EQ(table.targets, targets);
+  ASSERT_EQ(table.distances.size(), sources.size() * targets.size());
+  for (std::size_t row{0}; row < sources.size(); ++row) {
+    const auto paths{dijkstra_shortest_paths(graph, sources[row])};
+    for (std::size_t column{0}; column < targets.size(); ++column) {
+      const auto path{paths.find(targets[column])};
+      const auto expected_distance{
+          path == paths.end() ? table.unreachable : path->second.total_weight};
+      ASSERT_EQ(table.at(row, column), expected_distance);
+    }
+  }
+}
+
+}  // namespace
+
+TYPED_TEST(DistanceTableTest, SimpleDistanceTable) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  using edge_t = typename TestFixture::edge_t;
+  using weight_t = decltype(get_weight(std::declval<edge_t>()));
+
+  graph_t graph{};
+
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, edge_t{static_cast<weight_t>(1)});
+  graph.add_edge(vertex_id_2, vertex_id_3, edge_t{static_cast<weight_t>(2)});
+  graph.add_edge(vertex_id_1, vertex_id_3, edge_t{static_cast<weight_t>(4)});
+
+  // WHEN
+  const auto table{many_to_many_distances(graph, {vertex_id_1, vertex_id_2},
+                                          {vertex_id_2, vertex_id_3})};
+
+  // THEN
+  ASSERT_EQ(table.at(0, 0), static_cast<weight_t>(1));
+  ASSERT_EQ(table.at(0, 1), static_cast<weight_t>(3));
+  ASSERT_EQ(table.at(1, 0), static_cast<weight_t>(0));
+  ASSERT_EQ(table.at(1, 1), static_cast<weight_t>(2));
+
+  // The isolated vertex cannot be reached
+  const auto distances{
+      one_to_many_distances(graph, vertex_id_1, {vertex_id_4, vertex_id_3})};
+  const std::vector<weight_t> expected_distances{
+      distance_table<weight_t>::unreachable, static_cast<weight_t>(3)};
+  ASSERT_EQ(distances, expected_distances);
+}
+
+TYPED_TEST(DistanceTableTest, DuplicateSourcesAndTargets) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  using edge_t = typename TestFixture::edge_t;
+  using weight_t = decltype(get_weight(std::declval<edge_t>()));
+
+  graph_t graph{};
+
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, edge_t{static_cast<weight_t>(5)});
+
+  // WHEN
+  const auto table{many_to_many_distances(
+      graph, {vertex_id_1, vertex_id_1, vertex_id_1},
+      {vertex_id_2, vertex_id_2})};
+
+  // THEN
+  ASSERT_EQ(table.distances,
+            std::vector<weight_t>(6, static_cast<weight_t>(5)));
+}
+
+TYPED_TEST(DistanceTableSignedTypesTest, NegativeWeightThrows) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  using edge_t = typename TestFixture::edge_t;
+  using weight_t = decltype(get_weight(std::declval<edge_t>()));
+
+  graph_t graph{};
+
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, edge_t{static_cast<weight_t>(-1)});
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto table{many_to_many_distances(
+              graph, {vertex_id_1, vertex_id_1}, {vertex_id_2})};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(),
+                       fmt::format("Negative edge weight [{}] between vertices "
+                                   "[{}] -> [{}].",
+                                   -1, vertex_id_1, vertex_id_2)
+                           .c_str());
+          throw;
+        }
+      },
+      std::invalid_argument);
+}
+
+TEST(DistanceTableTest, MissingVertexThrows) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+
+  // WHEN - THEN
+  ASSERT_THROW(
+      {
+        try {
+          [[maybe_unused]] const auto table{
+              many_to_many_distances(graph, {vertex_id_1}, {vertex_id_1 + 1})};
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(), "Vertex with ID [1] not found in graph.");
+          throw;
+        }
+      },
+      std::invalid_argument);
+}
+
+TEST(DistanceTableTest, DistanceTableMatchesDijkstra) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+          500, 0.006, {.seed = 11, .min_weight = 1, .max_weight = 50})};
+  const std::vector<vertex_id_t> few{3, 141, 59, 265};
+  std::vector<vertex_id_t> many{};
+  for (vertex_id_t vertex_id{0}; vertex_id < 500; vertex_id += 7) {
+    many.push_back(vertex_id);
+  }
+
+  // WHEN - THEN - Both the forward and the backward searches are used
+  expect_table_matches_dijkstra(graph, few, many);
+  expect_table_matches_dijkstra(graph, many, few);
+}
+
+TEST(DistanceTableTest, UndirectedDistanceTableMatchesDijkstra) {
+  // GIVEN
+  const auto graph{
+      generators::erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+          300, 0.005, {.seed = 5, .min_weight = 1, .max_weight = 20})};
+
+  // WHEN - THEN
+  expect_table_matches_dijkstra(graph, {0, 1, 2, 3, 4, 5}, {10, 20});
+}
+
+}  // namespace graaf::algorithm
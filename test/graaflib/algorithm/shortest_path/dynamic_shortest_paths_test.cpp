@@ -0,0 +1,144 @@
+#include <fmt/core.h>
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/algorithm/shortest_path/dynamic_shortest_paths.h>
+#include <graaflib/generators/erdos_renyi.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace graaf::algorithm {
+
+namespace {
+
+template <typename GRAPH_T, typename TREE_T>
+void expect_matches_dijkstra(const GRAPH_T& graph, const TREE_T& tree) {
+  const auto expected_paths{dijkstra_shortest_paths(graph, tree.source())};
+  const auto paths{tree.paths()};
+
+  ASSERT_EQ(paths.size(), expected_paths.size());
+  for (const auto& [vertex_id, expected_path] : expected_paths) {
+    const auto& path{paths.at(vertex_id)};
+    ASSERT_EQ(path.total_weight, expected_path.total_weight);
+
+    int path_weight{0};
+    for (auto vertex{path.vertices.begin()};
+         std::next(vertex) != path.vertices.end(); ++vertex) {
+      path_weight += graph.get_edge(*vertex, *std::next(vertex));
+    }
+    ASSERT_EQ(path_weight, path.total_weight);
+  }
+}
+
+}  // namespace
+
+TEST(DynamicShortestPathsTest, RepairsTreeAfterEachChange) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+  graph.add_edge(vertex_id_1, vertex_id_3, 5);
+
+  dynamic_shortest_paths tree{graph, vertex_id_1};
+  ASSERT_EQ(tree.distance(vertex_id_3), 2);
+
+  // WHEN - THEN - A tree edge gets longer
+  graph.get_edge(vertex_id_2, vertex_id_3) = 10;
+  tree.update_edge(vertex_id_2, vertex_id_3);
+  ASSERT_EQ(tree.path(vertex_id_3),
+            (graph_path<int>{{vertex_id_1, vertex_id_3}, 5}));
+
+  // WHEN - THEN - A tree edge is removed
+  graph.remove_edge(vertex_id_1, vertex_id_3);
+  tree.update_edge(vertex_id_1, vertex_id_3);
+  ASSERT_EQ(tree.path(vertex_id_3),
+            (graph_path<int>{{vertex_id_1, vertex_id_2, vertex_id_3}, 11}));
+
+  // WHEN - THEN - The only path is removed
+  graph.remove_edge(vertex_id_1, vertex_id_2);
+  tree.update_edge(vertex_id_1, vertex_id_2);
+  ASSERT_EQ(tree.distance(vertex_id_2), std::nullopt);
+  ASSERT_EQ(tree.path(vertex_id_3), std::nullopt);
+
+  // WHEN - THEN - An edge is added
+  graph.add_edge(vertex_id_1, vertex_id_2, 3);
+  tree.update_edge(vertex_id_1, vertex_id_2);
+  ASSERT_EQ(tree.distance(vertex_id_2), 3);
+  ASSERT_EQ(tree.distance(vertex_id_3), 13);
+}
+
+TEST(DynamicShortestPathsTest, NegativeWeightThrows) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  dynamic_shortest_paths tree{graph, vertex_id_1};
+
+  // WHEN
+  graph.get_edge(vertex_id_1, vertex_id_2) = -1;
+
+  // THEN
+  ASSERT_THROW(
+      {
+        try {
+          tree.update_edge(vertex_id_1, vertex_id_2);
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(),
+                       fmt::format("Negative edge weight [{}] between vertices "
+                                   "[{}] -> [{}].",
+                                   -1, vertex_id_1, vertex_id_2)
+                           .c_str());
+          throw;
+        }
+      },
+      std::invalid_argument);
+}
+
+template <graph_type T>
+void run_random_updates(std::size_t batch_size) {
+  auto graph{generators::erdos_renyi_gnp<int, int, T>(
+      300, 0.01, {.seed = 17, .min_weight = 1, .max_weight = 20})};
+  dynamic_shortest_paths tree{graph, 0};
+
+  std::mt19937 generator{5};
+  std::uniform_int_distribution<vertex_id_t> vertex_distribution{0, 299};
+  std::uniform_int_distribution<int> weight_distribution{0, 30};
+
+  for (std::size_t round{0}; round < 100; ++round) {
+    // Changes may be reported after a whole batch was made
+    std::vector<std::pair<vertex_id_t, vertex_id_t>> changed{};
+    for (std::size_t change{0}; change < batch_size; ++change) {
+      const auto lhs{vertex_distribution(generator)};
+      const auto rhs{vertex_distribution(generator)};
+      if (!graph.has_edge(lhs, rhs)) {
+        graph.add_edge(lhs, rhs, weight_distribution(generator));
+      } else if (weight_distribution(generator) < 10) {
+        graph.remove_edge(lhs, rhs);
+      } else {
+        graph.get_edge(lhs, rhs) = weight_distribution(generator);
+      }
+      changed.emplace_back(lhs, rhs);
+    }
+
+    for (const auto& [lhs, rhs] : changed) {
+      tree.update_edge(lhs, rhs);
+    }
+    expect_matches_dijkstra(graph, tree);
+  }
+}
+
+TEST(DynamicShortestPathsTest, DirectedRandomUpdatesMatchDijkstra) {
+  run_random_updates<graph_type::DIRECTED>(1);
+  run_random_updates<graph_type::DIRECTED>(20);
+}
+
+TEST(DynamicShortestPathsTest, UndirectedRandomUpdatesMatchDijkstra) {
+  run_random_updates<graph_type::UNDIRECTED>(1);
+  run_random_updates<graph_type::UNDIRECTED>(20);
+}
+
+}  // namespace graaf::algorithm
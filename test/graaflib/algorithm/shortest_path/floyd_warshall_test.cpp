@@ -1,4 +1,5 @@
 #include <graaflib/algorithm/shortest_path/floyd_warshall.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
@@ -226,4 +227,19 @@ TYPED_TEST(FloydWarshallTest, DirectedGraphTwoComponents) {
   ASSERT_EQ(shortest_paths, expected_paths);
 }
 
+TEST(FloydWarshallParallelTest, ParallelFloydWarshallMatchesSequential) {
+  // GIVEN
+  auto graph{generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      200, 0.03, {.seed = 5, .min_weight = 1, .max_weight = 20})};
+  graph.add_edge(0, 1, -10);
+
+  // WHEN
+  const auto sequential_distances{floyd_warshall_shortest_paths(graph)};
+  const auto parallel_distances{
+      floyd_warshall_shortest_paths(execution::par, graph)};
+
+  // THEN
+  ASSERT_EQ(parallel_distances, sequential_distances);
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <graaflib/algorithm/shortest_path/dijkstra_shortest_paths.h>
+#include <graaflib/algorithm/shortest_path/monotone_queue.h>
+#include <graaflib/generators/erdos_renyi.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace graaf::algorithm::detail {
+
+namespace {
+
+// Pops every item from the queue while pushing items which are at most
+// max_weight further than the last popped item, and returns the distances in
+// the order they were popped.
+template <typename QUEUE_T>
+std::vector<int> drain_monotone(QUEUE_T& queue, int max_weight) {
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> weight_distribution{0, max_weight};
+
+  std::vector<int> popped{};
+  vertex_id_t next_id{0};
+  queue.push({next_id++, 0, 0});
+  while (!queue.empty()) {
+    const auto current{queue.top()};
+    queue.pop();
+    popped.push_back(current.dist_from_start);
+
+    if (next_id < 2'000) {
+      for (int child{0}; child < 2; ++child) {
+        queue.push({next_id++,
+                    current.dist_from_start + weight_distribution(generator),
+                    current.id});
+      }
+    }
+  }
+  return popped;
+}
+
+}  // namespace
+
+TEST(MonotoneQueueTest, QueuesPopInOrderOfDistance) {
+  // GIVEN
+  std::priority_queue<path_vertex<int>, std::vector<path_vertex<int>>,
+                      std::greater<>>
+      binary_heap{};
+  const auto expected_zero_one{drain_monotone(binary_heap, 1)};
+  const auto expected_dial{drain_monotone(binary_heap, 10)};
+  const auto expected_radix{drain_monotone(binary_heap, 100'000)};
+
+  zero_one_queue<int> zero_one{};
+  dial_queue<int> dial{10};
+  radix_heap<int> radix{};
+
+  // WHEN
+  const auto zero_one_popped{drain_monotone(zero_one, 1)};
+  const auto dial_popped{drain_monotone(dial, 10)};
+  const auto radix_popped{drain_monotone(radix, 100'000)};
+
+  // THEN - The same items are pushed, as the pushed distances only depend on
+  // the popped distances
+  ASSERT_EQ(zero_one_popped, expected_zero_one);
+  ASSERT_EQ(dial_popped, expected_dial);
+  ASSERT_EQ(radix_popped, expected_radix);
+}
+
+TEST(MonotoneQueueTest, DijkstraWithEachQueueFindsShortestPaths) {
+  // GIVEN - Maximum weights selecting 0-1 BFS, Dial's buckets and the radix
+  // heap respectively
+  for (const int max_weight : {1, 100, 1'000'000}) {
+    const auto graph{
+        generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+            400, 0.01,
+            {.seed = 9,
+             .min_weight = 0,
+             .max_weight = static_cast<double>(max_weight)})};
+
+    // WHEN
+    const auto paths{dijkstra_shortest_paths(graph, 0)};
+
+    // THEN - Every path has its length as weight, and no edge leads to a
+    // shorter path
+    for (const auto& [vertex_id, path] : paths) {
+      int path_weight{0};
+      for (auto vertex{path.vertices.begin()};
+           std::next(vertex) != path.vertices.end(); ++vertex) {
+        path_weight += graph.get_edge(*vertex, *std::next(vertex));
+      }
+      ASSERT_EQ(path_weight, path.total_weight);
+
+      for (const auto neighbor : graph.get_neighbors(vertex_id)) {
+        ASSERT_LE(paths.at(neighbor).total_weight,
+                  path.total_weight + graph.get_edge(vertex_id, neighbor));
+      }
+    }
+  }
+}
+
+}  // namespace graaf::algorithm::detail
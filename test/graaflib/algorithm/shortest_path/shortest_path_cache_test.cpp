@@ -0,0 +1,105 @@
+#include <graaflib/algorithm/shortest_path/shortest_path_cache.h>
+#include <gtest/gtest.h>
+
+namespace graaf::algorithm {
+
+namespace {
+
+directed_graph<int, int> make_line_graph(std::size_t vertex_count) {
+  directed_graph<int, int> graph{};
+  for (std::size_t vertex{0}; vertex < vertex_count; ++vertex) {
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(0)};
+  }
+  for (vertex_id_t vertex_id{0}; vertex_id + 1 < vertex_count; ++vertex_id) {
+    graph.add_edge(vertex_id, vertex_id + 1, 2);
+  }
+  return graph;
+}
+
+}  // namespace
+
+TEST(ShortestPathCacheTest, RepeatedQueriesHitTheCache) {
+  // GIVEN
+  const auto graph{make_line_graph(4)};
+  shortest_path_cache cache{graph};
+  const auto heuristic{[](vertex_id_t) { return 0; }};
+
+  // WHEN
+  const auto dijkstra_path{cache.dijkstra_shortest_path(0, 3)};
+  const auto cached_dijkstra_path{cache.dijkstra_shortest_path(0, 3)};
+  const auto bfs_path{cache.bfs_shortest_path(0, 3)};
+  const auto a_star_path{cache.a_star_search(0, 3, heuristic)};
+  const auto cached_a_star_path{cache.a_star_search(0, 3, heuristic)};
+
+  // THEN - The algorithms are cached separately
+  const graph_path<int> expected_path{{0, 1, 2, 3}, 6};
+  ASSERT_EQ(dijkstra_path, expected_path);
+  ASSERT_EQ(cached_dijkstra_path, expected_path);
+  ASSERT_EQ(bfs_path, (graph_path<int>{{0, 1, 2, 3}, 3}));
+  ASSERT_EQ(a_star_path, expected_path);
+  ASSERT_EQ(cached_a_star_path, expected_path);
+  ASSERT_EQ(cache.size(), 3);
+  ASSERT_EQ(cache.hit_count(), 2);
+  ASSERT_EQ(cache.miss_count(), 3);
+}
+
+TEST(ShortestPathCacheTest, MutationInvalidatesTheCache) {
+  // GIVEN
+  auto graph{make_line_graph(4)};
+  shortest_path_cache cache{graph};
+  ASSERT_EQ(cache.dijkstra_shortest_path(0, 3),
+            (graph_path<int>{{0, 1, 2, 3}, 6}));
+  ASSERT_EQ(cache.dijkstra_shortest_path(3, 0), std::nullopt);
+
+  // WHEN
+  graph.add_edge(0, 3, 1);
+  graph.add_edge(3, 0, 1);
+
+  // THEN
+  ASSERT_EQ(cache.dijkstra_shortest_path(0, 3), (graph_path<int>{{0, 3}, 1}));
+  ASSERT_EQ(cache.dijkstra_shortest_path(3, 0), (graph_path<int>{{3, 0}, 1}));
+  ASSERT_EQ(cache.hit_count(), 0);
+  ASSERT_EQ(cache.miss_count(), 4);
+}
+
+TEST(ShortestPathCacheTest, AssignmentInvalidatesTheCache) {
+  // GIVEN - Two graphs with the same version but different weights
+  auto graph{make_line_graph(2)};
+  auto other_graph{make_line_graph(1)};
+  [[maybe_unused]] const auto vertex_id{other_graph.add_vertex(0)};
+  other_graph.add_edge(0, 1, 99);
+  ASSERT_EQ(graph.version(), other_graph.version());
+
+  shortest_path_cache cache{graph};
+  ASSERT_EQ(cache.dijkstra_shortest_path(0, 1), (graph_path<int>{{0, 1}, 2}));
+
+  // WHEN
+  graph = other_graph;
+
+  // THEN
+  ASSERT_EQ(cache.dijkstra_shortest_path(0, 1), (graph_path<int>{{0, 1}, 99}));
+}
+
+TEST(ShortestPathCacheTest, LeastRecentlyUsedPathsAreEvicted) {
+  // GIVEN - A budget for about two paths
+  const auto graph{make_line_graph(8)};
+  shortest_path_cache probe{graph};
+  [[maybe_unused]] const auto probe_path{probe.dijkstra_shortest_path(0, 7)};
+  shortest_path_cache cache{graph, {.max_bytes = 2 * probe.memory_usage()}};
+
+  // WHEN
+  [[maybe_unused]] const auto path_1{cache.dijkstra_shortest_path(0, 7)};
+  [[maybe_unused]] const auto path_2{cache.dijkstra_shortest_path(1, 7)};
+  [[maybe_unused]] const auto path_3{cache.dijkstra_shortest_path(0, 7)};
+  [[maybe_unused]] const auto path_4{cache.dijkstra_shortest_path(0, 6)};
+
+  // THEN - The path from vertex 1 was used least recently
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_LE(cache.memory_usage(), 2 * probe.memory_usage());
+  [[maybe_unused]] const auto path_5{cache.dijkstra_shortest_path(0, 7)};
+  ASSERT_EQ(cache.hit_count(), 2);
+  [[maybe_unused]] const auto path_6{cache.dijkstra_shortest_path(1, 7)};
+  ASSERT_EQ(cache.miss_count(), 4);
+}
+
+}  // namespace graaf::algorithm
@@ -1,7 +1,9 @@
 #include <graaflib/algorithm/strongly_connected_components/tarjan.h>
+#include <graaflib/generators/erdos_renyi.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
+#include <algorithm>
 #include <vector>
 
 namespace graaf::algorithm {
@@ -299,4 +301,28 @@ TYPED_TEST(TarjansStronglyConnectedComponentsTest, TarjansComplexGraphTest) {
   ASSERT_TRUE(are_set_vectors_equal(sccs, expected_sccs));
 }
 
+TEST(StronglyConnectedComponentsParallelTest,
+     ParallelComponentsMatchTarjans) {
+  // GIVEN - A sparse graph, with a large component and many small ones
+  auto graph{generators::erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      3'000, 0.0008, {.seed = 13})};
+  graph.add_edge(5, 5, 1);
+
+  const auto normalize{[](std::vector<std::vector<vertex_id_t>> sccs) {
+    for (auto& scc : sccs) {
+      std::ranges::sort(scc);
+    }
+    std::ranges::sort(sccs);
+    return sccs;
+  }};
+
+  // WHEN
+  const auto sequential_sccs{tarjans_strongly_connected_components(graph)};
+  const auto parallel_sccs{
+      tarjans_strongly_connected_components(execution::par, graph)};
+
+  // THEN
+  ASSERT_EQ(normalize(parallel_sccs), normalize(sequential_sccs));
+}
+
 }  // namespace graaf::algorithm
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include <graaflib/algorithm/topological_sorting/dfs_topological_sorting.h>
+#include <graaflib/generators/random_dag.h>
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
+#include <unordered_map>
+
 namespace graaf::algorithm {
 namespace {
 template <typename T>
@@ -229,4 +232,38 @@ TYPED_TEST(TypedTopologicalSort, SixSortResults) {
               (expected_vertices_6 == sorted_vertices));
 }
 
+TEST(ParallelTopologicalSort, ParallelOrderIsTopological) {
+  // GIVEN
+  const auto graph{generators::random_dag<int, int>(2'000, 0.005)};
+
+  // WHEN
+  const auto sorted_vertices{dfs_topological_sort(execution::par, graph)};
+
+  // THEN
+  ASSERT_TRUE(sorted_vertices.has_value());
+  ASSERT_EQ(sorted_vertices->size(), graph.vertex_count());
+  std::unordered_map<vertex_id_t, std::size_t> positions{};
+  for (std::size_t position{0}; position < sorted_vertices->size();
+       ++position) {
+    positions[(*sorted_vertices)[position]] = position;
+  }
+  for (const auto& [edge_id, _] : graph.get_edges()) {
+    ASSERT_LT(positions.at(edge_id.first), positions.at(edge_id.second));
+  }
+}
+
+TEST(ParallelTopologicalSort, ParallelCycle) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  const auto vertex_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_1, vertex_2, 1);
+  graph.add_edge(vertex_2, vertex_3, 1);
+  graph.add_edge(vertex_3, vertex_2, 1);
+
+  // WHEN - THEN
+  ASSERT_FALSE(dfs_topological_sort(execution::par, graph).has_value());
+}
+
 };  // namespace graaf::algorithm
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <graaflib/concurrent_graph.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace graaf {
+
+namespace {
+
+using graph_t = directed_graph<int, int>;
+
+}  // namespace
+
+TEST(ConcurrentGraphTest, SnapshotKeepsVersionAtTimeOfPinning) {
+  // GIVEN
+  concurrent_graph<graph_t> graph{};
+  const auto vertex_id_1{
+      graph.update([](graph_t& next) { return next.add_vertex(10); })};
+  const auto old_snapshot{graph.snapshot()};
+
+  // WHEN
+  graph.update([vertex_id_1](graph_t& next) {
+    const auto vertex_id_2{next.add_vertex(20)};
+    next.add_edge(vertex_id_1, vertex_id_2, 100);
+  });
+  const auto new_snapshot{graph.snapshot()};
+
+  // THEN
+  ASSERT_EQ(old_snapshot->vertex_count(), 1);
+  ASSERT_EQ(old_snapshot->edge_count(), 0);
+  ASSERT_EQ(new_snapshot->vertex_count(), 2);
+  ASSERT_EQ(new_snapshot->edge_count(), 1);
+}
+
+TEST(ConcurrentGraphTest, RetiredVersionIsReclaimedOnceReleased) {
+  // GIVEN
+  concurrent_graph<graph_t> graph{};
+  auto snapshot{graph.snapshot()};
+
+  // WHEN - The first version is still pinned
+  graph.update([](graph_t& next) { (void)next.add_vertex(10); });
+  graph.update([](graph_t& next) { (void)next.add_vertex(20); });
+
+  // THEN - Versions retired while the snapshot is held are kept
+  ASSERT_EQ(graph.retired_count(), 2);
+
+  // WHEN
+  auto moved_snapshot{std::move(snapshot)};
+  ASSERT_EQ(moved_snapshot->vertex_count(), 0);
+  { [[maybe_unused]] const auto released{std::move(moved_snapshot)}; }
+  graph.collect();
+
+  // THEN
+  ASSERT_EQ(graph.retired_count(), 0);
+}
+
+TEST(ConcurrentGraphTest, FailedUpdateIsNotPublished) {
+  // GIVEN
+  concurrent_graph<graph_t> graph{};
+
+  // WHEN
+  ASSERT_THROW(graph.update([](graph_t& next) {
+    (void)next.add_vertex(10);
+    throw std::runtime_error{"failure"};
+  }),
+               std::runtime_error);
+
+  // THEN
+  ASSERT_EQ(graph.snapshot()->vertex_count(), 0);
+}
+
+TEST(ConcurrentGraphTest, ReadersSeeConsistentVersionsDuringUpdates) {
+  // GIVEN - A path graph which grows by one vertex and edge per update
+  concurrent_graph<graph_t> graph{graph_t{}, {.max_snapshots = 4}};
+  graph.update([](graph_t& next) { (void)next.add_vertex(0); });
+
+  std::atomic<bool> done{false};
+  std::atomic<bool> consistent{true};
+  std::vector<std::thread> readers{};
+
+  // WHEN - There are more readers than snapshot slots
+  for (int reader{0}; reader < 8; ++reader) {
+    readers.emplace_back([&graph, &done, &consistent]() {
+      while (!done) {
+        const auto snapshot{graph.snapshot()};
+        if (snapshot->edge_count() + 1 != snapshot->vertex_count()) {
+          consistent = false;
+        }
+      }
+    });
+  }
+  for (vertex_id_t vertex_id{1}; vertex_id < 200; ++vertex_id) {
+    graph.update([vertex_id](graph_t& next) {
+      (void)next.add_vertex(static_cast<int>(vertex_id));
+      next.add_edge(vertex_id - 1, vertex_id, 1);
+    });
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  graph.collect();
+
+  // THEN
+  ASSERT_TRUE(consistent);
+  ASSERT_EQ(graph.snapshot()->vertex_count(), 200);
+  ASSERT_EQ(graph.retired_count(), 0);
+}
+
+}  // namespace graaf
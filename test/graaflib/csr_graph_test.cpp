@@ -0,0 +1,68 @@
+#include <graaflib/csr_graph.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace graaf {
+
+TEST(CsrGraphTest, DirectedGraphNeighborsAreSorted) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_id_1, vertex_id_3, 200);
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+  graph.add_edge(vertex_id_3, vertex_id_1, 300);
+
+  // WHEN
+  const auto csr{make_csr_graph(graph)};
+
+  // THEN
+  ASSERT_EQ(csr.vertex_count(), 3);
+  ASSERT_EQ(csr.edge_count(), 3);
+  const auto index_1{csr.index(vertex_id_1)};
+  const auto index_2{csr.index(vertex_id_2)};
+  const auto index_3{csr.index(vertex_id_3)};
+  ASSERT_EQ(csr.vertex_id(index_2), vertex_id_2);
+  ASSERT_EQ(csr.get_vertex(index_3), 30);
+
+  const std::vector<std::size_t> neighbors(csr.neighbors(index_1).begin(),
+                                           csr.neighbors(index_1).end());
+  const std::vector<int> edges(csr.edges(index_1).begin(),
+                               csr.edges(index_1).end());
+  ASSERT_EQ(neighbors, (std::vector<std::size_t>{index_2, index_3}));
+  ASSERT_EQ(edges, (std::vector<int>{100, 200}));
+  ASSERT_EQ(csr.degree(index_2), 0);
+
+  ASSERT_TRUE(csr.has_edge(index_3, index_1));
+  ASSERT_FALSE(csr.has_edge(index_1, index_1));
+  ASSERT_FALSE(csr.has_edge(index_2, index_1));
+  ASSERT_THROW((void)csr.index(42), std::out_of_range);
+}
+
+TEST(CsrGraphTest, UndirectedGraphIsSymmetric) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+  graph.add_edge(vertex_id_2, vertex_id_2, 200);
+
+  // WHEN
+  const auto csr{make_csr_graph(graph)};
+
+  // THEN - A self loop is a single adjacency
+  const auto index_1{csr.index(vertex_id_1)};
+  const auto index_2{csr.index(vertex_id_2)};
+  ASSERT_EQ(csr.edge_count(), 2);
+  ASSERT_TRUE(csr.has_edge(index_1, index_2));
+  ASSERT_TRUE(csr.has_edge(index_2, index_1));
+  ASSERT_EQ(csr.degree(index_1), 1);
+  ASSERT_EQ(csr.degree(index_2), 2);
+  ASSERT_EQ(csr.edges(index_1).front(), 100);
+}
+
+}  // namespace graaf
@@ -0,0 +1,215 @@
+#include <graaflib/executor.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace graaf {
+
+namespace {
+
+// Runs tasks on a thread pool and counts them, like an executor an
+// application would plug in
+class counting_executor final : public executor {
+ public:
+  void execute(std::function<void()> task) override {
+    ++task_count_;
+    pool_.execute(std::move(task));
+  }
+
+  [[nodiscard]] std::size_t concurrency() const noexcept override {
+    return pool_.concurrency();
+  }
+
+  [[nodiscard]] std::size_t task_count() const noexcept { return task_count_; }
+
+ private:
+  std::atomic<std::size_t> task_count_{0};
+  thread_pool_executor pool_{{.thread_count = 4}};
+};
+
+}  // namespace
+
+TEST(ExecutorTest, ThreadPoolRunsAllTasksBeforeDestruction) {
+  // GIVEN
+  std::atomic<int> counter{0};
+
+  // WHEN
+  {
+    thread_pool_executor pool{{.thread_count = 4}};
+    for (int task{0}; task < 1000; ++task) {
+      pool.execute([&counter]() { ++counter; });
+    }
+  }
+
+  // THEN
+  ASSERT_EQ(counter, 1000);
+}
+
+TEST(ExecutorTest, ThreadPoolRunsTasksSubmittedByTasks) {
+  // GIVEN
+  std::atomic<int> counter{0};
+
+  // WHEN
+  {
+    thread_pool_executor pool{{.thread_count = 2, .pin_threads = true}};
+    for (int task{0}; task < 100; ++task) {
+      pool.execute([&pool, &counter]() {
+        ++counter;
+        pool.execute([&counter]() { ++counter; });
+      });
+    }
+  }
+
+  // THEN
+  ASSERT_EQ(counter, 200);
+}
+
+TEST(ExecutorTest, ParallelForCoversRangeExactlyOnce) {
+  // GIVEN
+  thread_pool_executor pool{{.thread_count = 4}};
+  std::vector<std::atomic<int>> visits(10'000);
+
+  // WHEN
+  parallel_for(pool, 0, visits.size(),
+               [&visits](std::size_t begin, std::size_t end) {
+                 for (auto index{begin}; index < end; ++index) {
+                   ++visits[index];
+                 }
+               });
+
+  // THEN
+  for (const auto& visit_count : visits) {
+    ASSERT_EQ(visit_count, 1);
+  }
+}
+
+TEST(ExecutorTest, ParallelForRespectsGrainSize) {
+  // GIVEN
+  thread_pool_executor pool{{.thread_count = 4}};
+  std::mutex mutex{};
+  std::vector<std::pair<std::size_t, std::size_t>> subranges{};
+
+  // WHEN
+  parallel_for(
+      pool, 5, 1'000,
+      [&](std::size_t begin, std::size_t end) {
+        const std::lock_guard lock{mutex};
+        subranges.emplace_back(begin, end);
+      },
+      {.grain_size = 64});
+
+  // THEN - Only the last subrange may be smaller than the grain size
+  std::ranges::sort(subranges);
+  ASSERT_EQ(subranges.front().first, 5);
+  ASSERT_EQ(subranges.back().second, 1'000);
+  for (std::size_t index{0}; index + 1 < subranges.size(); ++index) {
+    ASSERT_EQ(subranges[index].second, subranges[index + 1].first);
+    ASSERT_GE(subranges[index].second - subranges[index].first, 64);
+  }
+}
+
+TEST(ExecutorTest, ParallelForWithoutConcurrencyRunsOnCallingThread) {
+  // GIVEN
+  thread_pool_executor pool{{.thread_count = 4}};
+  std::vector<std::thread::id> thread_ids{};
+
+  // WHEN
+  parallel_for(
+      pool, 0, 100,
+      [&thread_ids](std::size_t /*begin*/, std::size_t /*end*/) {
+        thread_ids.push_back(std::this_thread::get_id());
+      },
+      {.max_concurrency = 1});
+
+  // THEN
+  ASSERT_EQ(thread_ids.size(), 1);
+  ASSERT_EQ(thread_ids.front(), std::this_thread::get_id());
+}
+
+TEST(ExecutorTest, ParallelForRethrowsException) {
+  // GIVEN
+  thread_pool_executor pool{{.thread_count = 4}};
+
+  // WHEN - THEN
+  ASSERT_THROW(parallel_for(pool, 0, 1'000,
+                            [](std::size_t begin, std::size_t end) {
+                              if (begin <= 500 && 500 < end) {
+                                throw std::runtime_error{"failure"};
+                              }
+                            }),
+               std::runtime_error);
+}
+
+TEST(ExecutorTest, NestedParallelForOnPool) {
+  // GIVEN
+  thread_pool_executor pool{{.thread_count = 2}};
+  std::atomic<std::size_t> sum{0};
+
+  // WHEN - Every worker blocks in an inner parallel_for
+  parallel_for(
+      pool, 0, 8,
+      [&](std::size_t outer_begin, std::size_t outer_end) {
+        for (auto outer{outer_begin}; outer < outer_end; ++outer) {
+          parallel_for(pool, 0, 100, [&sum](std::size_t begin,
+                                            std::size_t end) {
+            for (auto index{begin}; index < end; ++index) {
+              sum += index;
+            }
+          });
+        }
+      },
+      {.grain_size = 1});
+
+  // THEN
+  ASSERT_EQ(sum, 8 * 4'950);
+}
+
+TEST(ExecutorTest, ParallelForEachVisitsAllElements) {
+  // GIVEN
+  thread_pool_executor pool{{.thread_count = 4}};
+  std::vector<int> elements(1'000);
+  std::iota(elements.begin(), elements.end(), 0);
+  std::atomic<long> sum{0};
+
+  // WHEN
+  parallel_for_each(pool, elements, [&sum](int element) { sum += element; });
+
+  // THEN
+  ASSERT_EQ(sum, 499'500);
+}
+
+TEST(ExecutorTest, CallerProvidedDefaultExecutor) {
+  // GIVEN
+  counting_executor executor{};
+  set_default_executor(&executor);
+
+  // WHEN
+  parallel_for(default_executor(), 0, 1'000,
+               [](std::size_t /*begin*/, std::size_t /*end*/) {});
+  set_default_executor(nullptr);
+
+  // THEN
+  ASSERT_GT(executor.task_count(), 0);
+  ASSERT_NE(&default_executor(), &executor);
+}
+
+TEST(ExecutorTest, SelectExecutorAvoidsThreadsForSingleThread) {
+  // GIVEN
+  counting_executor executor{};
+
+  // WHEN - THEN
+  ASSERT_EQ(&detail::select_executor(&executor, 1), &executor);
+  ASSERT_EQ(detail::select_executor(nullptr, 1).concurrency(), 1);
+  ASSERT_EQ(&detail::select_executor(nullptr, 4), &default_executor());
+}
+
+}  // namespace graaf
@@ -0,0 +1,44 @@
+#include <graaflib/generators/barabasi_albert.h>
+#include <graaflib/graph.h>
+#include <graaflib/properties/vertex_properties.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace graaf::generators {
+
+TEST(BarabasiAlbertTest, EdgeCount) {
+  // WHEN
+  const auto graph{barabasi_albert<int, int, graph_type::UNDIRECTED>(
+      1000, 3, {.seed = 6})};
+
+  // THEN - Every vertex after the initial ones adds three distinct edges
+  ASSERT_EQ(graph.vertex_count(), 1000);
+  ASSERT_EQ(graph.edge_count(), (1000 - 3) * 3);
+}
+
+TEST(BarabasiAlbertTest, PreferentialAttachment) {
+  // WHEN
+  const auto graph{barabasi_albert<int, int, graph_type::DIRECTED>(
+      2000, 2, {.seed = 8})};
+
+  // THEN - Every new vertex points to two older vertices, early vertices
+  // attract far more edges than the average in-degree of two
+  std::size_t max_indegree{0};
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    if (vertex_id >= 2) {
+      ASSERT_EQ(properties::vertex_outdegree(graph, vertex_id), 2);
+    }
+    max_indegree =
+        std::max(max_indegree, properties::vertex_indegree(graph, vertex_id));
+  }
+  ASSERT_GT(max_indegree, 20);
+}
+
+TEST(BarabasiAlbertTest, InvalidEdgesPerVertex) {
+  ASSERT_THROW(
+      (void)(barabasi_albert<int, int, graph_type::UNDIRECTED>(3, 3)),
+      std::invalid_argument);
+}
+
+}  // namespace graaf::generators
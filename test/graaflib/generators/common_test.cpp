@@ -0,0 +1,111 @@
+#include <graaflib/edge.h>
+#include <graaflib/generators/common.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace graaf::generators {
+
+namespace {
+
+class weighted_test_edge : public weighted_edge<double> {
+ public:
+  explicit weighted_test_edge(double weight) : weight_{weight} {}
+
+  [[nodiscard]] double get_weight() const noexcept override { return weight_; }
+
+ private:
+  double weight_{};
+};
+
+}  // namespace
+
+TEST(GeneratorsCommonTest, Splitmix64IsReproducible) {
+  // GIVEN
+  splitmix64 rng_1{42};
+  splitmix64 rng_2{42};
+  splitmix64 rng_3{43};
+
+  // WHEN
+  const auto value_1{rng_1()};
+  const auto value_2{rng_2()};
+  const auto value_3{rng_3()};
+
+  // THEN
+  static_assert(std::uniform_random_bit_generator<splitmix64>);
+  ASSERT_EQ(value_1, value_2);
+  ASSERT_NE(value_1, value_3);
+}
+
+TEST(GeneratorsCommonTest, UniformIndexIsInRange) {
+  // GIVEN
+  splitmix64 rng{1};
+  std::vector<int> counts(10, 0);
+
+  // WHEN
+  for (int draw{0}; draw < 10000; ++draw) {
+    const auto index{detail::uniform_index(rng, counts.size())};
+    ASSERT_LT(index, counts.size());
+    ++counts[index];
+  }
+
+  // THEN - Every index is drawn roughly equally often
+  for (const auto count : counts) {
+    ASSERT_GT(count, 800);
+    ASSERT_LT(count, 1200);
+  }
+}
+
+TEST(GeneratorsCommonTest, MakeEdgeRespectsWeightRange) {
+  // GIVEN
+  splitmix64 rng{1};
+  const generator_options options{.min_weight = 2, .max_weight = 5};
+
+  for (int draw{0}; draw < 1000; ++draw) {
+    // WHEN
+    const auto integral_edge{detail::make_edge<int>(rng, options)};
+    const auto floating_edge{detail::make_edge<double>(rng, options)};
+    const auto weighted{detail::make_edge<weighted_test_edge>(rng, options)};
+
+    // THEN
+    ASSERT_GE(integral_edge, 2);
+    ASSERT_LE(integral_edge, 5);
+    ASSERT_GE(floating_edge, 2.0);
+    ASSERT_LT(floating_edge, 5.0);
+    ASSERT_GE(weighted.get_weight(), 2.0);
+    ASSERT_LT(weighted.get_weight(), 5.0);
+  }
+}
+
+TEST(GeneratorsCommonTest, ChunksDoNotDependOnThreadCount) {
+  // GIVEN
+  using edges_t = std::vector<detail::generated_edge<int>>;
+  const auto generate_chunk{[](std::size_t chunk, splitmix64& rng,
+                               edges_t& edges) {
+    for (std::size_t edge{0}; edge < 10; ++edge) {
+      edges.push_back({chunk, detail::uniform_index(rng, 100),
+                       static_cast<int>(rng() % 1000)});
+    }
+  }};
+
+  // WHEN
+  const auto sequential{detail::generate_in_chunks<int>(
+      50, {.seed = 7, .thread_count = 1}, generate_chunk)};
+  const auto parallel{detail::generate_in_chunks<int>(
+      50, {.seed = 7, .thread_count = 4}, generate_chunk)};
+
+  // THEN
+  ASSERT_EQ(sequential.size(), 500);
+  ASSERT_EQ(parallel.size(), sequential.size());
+  for (std::size_t index{0}; index < sequential.size(); ++index) {
+    ASSERT_EQ(parallel[index].vertex_index_lhs,
+              sequential[index].vertex_index_lhs);
+    ASSERT_EQ(parallel[index].vertex_index_rhs,
+              sequential[index].vertex_index_rhs);
+    ASSERT_EQ(parallel[index].edge, sequential[index].edge);
+  }
+}
+
+}  // namespace graaf::generators
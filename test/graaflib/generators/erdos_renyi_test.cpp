@@ -0,0 +1,79 @@
+#include <graaflib/generators/erdos_renyi.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace graaf::generators {
+
+TEST(ErdosRenyiTest, GnpExtremeProbabilities) {
+  // WHEN
+  const auto empty{erdos_renyi_gnp<int, int, graph_type::DIRECTED>(50, 0.0)};
+  const auto complete_directed{
+      erdos_renyi_gnp<int, int, graph_type::DIRECTED>(50, 1.0)};
+  const auto complete_undirected{
+      erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(50, 1.0)};
+
+  // THEN
+  ASSERT_EQ(empty.vertex_count(), 50);
+  ASSERT_EQ(empty.edge_count(), 0);
+  ASSERT_EQ(complete_directed.edge_count(), 50 * 49);
+  ASSERT_EQ(complete_undirected.edge_count(), 50 * 49 / 2);
+}
+
+TEST(ErdosRenyiTest, GnpExpectedEdgeCount) {
+  // WHEN
+  const auto graph{erdos_renyi_gnp<int, int, graph_type::DIRECTED>(
+      2000, 0.01, {.seed = 3})};
+
+  // THEN - The expected number of edges is 2000 * 1999 * 0.01 ~ 39980
+  ASSERT_EQ(graph.vertex_count(), 2000);
+  ASSERT_GT(graph.edge_count(), 38000);
+  ASSERT_LT(graph.edge_count(), 42000);
+  for (const auto& [edge_id, _] : graph.get_edges()) {
+    ASSERT_NE(edge_id.first, edge_id.second);
+  }
+}
+
+TEST(ErdosRenyiTest, GnpIsReproducible) {
+  // WHEN
+  const auto graph_1{erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+      3000, 0.005, {.seed = 11, .thread_count = 1})};
+  const auto graph_2{erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+      3000, 0.005, {.seed = 11, .thread_count = 8})};
+
+  // THEN - The thread count does not affect the generated graph
+  ASSERT_EQ(graph_1.edge_count(), graph_2.edge_count());
+  for (const auto& [edge_id, _] : graph_1.get_edges()) {
+    ASSERT_TRUE(graph_2.has_edge(edge_id.first, edge_id.second));
+  }
+}
+
+TEST(ErdosRenyiTest, GnpInvalidProbability) {
+  ASSERT_THROW(
+      (void)(erdos_renyi_gnp<int, int, graph_type::DIRECTED>(10, 1.5)),
+      std::invalid_argument);
+}
+
+TEST(ErdosRenyiTest, GnmEdgeCount) {
+  // WHEN
+  const auto graph{erdos_renyi_gnm<int, int, graph_type::UNDIRECTED>(
+      100, 500, {.seed = 5, .min_weight = 1, .max_weight = 10})};
+
+  // THEN
+  ASSERT_EQ(graph.vertex_count(), 100);
+  ASSERT_EQ(graph.edge_count(), 500);
+  for (const auto& [edge_id, edge] : graph.get_edges()) {
+    ASSERT_NE(edge_id.first, edge_id.second);
+    ASSERT_GE(edge, 1);
+    ASSERT_LE(edge, 10);
+  }
+}
+
+TEST(ErdosRenyiTest, GnmTooManyEdges) {
+  ASSERT_THROW(
+      (void)(erdos_renyi_gnm<int, int, graph_type::UNDIRECTED>(4, 7)),
+      std::invalid_argument);
+}
+
+}  // namespace graaf::generators
@@ -0,0 +1,38 @@
+#include <graaflib/generators/grid.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+namespace graaf::generators {
+
+TEST(GridTest, UndirectedGrid) {
+  // WHEN
+  const auto graph{grid<int, int, graph_type::UNDIRECTED>(
+      3, 4, {.min_weight = 1, .max_weight = 100})};
+
+  // THEN
+  ASSERT_EQ(graph.vertex_count(), 12);
+  ASSERT_EQ(graph.edge_count(), 3 * 3 + 2 * 4);
+  ASSERT_TRUE(graph.has_edge(0, 1));
+  ASSERT_TRUE(graph.has_edge(0, 4));
+  ASSERT_FALSE(graph.has_edge(3, 4));
+  ASSERT_TRUE(graph.has_edge(10, 11));
+  for (const auto& [_, edge] : graph.get_edges()) {
+    ASSERT_GE(edge, 1);
+    ASSERT_LE(edge, 100);
+  }
+}
+
+TEST(GridTest, DirectedGridConnectsBothDirections) {
+  // WHEN
+  const auto graph{grid<int, double, graph_type::DIRECTED>(
+      100, 100, {.seed = 4, .min_weight = 0, .max_weight = 1})};
+
+  // THEN
+  ASSERT_EQ(graph.vertex_count(), 100 * 100);
+  ASSERT_EQ(graph.edge_count(), 2 * 2 * 100 * 99);
+  ASSERT_TRUE(graph.has_edge(5, 105));
+  ASSERT_TRUE(graph.has_edge(105, 5));
+  ASSERT_NE(graph.get_edge(5, 105), graph.get_edge(105, 5));
+}
+
+}  // namespace graaf::generators
@@ -0,0 +1,21 @@
+#include <graaflib/algorithm/cycle_detection/dfs_cycle_detection.h>
+#include <graaflib/generators/random_dag.h>
+#include <graaflib/graph.h>
+#include <gtest/gtest.h>
+
+namespace graaf::generators {
+
+TEST(RandomDagTest, EdgesFollowVertexIds) {
+  // WHEN
+  const auto graph{random_dag<int, int>(500, 0.05, {.seed = 9})};
+
+  // THEN
+  ASSERT_EQ(graph.vertex_count(), 500);
+  ASSERT_GT(graph.edge_count(), 0);
+  for (const auto& [edge_id, _] : graph.get_edges()) {
+    ASSERT_LT(edge_id.first, edge_id.second);
+  }
+  ASSERT_FALSE(algorithm::dfs_cycle_detection(graph));
+}
+
+}  // namespace graaf::generators
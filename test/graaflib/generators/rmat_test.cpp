@@ -0,0 +1,57 @@
+#include <graaflib/generators/rmat.h>
+#include <graaflib/graph.h>
+#include <graaflib/properties/vertex_properties.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace graaf::generators {
+
+TEST(RmatTest, VertexAndEdgeCount) {
+  // WHEN
+  const auto graph{
+      rmat<int, int, graph_type::DIRECTED>(10, 8, {}, {.seed = 1})};
+
+  // THEN - Duplicate samples collapse into a single edge
+  ASSERT_EQ(graph.vertex_count(), 1024);
+  ASSERT_GT(graph.edge_count(), 0);
+  ASSERT_LE(graph.edge_count(), 8 * 1024);
+}
+
+TEST(RmatTest, SkewedDegreeDistribution) {
+  // WHEN
+  const auto graph{
+      rmat<int, int, graph_type::DIRECTED>(12, 16, {}, {.seed = 2})};
+
+  // THEN - Vertex 0 lies in the densest quadrant at every level
+  std::size_t max_outdegree{0};
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    max_outdegree =
+        std::max(max_outdegree, properties::vertex_outdegree(graph, vertex_id));
+  }
+  ASSERT_EQ(properties::vertex_outdegree(graph, 0), max_outdegree);
+  ASSERT_GT(max_outdegree, 16 * 10);
+}
+
+TEST(RmatTest, IsReproducible) {
+  // WHEN
+  const auto graph_1{rmat<int, int, graph_type::UNDIRECTED>(
+      14, 4, {}, {.seed = 3, .thread_count = 1})};
+  const auto graph_2{rmat<int, int, graph_type::UNDIRECTED>(
+      14, 4, {}, {.seed = 3, .thread_count = 4})};
+
+  // THEN
+  ASSERT_EQ(graph_1.edge_count(), graph_2.edge_count());
+  for (const auto& [edge_id, _] : graph_1.get_edges()) {
+    ASSERT_TRUE(graph_2.has_edge(edge_id.first, edge_id.second));
+  }
+}
+
+TEST(RmatTest, InvalidParameters) {
+  ASSERT_THROW(
+      (void)(rmat<int, int, graph_type::DIRECTED>(4, 1, {0.5, 0.4, 0.3})),
+      std::invalid_argument);
+}
+
+}  // namespace graaf::generators
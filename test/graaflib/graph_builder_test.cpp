@@ -0,0 +1,94 @@
+#include <graaflib/graph.h>
+#include <graaflib/graph_builder.h>
+#include <gtest/gtest.h>
+#include <utils/fixtures/fixtures.h>
+
+#include <stdexcept>
+
+namespace graaf {
+
+template <typename T>
+struct GraphBuilderTest : public testing::Test {
+  using graph_t = T;
+};
+
+TYPED_TEST_SUITE(GraphBuilderTest, utils::fixtures::minimal_graph_types);
+
+TYPED_TEST(GraphBuilderTest, BuildEmptyGraph) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_builder<graph_t> builder{};
+
+  // WHEN
+  const auto graph{std::move(builder).build()};
+
+  // THEN
+  ASSERT_EQ(graph.vertex_count(), 0);
+  ASSERT_EQ(graph.edge_count(), 0);
+}
+
+TYPED_TEST(GraphBuilderTest, BuildGraph) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_builder<graph_t> builder{};
+  builder.reserve(3, 2);
+
+  const auto vertex_index_1{builder.add_vertex(10)};
+  const auto vertex_index_2{builder.add_vertex(20)};
+  const auto vertex_index_3{builder.add_vertex(30)};
+  builder.add_edge(vertex_index_1, vertex_index_2, 100);
+  builder.add_edge(vertex_index_2, vertex_index_3, 200);
+  ASSERT_EQ(builder.vertex_count(), 3);
+  ASSERT_EQ(builder.edge_count(), 2);
+
+  // WHEN
+  const auto graph{std::move(builder).build()};
+
+  // THEN - Vertex ids equal the builder indices
+  ASSERT_EQ(graph.vertex_count(), 3);
+  ASSERT_EQ(graph.edge_count(), 2);
+  ASSERT_EQ(graph.get_vertex(vertex_index_1), 10);
+  ASSERT_EQ(graph.get_vertex(vertex_index_2), 20);
+  ASSERT_EQ(graph.get_vertex(vertex_index_3), 30);
+  ASSERT_EQ(graph.get_edge(vertex_index_1, vertex_index_2), 100);
+  ASSERT_EQ(graph.get_edge(vertex_index_2, vertex_index_3), 200);
+}
+
+TYPED_TEST(GraphBuilderTest, BuildIntoExistingGraph) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+  const auto existing_vertex_id{graph.add_vertex(1)};
+
+  graph_builder<graph_t> builder{};
+  const auto vertex_index_1{builder.add_vertex(10)};
+  const auto vertex_index_2{builder.add_vertex(20)};
+  builder.add_edge(vertex_index_1, vertex_index_2, 100);
+
+  // WHEN
+  const auto vertex_ids{std::move(builder).build_into(graph)};
+
+  // THEN
+  ASSERT_EQ(vertex_ids.size(), 2);
+  ASSERT_EQ(graph.vertex_count(), 3);
+  ASSERT_EQ(graph.edge_count(), 1);
+  ASSERT_TRUE(graph.has_vertex(existing_vertex_id));
+  ASSERT_EQ(graph.get_vertex(vertex_ids[vertex_index_1]), 10);
+  ASSERT_EQ(graph.get_vertex(vertex_ids[vertex_index_2]), 20);
+  ASSERT_EQ(graph.get_edge(vertex_ids[vertex_index_1],
+                           vertex_ids[vertex_index_2]),
+            100);
+}
+
+TYPED_TEST(GraphBuilderTest, AddEdgeNonExistingVertex) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_builder<graph_t> builder{};
+  const auto vertex_index{builder.add_vertex(10)};
+
+  // WHEN - THEN
+  ASSERT_THROW(builder.add_edge(vertex_index, vertex_index + 1, 100),
+               std::invalid_argument);
+}
+
+}  // namespace graaf
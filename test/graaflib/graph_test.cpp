@@ -3,6 +3,10 @@
 #include <gtest/gtest.h>
 #include <utils/fixtures/fixtures.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 /**
  * Tests which test the common functionality of the graph
  * class go here. Any test specific to a graph specification
@@ -18,6 +22,31 @@ struct GraphTest : public testing::Test {
 
 TYPED_TEST_SUITE(GraphTest, utils::fixtures::minimal_graph_types);
 
+namespace {
+
+struct recording_observer : public graph_observer {
+  void on_vertex_added(vertex_id_t vertex_id) override {
+    changes.push_back(fmt::format("+v{}", vertex_id));
+  }
+  void on_vertex_removed(vertex_id_t vertex_id) override {
+    changes.push_back(fmt::format("-v{}", vertex_id));
+  }
+  void on_edge_added(vertex_id_t vertex_id_lhs,
+                     vertex_id_t vertex_id_rhs) override {
+    changes.push_back(fmt::format("+e{}{}", vertex_id_lhs, vertex_id_rhs));
+  }
+  void on_edge_removed(vertex_id_t vertex_id_lhs,
+                       vertex_id_t vertex_id_rhs) override {
+    changes.push_back(fmt::format("-e{}{}", vertex_id_lhs, vertex_id_rhs));
+  }
+  void on_graph_replaced() noexcept override { ++replacement_count; }
+
+  std::vector<std::string> changes{};
+  std::size_t replacement_count{0};
+};
+
+}  // namespace
+
 TYPED_TEST(GraphTest, VertexCount) {
   // GIVEN
   using graph_t = typename TestFixture::graph_t;
@@ -172,6 +201,186 @@ TYPED_TEST(GraphTest, VertexTests) {
   EXPECT_EQ(graph.get_vertex(vertex_id_2), 20);
 }
 
+TYPED_TEST(GraphTest, AddVertexWithId) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+
+  // WHEN
+  const auto vertex_id_1{graph.add_vertex(10, 5)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+
+  // THEN - Subsequent vertices are given larger IDs
+  ASSERT_EQ(vertex_id_1, 5);
+  ASSERT_EQ(graph.get_vertex(vertex_id_1), 10);
+  ASSERT_GT(vertex_id_2, vertex_id_1);
+  ASSERT_EQ(graph.get_vertex(vertex_id_2), 20);
+
+  // An existing ID cannot be reused
+  ASSERT_THROW(graph.add_vertex(30, vertex_id_1), std::invalid_argument);
+}
+
+TYPED_TEST(GraphTest, Reserve) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+
+  // WHEN
+  graph.reserve(100, 200);
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+
+  // THEN - Reserving storage does not add vertices or edges
+  ASSERT_EQ(graph.vertex_count(), 2);
+  ASSERT_EQ(graph.edge_count(), 1);
+  ASSERT_GE(graph.get_vertices().bucket_count(), 100);
+  ASSERT_GE(graph.get_edges().bucket_count(), 200);
+}
+
+TYPED_TEST(GraphTest, VersionIncreasesOnMutation) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+  const auto initial_version{graph.version()};
+
+  // WHEN - THEN
+  const auto vertex_id_1{graph.add_vertex(1)};
+  const auto vertex_id_2{graph.add_vertex(2)};
+  ASSERT_EQ(graph.version(), initial_version + 2);
+
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+  ASSERT_EQ(graph.version(), initial_version + 3);
+
+  // Reading does not change the version
+  [[maybe_unused]] const auto neighbors{graph.get_neighbors(vertex_id_1)};
+  graph.reserve(10, 10);
+  ASSERT_EQ(graph.version(), initial_version + 3);
+
+  // Adding an existing edge changes nothing
+  graph.add_edge(vertex_id_1, vertex_id_2, 200);
+  ASSERT_EQ(graph.version(), initial_version + 3);
+
+  graph.remove_edge(vertex_id_1, vertex_id_2);
+  graph.remove_vertex(vertex_id_2);
+  ASSERT_EQ(graph.version(), initial_version + 5);
+}
+
+TYPED_TEST(GraphTest, VersionIsNewAfterAssignment) {
+  // GIVEN - Two graphs with the same version
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+  graph_t other_graph{};
+  [[maybe_unused]] const auto vertex_id_1{graph.add_vertex(1)};
+  [[maybe_unused]] const auto vertex_id_2{other_graph.add_vertex(2)};
+  ASSERT_EQ(graph.version(), other_graph.version());
+  const auto initial_version{graph.version()};
+
+  // WHEN - THEN
+  graph = other_graph;
+  const auto copied_version{graph.version()};
+  ASSERT_GT(copied_version, initial_version);
+  ASSERT_EQ(other_graph.version(), initial_version);
+
+  graph = std::move(other_graph);
+  ASSERT_GT(graph.version(), copied_version);
+  // The contents of the moved from graph are replaced as well
+  ASSERT_GT(other_graph.version(), initial_version);
+
+  // A new graph takes the version of the graph it is created from
+  const auto graph_copy{graph};
+  ASSERT_EQ(graph_copy.version(), graph.version());
+}
+
+TYPED_TEST(GraphTest, ObserverIsNotifiedOfChanges) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+  recording_observer observer{};
+  graph.set_observer(&observer);
+
+  // WHEN
+  const auto vertex_id_1{graph.add_vertex(1)};
+  const auto vertex_id_2{graph.add_vertex(2)};
+  const auto vertex_id_3{graph.add_vertex(3)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+  graph.add_edge(vertex_id_1, vertex_id_2, 200);
+  graph.add_edge(vertex_id_1, vertex_id_3, 300);
+  graph.remove_edge(vertex_id_1, vertex_id_3);
+  graph.remove_vertex(vertex_id_2);
+
+  // THEN - Adding an existing edge has no effect and is not reported
+  const std::vector<std::string> expected_changes{
+      "+v0", "+v1", "+v2", "+e01", "+e02", "-e02", "-e01", "-v1"};
+  ASSERT_EQ(observer.changes, expected_changes);
+
+  // A copy of the graph is not observed
+  auto graph_copy{graph};
+  ASSERT_EQ(graph_copy.get_observer(), nullptr);
+  [[maybe_unused]] const auto vertex_id_4{graph_copy.add_vertex(4)};
+  ASSERT_EQ(observer.changes.size(), expected_changes.size());
+
+  graph.set_observer(nullptr);
+  [[maybe_unused]] const auto vertex_id_5{graph.add_vertex(5)};
+  ASSERT_EQ(observer.changes.size(), expected_changes.size());
+}
+
+TYPED_TEST(GraphTest, ObserverIsNotifiedOfReplacement) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+  graph_t other_graph{};
+  [[maybe_unused]] const auto vertex_id_1{other_graph.add_vertex(1)};
+  recording_observer observer{};
+  recording_observer other_observer{};
+  graph.set_observer(&observer);
+  other_graph.set_observer(&other_observer);
+
+  // WHEN - THEN - Assignment keeps the observer, which learns that the
+  // contents were replaced
+  graph = other_graph;
+  ASSERT_EQ(graph.get_observer(), &observer);
+  ASSERT_EQ(observer.replacement_count, 1);
+  ASSERT_EQ(other_observer.replacement_count, 0);
+
+  // Moving replaces the contents of both graphs
+  graph = std::move(other_graph);
+  ASSERT_EQ(observer.replacement_count, 2);
+  ASSERT_EQ(other_observer.replacement_count, 1);
+
+  const auto moved_graph{std::move(graph)};
+  ASSERT_EQ(moved_graph.get_observer(), nullptr);
+  ASSERT_EQ(observer.replacement_count, 3);
+  ASSERT_TRUE(observer.changes.empty());
+}
+
+TYPED_TEST(GraphTest, MemoryUsage) {
+  // GIVEN
+  using graph_t = typename TestFixture::graph_t;
+  graph_t graph{};
+  const auto empty_usage{graph.memory_usage()};
+
+  // WHEN
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertices_usage{graph.memory_usage()};
+
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+  const auto edges_usage{graph.memory_usage()};
+
+  // THEN - Vertices only enter the adjacency list once they have an edge
+  ASSERT_GT(vertices_usage.vertices, empty_usage.vertices);
+  ASSERT_EQ(vertices_usage.adjacency, empty_usage.adjacency);
+  ASSERT_EQ(vertices_usage.edges, empty_usage.edges);
+
+  ASSERT_EQ(edges_usage.vertices, vertices_usage.vertices);
+  ASSERT_GT(edges_usage.edges, vertices_usage.edges);
+  ASSERT_GT(edges_usage.adjacency, vertices_usage.adjacency);
+
+  ASSERT_EQ(edges_usage.total(),
+            edges_usage.vertices + edges_usage.edges + edges_usage.adjacency);
+}
+
 TYPED_TEST(GraphTest, GetEdgeNonExistingEdge) {
   using vertex_id_t = std::size_t;
   using graph_t = typename TestFixture::graph_t;
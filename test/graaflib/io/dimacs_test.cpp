@@ -0,0 +1,124 @@
+#include <graaflib/graph.h>
+#include <graaflib/io/dimacs.h>
+#include <graaflib/types.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace graaf::io {
+
+TEST(DimacsTest, WriteDirectedGraph) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_1, vertex_2, 3);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_dimacs(graph, stream);
+
+  // THEN
+  ASSERT_EQ(stream.str(),
+            "p sp 2 1\n"
+            "a 1 2 3\n");
+}
+
+TEST(DimacsTest, WriteUndirectedGraphAsArcPairs) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_1, vertex_2, 3);
+  graph.add_edge(vertex_2, vertex_2, 4);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_dimacs(graph, stream);
+
+  // THEN - The self loop is written once
+  std::istringstream read_stream{stream.str()};
+  const auto read_graph{
+      from_dimacs<int, int, graph_type::DIRECTED>(read_stream)};
+  ASSERT_EQ(read_graph.edge_count(), 3);
+  ASSERT_EQ(read_graph.get_edge(0, 1), 3);
+  ASSERT_EQ(read_graph.get_edge(1, 0), 3);
+  ASSERT_EQ(read_graph.get_edge(1, 1), 4);
+}
+
+TEST(DimacsTest, ReadGraph) {
+  // GIVEN
+  std::istringstream stream{
+      "c 9th DIMACS Implementation Challenge\n"
+      "p sp 3 4\n"
+      "c Arcs\n"
+      "a 1 2 10\n"
+      "a 2 1 10\n"
+      "\n"
+      "a 2 3 20\n"
+      "a 3 1 30\n"};
+
+  // WHEN
+  const auto directed{from_dimacs<int, int, graph_type::DIRECTED>(stream)};
+  stream.clear();
+  stream.seekg(0);
+  const auto undirected{from_dimacs<int, int, graph_type::UNDIRECTED>(stream)};
+
+  // THEN - Arcs in both directions collapse into one undirected edge
+  ASSERT_EQ(directed.vertex_count(), 3);
+  ASSERT_EQ(directed.edge_count(), 4);
+  ASSERT_EQ(directed.get_edge(2, 0), 30);
+  ASSERT_EQ(undirected.vertex_count(), 3);
+  ASSERT_EQ(undirected.edge_count(), 3);
+  ASSERT_EQ(undirected.get_edge(0, 2), 30);
+}
+
+TEST(DimacsTest, FileRoundTrip) {
+  // GIVEN
+  directed_graph<int, long> graph{};
+  for (int vertex{0}; vertex < 100; ++vertex) {
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(vertex)};
+  }
+  for (vertex_id_t vertex_id{1}; vertex_id < 100; ++vertex_id) {
+    graph.add_edge(vertex_id, vertex_id - 1, static_cast<long>(vertex_id));
+  }
+
+  const std::filesystem::path path{"./test.gr"};
+  to_dimacs(graph, path);
+
+  // WHEN
+  const auto read_graph{from_dimacs<int, long, graph_type::DIRECTED>(path)};
+
+  // THEN
+  ASSERT_EQ(read_graph.vertex_count(), 100);
+  ASSERT_EQ(read_graph.edge_count(), 99);
+  for (vertex_id_t vertex_id{1}; vertex_id < 100; ++vertex_id) {
+    ASSERT_EQ(read_graph.get_edge(vertex_id, vertex_id - 1),
+              static_cast<long>(vertex_id));
+  }
+}
+
+TEST(DimacsTest, InvalidInput) {
+  const auto read{[](const std::string& input) {
+    std::istringstream stream{input};
+    return from_dimacs<int, int, graph_type::DIRECTED>(stream);
+  }};
+
+  // Missing problem line
+  ASSERT_THROW((void)read("c Only a comment\n"), std::invalid_argument);
+  // Arc before the problem line
+  ASSERT_THROW((void)read("a 1 2 3\np sp 2 1\n"), std::invalid_argument);
+  // Unsupported problem
+  ASSERT_THROW((void)read("p max 2 1\na 1 2 3\n"), std::invalid_argument);
+  // Vertex out of range
+  ASSERT_THROW((void)read("p sp 2 1\na 1 3 3\n"), std::invalid_argument);
+  // Arc count mismatch
+  ASSERT_THROW((void)read("p sp 2 2\na 1 2 3\n"), std::invalid_argument);
+  // Unknown line descriptor
+  ASSERT_THROW((void)read("p sp 2 1\nx 1 2 3\n"), std::invalid_argument);
+}
+
+}  // namespace graaf::io
@@ -6,7 +6,11 @@
 
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -70,6 +74,24 @@ inline std::pair<vertex_id_t, vertex_id_t> make_sorted_pair(
   return {std::istreambuf_iterator<char>{dot_file},
           std::istreambuf_iterator<char>{}};
 }
+
+/**
+ * @brief Creates a path graph with the given number of vertices, which is large
+ * enough to span multiple chunks and buffer flushes.
+ */
+[[nodiscard]] directed_graph<int, int> create_path_graph(
+    std::size_t number_of_vertices) {
+  directed_graph<int, int> graph{};
+
+  auto previous_vertex{graph.add_vertex(0)};
+  for (std::size_t i{1}; i < number_of_vertices; ++i) {
+    const auto vertex{graph.add_vertex(static_cast<int>(i))};
+    graph.add_edge(previous_vertex, vertex, static_cast<int>(i));
+    previous_vertex = vertex;
+  }
+
+  return graph;
+}
 }  // namespace
 
 TEST(DotTest, EmptyUndirectedGraph) {
@@ -249,4 +271,286 @@ TEST(DotTest, DefaultWriters) {
                                            vertex_2)) != std::string::npos);
 }
 
-}  // namespace graaf::io
\ No newline at end of file
+TEST(DotTest, StreamOutputMatchesFileOutput) {
+  // GIVEN
+  const std::filesystem::path path{"./test.dot"};
+  const auto graph{create_path_graph(100)};
+
+  // WHEN
+  to_dot(graph, path);
+  std::ostringstream stream{};
+  to_dot(graph, stream);
+
+  // THEN
+  ASSERT_EQ(stream.str(), read_to_string(path));
+  ASSERT_TRUE(stream.str().starts_with("digraph {\n"));
+  ASSERT_TRUE(stream.str().ends_with("}\n"));
+}
+
+TEST(DotTest, OutputIterator) {
+  // GIVEN
+  const auto graph{create_path_graph(100)};
+
+  // WHEN
+  std::string dot_content{};
+  auto output{to_dot(graph, std::back_inserter(dot_content), int_vertex_writer,
+                     int_edge_writer, dot_options{})};
+
+  // THEN
+  std::ostringstream expected_stream{};
+  to_dot(graph, expected_stream, int_vertex_writer, int_edge_writer);
+  ASSERT_EQ(dot_content, expected_stream.str());
+
+  // The returned iterator can be used to continue writing
+  *output = '#';
+  ASSERT_TRUE(dot_content.ends_with("}\n#"));
+}
+
+TEST(DotTest, SmallBufferMatchesDefaultBuffer) {
+  // GIVEN
+  const auto graph{create_path_graph(1'000)};
+  std::ostringstream expected_stream{};
+  to_dot(graph, expected_stream);
+
+  // WHEN - A buffer smaller than a single line
+  std::ostringstream stream{};
+  to_dot(graph, stream, detail::default_vertex_writer<int>,
+         detail::default_edge_writer, dot_options{.buffer_size = 1});
+
+  // THEN
+  ASSERT_EQ(stream.str(), expected_stream.str());
+}
+
+TEST(DotTest, ParallelFormattingMatchesSequentialFormatting) {
+  // GIVEN
+  const auto graph{create_path_graph(10'000)};
+  std::ostringstream expected_stream{};
+  to_dot(graph, expected_stream);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_dot(graph, stream, detail::default_vertex_writer<int>,
+         detail::default_edge_writer,
+         dot_options{.thread_count = 4, .chunk_size = 100});
+
+  // THEN - Chunks are concatenated in their original order
+  ASSERT_EQ(stream.str(), expected_stream.str());
+}
+
+TEST(DotTest, ParallelFormattingOnCallerProvidedExecutor) {
+  // GIVEN
+  const auto graph{create_path_graph(1'000)};
+  std::ostringstream expected_stream{};
+  to_dot(graph, expected_stream);
+  thread_pool_executor executor{{.thread_count = 2}};
+
+  // WHEN
+  std::ostringstream stream{};
+  to_dot(graph, stream, detail::default_vertex_writer<int>,
+         detail::default_edge_writer,
+         dot_options{
+             .thread_count = 4, .executor = &executor, .chunk_size = 10});
+
+  // THEN
+  ASSERT_EQ(stream.str(), expected_stream.str());
+}
+
+TEST(DotTest, ParallelFormattingEmptyGraph) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+
+  // WHEN
+  std::ostringstream stream{};
+  to_dot(graph, stream, detail::default_vertex_writer<int>,
+         detail::default_edge_writer, dot_options{.thread_count = 4});
+
+  // THEN
+  ASSERT_EQ(stream.str(), "graph {\n}\n");
+}
+
+TEST(DotReaderTest, RoundTripDirectedGraph) {
+  // GIVEN
+  const std::filesystem::path path{"./test_round_trip.dot"};
+  directed_graph<int, int> graph{};
+
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  const auto vertex_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_1, vertex_2, 100);
+  graph.add_edge(vertex_2, vertex_3, 200);
+  graph.add_edge(vertex_3, vertex_1, 300);
+  to_dot(graph, path);
+
+  // WHEN
+  const auto read_graph{from_dot<int, int, graph_type::DIRECTED>(path)};
+
+  // THEN - Vertex ids may differ, so we look up vertices by their value
+  ASSERT_EQ(read_graph.vertex_count(), 3);
+  ASSERT_EQ(read_graph.edge_count(), 3);
+
+  std::unordered_map<int, vertex_id_t> vertex_ids{};
+  for (const auto& [vertex_id, vertex] : read_graph.get_vertices()) {
+    vertex_ids[vertex] = vertex_id;
+  }
+
+  ASSERT_EQ(read_graph.get_edge(vertex_ids.at(10), vertex_ids.at(20)), 100);
+  ASSERT_EQ(read_graph.get_edge(vertex_ids.at(20), vertex_ids.at(30)), 200);
+  ASSERT_EQ(read_graph.get_edge(vertex_ids.at(30), vertex_ids.at(10)), 300);
+}
+
+TEST(DotReaderTest, RoundTripUndirectedGraph) {
+  // GIVEN
+  undirected_graph<int, float> graph{};
+
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_1, vertex_2, 1.5f);
+
+  std::stringstream stream{};
+  to_dot(graph, stream);
+
+  // WHEN
+  const auto read_graph{from_dot<int, float, graph_type::UNDIRECTED>(stream)};
+
+  // THEN
+  ASSERT_EQ(read_graph.vertex_count(), 2);
+  ASSERT_EQ(read_graph.edge_count(), 1);
+  const auto [read_vertex_1, read_vertex_2]{
+      read_graph.get_edges().begin()->first};
+  ASSERT_TRUE(read_graph.has_edge(read_vertex_2, read_vertex_1));
+  ASSERT_FLOAT_EQ(read_graph.get_edge(read_vertex_1, read_vertex_2), 1.5f);
+}
+
+TEST(DotReaderTest, EdgeChainsAndSubgraphs) {
+  // GIVEN
+  std::istringstream stream{R"(
+    strict digraph "my graph" {
+      // Line comment
+      a -> b -> c;
+      d -> { e; f } [label=5]
+      /* Block
+         comment */
+      subgraph cluster { g -> h }
+    }
+  )"};
+
+  // WHEN
+  const auto graph{from_dot<int, int, graph_type::DIRECTED>(stream)};
+
+  // THEN - Vertices are numbered in order of appearance
+  ASSERT_EQ(graph.vertex_count(), 8);
+  ASSERT_EQ(graph.edge_count(), 5);
+  ASSERT_TRUE(graph.has_edge(0, 1));
+  ASSERT_TRUE(graph.has_edge(1, 2));
+  ASSERT_EQ(graph.get_edge(0, 1), 1);
+  ASSERT_EQ(graph.get_edge(3, 4), 5);
+  ASSERT_EQ(graph.get_edge(3, 5), 5);
+  ASSERT_TRUE(graph.has_edge(6, 7));
+}
+
+TEST(DotReaderTest, UserProvidedReaders) {
+  // GIVEN
+  struct vertex_t {
+    std::string name{};
+    std::string color{};
+  };
+
+  std::istringstream stream{R"(
+    graph {
+      node [shape=box];
+      "vertex 1" [label="first", color=red];
+      "vertex 1" [color="dark blue"];
+      <<b>2</b>> [label=second];
+      "vertex 1":port:n -- <<b>2</b>> [weight=3.5; style=dashed]
+    }
+  )"};
+
+  const auto vertex_reader{
+      [](std::string_view dot_id, const dot_attributes& attributes) {
+        return vertex_t{std::string{dot_id},
+                        std::string{attributes.get("color").value_or("")}};
+      }};
+  const auto edge_reader{
+      [](const edge_id_t& /*edge_id*/, const dot_attributes& attributes) {
+        return detail::parse_number<double>(*attributes.get("weight"));
+      }};
+
+  // WHEN
+  const auto graph{from_dot<vertex_t, double, graph_type::UNDIRECTED>(
+      stream, vertex_reader, edge_reader)};
+
+  // THEN - The last specified value of an attribute is used
+  ASSERT_EQ(graph.vertex_count(), 2);
+  ASSERT_EQ(graph.get_vertex(0).name, "vertex 1");
+  ASSERT_EQ(graph.get_vertex(0).color, "dark blue");
+  ASSERT_EQ(graph.get_vertex(1).name, "<b>2</b>");
+  ASSERT_EQ(graph.get_vertex(1).color, "");
+  ASSERT_DOUBLE_EQ(graph.get_edge(0, 1), 3.5);
+}
+
+TEST(DotReaderTest, MismatchingGraphType) {
+  // GIVEN
+  std::istringstream stream{"digraph { a -> b }"};
+
+  // WHEN - THEN
+  ASSERT_THROW((void)(from_dot<int, int, graph_type::UNDIRECTED>(stream)),
+               std::invalid_argument);
+}
+
+TEST(DotReaderTest, InvalidInputReportsLine) {
+  // GIVEN
+  std::istringstream stream{"graph {\n a -- b;\n a -> c;\n}"};
+
+  // WHEN - THEN
+  try {
+    [[maybe_unused]] const auto graph{
+        from_dot<int, int, graph_type::UNDIRECTED>(stream)};
+    FAIL() << "Expected std::invalid_argument";
+  } catch (const std::invalid_argument& error) {
+    ASSERT_TRUE(std::string{error.what()}.find("line 3") != std::string::npos);
+  }
+}
+
+TEST(DotReaderTest, UnterminatedGraph) {
+  // GIVEN
+  std::istringstream stream{"digraph { a -> b"};
+
+  // WHEN - THEN
+  ASSERT_THROW((void)(from_dot<int, int, graph_type::DIRECTED>(stream)),
+               std::invalid_argument);
+}
+
+TEST(DotReaderTest, NonExistingFile) {
+  // GIVEN
+  const std::filesystem::path path{"./does_not_exist.dot"};
+
+  // WHEN - THEN
+  ASSERT_THROW((void)(from_dot<int, int, graph_type::DIRECTED>(path)),
+               std::invalid_argument);
+}
+
+TEST(DotReaderTest, LargeRoundTrip) {
+  // GIVEN
+  const std::filesystem::path path{"./test_large_round_trip.dot"};
+  const auto graph{create_path_graph(10'000)};
+  to_dot(graph, path);
+
+  // WHEN
+  const auto read_graph{from_dot<int, int, graph_type::DIRECTED>(path)};
+
+  // THEN - Writing the read graph again results in the same vertices and edges
+  ASSERT_EQ(read_graph.vertex_count(), graph.vertex_count());
+  ASSERT_EQ(read_graph.edge_count(), graph.edge_count());
+
+  std::unordered_map<int, vertex_id_t> vertex_ids{};
+  for (const auto& [vertex_id, vertex] : read_graph.get_vertices()) {
+    vertex_ids[vertex] = vertex_id;
+  }
+  for (const auto& [edge_id, edge] : graph.get_edges()) {
+    const auto read_lhs{vertex_ids.at(graph.get_vertex(edge_id.first))};
+    const auto read_rhs{vertex_ids.at(graph.get_vertex(edge_id.second))};
+    ASSERT_EQ(read_graph.get_edge(read_lhs, read_rhs), edge);
+  }
+}
+
+}  // namespace graaf::io
@@ -0,0 +1,204 @@
+#include <graaflib/graph.h>
+#include <graaflib/io/durable_graph.h>
+#include <graaflib/types.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace graaf::io {
+
+namespace {
+
+// Every test uses its own directory, since tests may run in parallel
+std::filesystem::path make_empty_directory(const std::string& name) {
+  const auto directory{std::filesystem::temp_directory_path() /
+                       ("graaf_durable_graph_" + name)};
+  std::filesystem::remove_all(directory);
+  return directory;
+}
+
+template <typename GRAPH_T>
+void expect_equal_graphs(const GRAPH_T& expected, const GRAPH_T& actual) {
+  ASSERT_EQ(expected.vertex_count(), actual.vertex_count());
+  ASSERT_EQ(expected.edge_count(), actual.edge_count());
+  for (const auto& [vertex_id, vertex] : expected.get_vertices()) {
+    ASSERT_TRUE(actual.has_vertex(vertex_id));
+    ASSERT_EQ(actual.get_vertex(vertex_id), vertex);
+  }
+  for (const auto& [edge_id, edge] : expected.get_edges()) {
+    ASSERT_TRUE(actual.has_edge(edge_id.first, edge_id.second));
+    ASSERT_EQ(actual.get_edge(edge_id), edge);
+  }
+}
+
+}  // namespace
+
+TEST(DurableGraphTest, RecoverFromLog) {
+  // GIVEN
+  const auto directory{make_empty_directory("recover_from_log")};
+  directed_graph<int, int> expected{};
+  {
+    durable_graph<directed_graph<int, int>> graph{directory};
+    const auto vertex_1{graph.add_vertex(10)};
+    const auto vertex_2{graph.add_vertex(20)};
+    const auto vertex_3{graph.add_vertex(30)};
+    graph.add_edge(vertex_1, vertex_2, 100);
+    graph.add_edge(vertex_2, vertex_3, 200);
+    graph.add_edge(vertex_3, vertex_1, 300);
+    graph.remove_edge(vertex_2, vertex_3);
+    graph.remove_vertex(vertex_1);
+    graph.commit();
+    expected = graph.get_graph();
+  }
+
+  // WHEN
+  const durable_graph<directed_graph<int, int>> recovered{directory};
+
+  // THEN
+  expect_equal_graphs(expected, recovered.get_graph());
+}
+
+TEST(DurableGraphTest, RecoverFromSnapshotAndLog) {
+  // GIVEN
+  const auto directory{make_empty_directory("recover_from_snapshot")};
+  undirected_graph<int, double> expected{};
+  {
+    durable_graph<undirected_graph<int, double>> graph{directory};
+    const auto vertex_1{graph.add_vertex(10)};
+    const auto vertex_2{graph.add_vertex(20)};
+    graph.add_edge(vertex_1, vertex_2, 1.5);
+    graph.snapshot();
+
+    const auto vertex_3{graph.add_vertex(30)};
+    graph.add_edge(vertex_3, vertex_2, 2.5);
+    graph.commit();
+    expected = graph.get_graph();
+  }
+
+  // WHEN
+  const durable_graph<undirected_graph<int, double>> recovered{directory};
+
+  // THEN
+  expect_equal_graphs(expected, recovered.get_graph());
+}
+
+TEST(DurableGraphTest, VertexIdsAreNotReusedAfterRecovery) {
+  // GIVEN - The vertex with the largest ID is removed before a snapshot
+  const auto directory{make_empty_directory("vertex_ids")};
+  vertex_id_t removed_vertex_id{};
+  {
+    durable_graph<directed_graph<int, int>> graph{directory};
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(10)};
+    removed_vertex_id = graph.add_vertex(20);
+    graph.remove_vertex(removed_vertex_id);
+    graph.snapshot();
+  }
+
+  // WHEN
+  durable_graph<directed_graph<int, int>> recovered{directory};
+  const auto new_vertex_id{recovered.add_vertex(30)};
+
+  // THEN
+  ASSERT_GT(new_vertex_id, removed_vertex_id);
+}
+
+TEST(DurableGraphTest, TornTailIsDiscarded) {
+  // GIVEN - A crash during a write left an incomplete record behind
+  const auto directory{make_empty_directory("torn_tail")};
+  directed_graph<int, int> expected{};
+  {
+    durable_graph<directed_graph<int, int>> graph{directory};
+    const auto vertex_1{graph.add_vertex(10)};
+    const auto vertex_2{graph.add_vertex(20)};
+    graph.add_edge(vertex_1, vertex_2, 100);
+    graph.commit();
+    expected = graph.get_graph();
+  }
+  {
+    std::ofstream log{directory / "graph.log",
+                      std::ios::binary | std::ios::app};
+    log << "\x20\x00\x00\x00garbage";
+  }
+
+  // WHEN
+  {
+    durable_graph<directed_graph<int, int>> recovered{directory};
+    expect_equal_graphs(expected, recovered.get_graph());
+
+    // Mutations after recovery are appended after the last valid record
+    const auto vertex_3{recovered.add_vertex(30)};
+    recovered.add_edge(vertex_3, 0, 300);
+    recovered.commit();
+    expected = recovered.get_graph();
+  }
+  const durable_graph<directed_graph<int, int>> recovered{directory};
+
+  // THEN
+  expect_equal_graphs(expected, recovered.get_graph());
+}
+
+TEST(DurableGraphTest, LogOfPreviousGenerationIsIgnored) {
+  // GIVEN - A crash after writing a snapshot, before starting the new log
+  const auto directory{make_empty_directory("previous_generation")};
+  directed_graph<int, int> expected{};
+  std::string previous_log{};
+  {
+    durable_graph<directed_graph<int, int>> graph{directory};
+    const auto vertex_1{graph.add_vertex(10)};
+    const auto vertex_2{graph.add_vertex(20)};
+    graph.add_edge(vertex_1, vertex_2, 100);
+    graph.commit();
+
+    std::ifstream log{directory / "graph.log", std::ios::binary};
+    previous_log.assign(std::istreambuf_iterator<char>{log},
+                        std::istreambuf_iterator<char>{});
+
+    graph.snapshot();
+    expected = graph.get_graph();
+  }
+  {
+    std::ofstream log{directory / "graph.log",
+                      std::ios::binary | std::ios::trunc};
+    log << previous_log;
+  }
+
+  // WHEN
+  const durable_graph<directed_graph<int, int>> recovered{directory};
+
+  // THEN - The mutations are not applied twice
+  expect_equal_graphs(expected, recovered.get_graph());
+}
+
+TEST(DurableGraphTest, AutomaticSnapshotBoundsLogSize) {
+  // GIVEN
+  const auto directory{make_empty_directory("automatic_snapshot")};
+  const durable_graph_options options{.group_commit_bytes = 256,
+                                      .snapshot_threshold_bytes = 1024,
+                                      .sync = false};
+  directed_graph<int, int> expected{};
+
+  // WHEN
+  {
+    durable_graph<directed_graph<int, int>> graph{directory, options};
+    auto previous_vertex_id{graph.add_vertex(0)};
+    for (int vertex{1}; vertex < 1000; ++vertex) {
+      const auto vertex_id{graph.add_vertex(vertex)};
+      graph.add_edge(previous_vertex_id, vertex_id, vertex);
+      previous_vertex_id = vertex_id;
+
+      // THEN
+      ASSERT_LT(graph.log_size(), options.snapshot_threshold_bytes +
+                                      options.group_commit_bytes + 64);
+    }
+    graph.commit();
+    expected = graph.get_graph();
+  }
+
+  // THEN
+  const durable_graph<directed_graph<int, int>> recovered{directory, options};
+  expect_equal_graphs(expected, recovered.get_graph());
+}
+
+}  // namespace graaf::io
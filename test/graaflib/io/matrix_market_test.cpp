@@ -0,0 +1,147 @@
+#include <graaflib/graph.h>
+#include <graaflib/io/matrix_market.h>
+#include <graaflib/types.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace graaf::io {
+
+TEST(MatrixMarketTest, WriteDirectedGraph) {
+  // GIVEN
+  directed_graph<int, int> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_1, vertex_2, 3);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_matrix_market(graph, stream);
+
+  // THEN
+  ASSERT_EQ(stream.str(),
+            "%%MatrixMarket matrix coordinate integer general\n"
+            "2 2 1\n"
+            "1 2 3\n");
+}
+
+TEST(MatrixMarketTest, WriteUndirectedGraphAsLowerTriangle) {
+  // GIVEN
+  undirected_graph<int, double> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  graph.add_edge(vertex_1, vertex_2, 0.25);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_matrix_market(graph, stream);
+
+  // THEN
+  ASSERT_EQ(stream.str(),
+            "%%MatrixMarket matrix coordinate real symmetric\n"
+            "2 2 1\n"
+            "2 1 0.25\n");
+}
+
+TEST(MatrixMarketTest, RoundTripWithRemovedVertices) {
+  // GIVEN - A graph with non-contiguous vertex ids
+  directed_graph<int, float> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  const auto vertex_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_1, vertex_3, 1.5f);
+  graph.add_edge(vertex_3, vertex_1, 2.5f);
+  graph.remove_vertex(vertex_2);
+
+  std::stringstream stream{};
+  to_matrix_market(graph, stream);
+
+  // WHEN
+  const auto read_graph{
+      from_matrix_market<int, float, graph_type::DIRECTED>(stream)};
+
+  // THEN - Vertex ids are renumbered in increasing order
+  ASSERT_EQ(read_graph.vertex_count(), 2);
+  ASSERT_EQ(read_graph.edge_count(), 2);
+  ASSERT_FLOAT_EQ(read_graph.get_edge(0, 1), 1.5f);
+  ASSERT_FLOAT_EQ(read_graph.get_edge(1, 0), 2.5f);
+}
+
+TEST(MatrixMarketTest, ReadSymmetricPatternIntoDirectedGraph) {
+  // GIVEN
+  std::istringstream stream{
+      "%%MatrixMarket matrix coordinate pattern symmetric\n"
+      "% A comment\n"
+      "\n"
+      "3 3 3\n"
+      "2 1\n"
+      "3 2\n"
+      "3 3\n"};
+
+  // WHEN
+  const auto graph{from_matrix_market<int, int, graph_type::DIRECTED>(stream)};
+
+  // THEN - Off-diagonal entries yield an edge in both directions
+  ASSERT_EQ(graph.vertex_count(), 3);
+  ASSERT_EQ(graph.edge_count(), 5);
+  ASSERT_EQ(graph.get_edge(0, 1), 1);
+  ASSERT_EQ(graph.get_edge(1, 0), 1);
+  ASSERT_EQ(graph.get_edge(1, 2), 1);
+  ASSERT_EQ(graph.get_edge(2, 1), 1);
+  ASSERT_EQ(graph.get_edge(2, 2), 1);
+}
+
+TEST(MatrixMarketTest, FileRoundTrip) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  for (int vertex{0}; vertex < 100; ++vertex) {
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(vertex)};
+  }
+  for (vertex_id_t vertex_id{1}; vertex_id < 100; ++vertex_id) {
+    graph.add_edge(vertex_id - 1, vertex_id, static_cast<int>(vertex_id));
+  }
+
+  const std::filesystem::path path{"./test.mtx"};
+  to_matrix_market(graph, path);
+
+  // WHEN
+  const auto read_graph{
+      from_matrix_market<int, int, graph_type::UNDIRECTED>(path)};
+
+  // THEN
+  ASSERT_EQ(read_graph.vertex_count(), 100);
+  ASSERT_EQ(read_graph.edge_count(), 99);
+  for (vertex_id_t vertex_id{1}; vertex_id < 100; ++vertex_id) {
+    ASSERT_EQ(read_graph.get_edge(vertex_id, vertex_id - 1),
+              static_cast<int>(vertex_id));
+  }
+}
+
+TEST(MatrixMarketTest, InvalidInput) {
+  const auto read{[](const std::string& input) {
+    std::istringstream stream{input};
+    return from_matrix_market<int, int, graph_type::DIRECTED>(stream);
+  }};
+  const std::string header{
+      "%%MatrixMarket matrix coordinate integer general\n"};
+
+  // Unsupported formats
+  ASSERT_THROW((void)read("%%MatrixMarket matrix array real general\n"),
+               std::invalid_argument);
+  ASSERT_THROW(
+      (void)read("%%MatrixMarket matrix coordinate complex general\n"),
+      std::invalid_argument);
+  // Non-square matrix
+  ASSERT_THROW((void)read(header + "2 3 0\n"), std::invalid_argument);
+  // Index out of range
+  ASSERT_THROW((void)read(header + "2 2 1\n3 1 1\n"), std::invalid_argument);
+  // Entry count mismatch
+  ASSERT_THROW((void)read(header + "2 2 2\n1 2 1\n"), std::invalid_argument);
+  // Invalid value
+  ASSERT_THROW((void)read(header + "2 2 1\n1 2 x\n"), std::invalid_argument);
+}
+
+}  // namespace graaf::io
@@ -0,0 +1,178 @@
+#include <graaflib/graph.h>
+#include <graaflib/io/metis.h>
+#include <graaflib/types.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace graaf::io {
+
+TEST(MetisTest, WriteGraph) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_1{graph.add_vertex(10)};
+  const auto vertex_2{graph.add_vertex(20)};
+  [[maybe_unused]] const auto vertex_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_1, vertex_2, 3);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_metis(graph, stream);
+
+  // THEN - The isolated third vertex has an empty adjacency line
+  ASSERT_EQ(stream.str(),
+            "3 1 011\n"
+            "10 2 3\n"
+            "20 1 3\n"
+            "30\n");
+}
+
+TEST(MetisTest, WriteGraphWithSelfLoop) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_id{graph.add_vertex(10)};
+  graph.add_edge(vertex_id, vertex_id, 1);
+
+  // WHEN - THEN
+  std::ostringstream stream{};
+  ASSERT_THROW(to_metis(graph, stream), std::invalid_argument);
+}
+
+TEST(MetisTest, WriteGraphWithNonIntegralWeights) {
+  // GIVEN
+  undirected_graph<double, float> graph{};
+  const auto vertex_1{graph.add_vertex(1.5)};
+  const auto vertex_2{graph.add_vertex(2.5)};
+  graph.add_edge(vertex_1, vertex_2, 0.5F);
+
+  // WHEN
+  std::ostringstream stream{};
+  to_metis(graph, stream);
+
+  // THEN - METIS weights are integers, so none are written
+  ASSERT_EQ(stream.str(),
+            "2 1\n"
+            "2\n"
+            "1\n");
+}
+
+TEST(MetisTest, WriteGraphWithNegativeWeights) {
+  // GIVEN
+  undirected_graph<int, int> graph_with_negative_vertex{};
+  [[maybe_unused]] const auto vertex_id{
+      graph_with_negative_vertex.add_vertex(-1)};
+
+  undirected_graph<int, int> graph_with_negative_edge{};
+  const auto vertex_1{graph_with_negative_edge.add_vertex(10)};
+  const auto vertex_2{graph_with_negative_edge.add_vertex(20)};
+  graph_with_negative_edge.add_edge(vertex_1, vertex_2, -3);
+
+  // WHEN - THEN
+  std::ostringstream stream{};
+  ASSERT_THROW(
+      {
+        try {
+          to_metis(graph_with_negative_vertex, stream);
+        } catch (const std::invalid_argument& ex) {
+          EXPECT_STREQ(ex.what(),
+                       "The METIS format does not support negative weights, "
+                       "found [-1] on vertex [0].");
+          throw;
+        }
+      },
+      std::invalid_argument);
+  ASSERT_THROW(to_metis(graph_with_negative_edge, stream),
+               std::invalid_argument);
+}
+
+TEST(MetisTest, ReadUnweightedGraph) {
+  // GIVEN
+  std::istringstream stream{
+      "% A comment\n"
+      "4 3\n"
+      "2 3\n"
+      "1\n"
+      "1 4\n"
+      "3\n"};
+
+  // WHEN
+  const auto graph{from_metis<int, int, graph_type::UNDIRECTED>(stream)};
+
+  // THEN
+  ASSERT_EQ(graph.vertex_count(), 4);
+  ASSERT_EQ(graph.edge_count(), 3);
+  ASSERT_EQ(graph.get_vertex(0), 0);
+  ASSERT_EQ(graph.get_edge(0, 1), 1);
+  ASSERT_EQ(graph.get_edge(0, 2), 1);
+  ASSERT_EQ(graph.get_edge(2, 3), 1);
+}
+
+TEST(MetisTest, ReadWeightedGraphIntoDirectedGraph) {
+  // GIVEN - Vertex sizes, two vertex weights per vertex and edge weights
+  std::istringstream stream{
+      "2 1 111 2\n"
+      "1 5 6 2 7\n"
+      "1 8 9 1 7\n"};
+
+  // WHEN
+  const auto graph{from_metis<int, int, graph_type::DIRECTED>(stream)};
+
+  // THEN - Only the first vertex weight is kept
+  ASSERT_EQ(graph.vertex_count(), 2);
+  ASSERT_EQ(graph.edge_count(), 2);
+  ASSERT_EQ(graph.get_vertex(0), 5);
+  ASSERT_EQ(graph.get_vertex(1), 8);
+  ASSERT_EQ(graph.get_edge(0, 1), 7);
+  ASSERT_EQ(graph.get_edge(1, 0), 7);
+}
+
+TEST(MetisTest, FileRoundTrip) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  for (int vertex{0}; vertex < 100; ++vertex) {
+    [[maybe_unused]] const auto vertex_id{graph.add_vertex(vertex)};
+  }
+  for (vertex_id_t vertex_id{1}; vertex_id < 100; ++vertex_id) {
+    graph.add_edge(vertex_id - 1, vertex_id, 3 * static_cast<int>(vertex_id));
+  }
+
+  const std::filesystem::path path{"./test.graph"};
+  to_metis(graph, path);
+
+  // WHEN
+  const auto read_graph{from_metis<int, int, graph_type::UNDIRECTED>(path)};
+
+  // THEN
+  ASSERT_EQ(read_graph.vertex_count(), 100);
+  ASSERT_EQ(read_graph.edge_count(), 99);
+  for (vertex_id_t vertex_id{1}; vertex_id < 100; ++vertex_id) {
+    ASSERT_EQ(read_graph.get_vertex(vertex_id), static_cast<int>(vertex_id));
+    ASSERT_EQ(read_graph.get_edge(vertex_id - 1, vertex_id),
+              3 * static_cast<int>(vertex_id));
+  }
+}
+
+TEST(MetisTest, InvalidInput) {
+  const auto read{[](const std::string& input) {
+    std::istringstream stream{input};
+    return from_metis<int, int, graph_type::UNDIRECTED>(stream);
+  }};
+
+  // Missing header
+  ASSERT_THROW((void)read(""), std::invalid_argument);
+  // Invalid format code
+  ASSERT_THROW((void)read("2 1 2\n2\n1\n"), std::invalid_argument);
+  // Missing vertex line
+  ASSERT_THROW((void)read("3 1\n2\n1\n"), std::invalid_argument);
+  // Neighbor out of range
+  ASSERT_THROW((void)read("2 1\n3\n1\n"), std::invalid_argument);
+  // Self loop
+  ASSERT_THROW((void)read("2 1\n1\n1\n"), std::invalid_argument);
+  // Edge listed by one endpoint only
+  ASSERT_THROW((void)read("2 1\n2\n\n"), std::invalid_argument);
+}
+
+}  // namespace graaf::io
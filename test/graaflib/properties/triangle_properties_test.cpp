@@ -0,0 +1,140 @@
+#include <graaflib/csr_graph.h>
+#include <graaflib/generators/erdos_renyi.h>
+#include <graaflib/graph.h>
+#include <graaflib/properties/triangle_properties.h>
+#include <graaflib/types.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace graaf::properties {
+
+TEST(TrianglePropertiesTest, TriangleWithPendantVertex) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  const auto vertex_id_4{graph.add_vertex(40)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 1);
+  graph.add_edge(vertex_id_2, vertex_id_3, 1);
+  graph.add_edge(vertex_id_3, vertex_id_1, 1);
+  graph.add_edge(vertex_id_3, vertex_id_4, 1);
+
+  // WHEN
+  const auto triangles{triangle_count(graph)};
+  const auto vertex_triangles{vertex_triangle_counts(graph)};
+  const auto coefficients{local_clustering_coefficients(graph)};
+  const auto global_coefficient{global_clustering_coefficient(graph)};
+
+  // THEN
+  ASSERT_EQ(triangles, 1);
+  ASSERT_EQ(vertex_triangles.at(vertex_id_1), 1);
+  ASSERT_EQ(vertex_triangles.at(vertex_id_2), 1);
+  ASSERT_EQ(vertex_triangles.at(vertex_id_3), 1);
+  ASSERT_EQ(vertex_triangles.at(vertex_id_4), 0);
+  ASSERT_DOUBLE_EQ(coefficients.at(vertex_id_1), 1);
+  ASSERT_DOUBLE_EQ(coefficients.at(vertex_id_2), 1);
+  ASSERT_DOUBLE_EQ(coefficients.at(vertex_id_3), 1.0 / 3);
+  ASSERT_DOUBLE_EQ(coefficients.at(vertex_id_4), 0);
+  // THEN - Three times one triangle over 1 + 1 + 3 paths of length two
+  ASSERT_DOUBLE_EQ(global_coefficient, 0.6);
+}
+
+TEST(TrianglePropertiesTest, CompleteGraphWithSelfLoop) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  std::vector<vertex_id_t> vertex_ids{};
+  for (int vertex{0}; vertex < 6; ++vertex) {
+    vertex_ids.push_back(graph.add_vertex(vertex));
+  }
+  for (std::size_t lhs{0}; lhs < vertex_ids.size(); ++lhs) {
+    for (auto rhs{lhs + 1}; rhs < vertex_ids.size(); ++rhs) {
+      graph.add_edge(vertex_ids[lhs], vertex_ids[rhs], 1);
+    }
+  }
+  graph.add_edge(vertex_ids[0], vertex_ids[0], 1);
+  const auto csr{make_csr_graph(graph)};
+
+  // WHEN
+  const auto triangles{triangle_count(csr)};
+  const auto vertex_triangles{vertex_triangle_counts(csr)};
+  const auto coefficients{local_clustering_coefficients(csr)};
+
+  // THEN - Self loops do not form triangles
+  ASSERT_EQ(triangles, 20);
+  for (std::size_t index{0}; index < csr.vertex_count(); ++index) {
+    ASSERT_EQ(vertex_triangles[index], 10);
+    ASSERT_DOUBLE_EQ(coefficients[index], 1);
+  }
+  ASSERT_DOUBLE_EQ(global_clustering_coefficient(csr), 1);
+}
+
+TEST(TrianglePropertiesTest, GraphWithoutEdges) {
+  // GIVEN
+  undirected_graph<int, int> graph{};
+  const auto vertex_id_1{graph.add_vertex(10)};
+
+  // WHEN - THEN
+  ASSERT_EQ(triangle_count(graph), 0);
+  ASSERT_DOUBLE_EQ(local_clustering_coefficients(graph).at(vertex_id_1), 0);
+  ASSERT_DOUBLE_EQ(global_clustering_coefficient(graph), 0);
+}
+
+TEST(TrianglePropertiesTest, AllOverloadsMatchBruteForce) {
+  // GIVEN - A random graph with a few hubs, whose neighbors are intersected
+  // with those of low degree vertices
+  auto graph{generators::erdos_renyi_gnp<int, int, graph_type::UNDIRECTED>(
+      300, 0.05, {.seed = 12})};
+  std::vector<vertex_id_t> vertex_ids{};
+  for (const auto& [vertex_id, _] : graph.get_vertices()) {
+    vertex_ids.push_back(vertex_id);
+  }
+  for (std::size_t hub{0}; hub < 3; ++hub) {
+    for (std::size_t other{hub + 1}; other < vertex_ids.size(); other += 2) {
+      if (!graph.has_edge(vertex_ids[hub], vertex_ids[other])) {
+        graph.add_edge(vertex_ids[hub], vertex_ids[other], 1);
+      }
+    }
+  }
+  const auto csr{make_csr_graph(graph)};
+
+  std::size_t expected_triangles{0};
+  std::vector<std::size_t> expected_vertex_triangles(csr.vertex_count(), 0);
+  for (std::size_t first{0}; first < csr.vertex_count(); ++first) {
+    for (auto second{first + 1}; second < csr.vertex_count(); ++second) {
+      for (auto third{second + 1}; third < csr.vertex_count(); ++third) {
+        if (csr.has_edge(first, second) && csr.has_edge(second, third) &&
+            csr.has_edge(third, first)) {
+          ++expected_triangles;
+          ++expected_vertex_triangles[first];
+          ++expected_vertex_triangles[second];
+          ++expected_vertex_triangles[third];
+        }
+      }
+    }
+  }
+
+  // WHEN
+  const auto vertex_triangles{vertex_triangle_counts(graph)};
+  const auto parallel_vertex_triangles{
+      vertex_triangle_counts(execution::par, csr)};
+  const auto coefficients{local_clustering_coefficients(csr)};
+  const auto parallel_coefficients{
+      local_clustering_coefficients(execution::par, csr)};
+
+  // THEN
+  ASSERT_EQ(triangle_count(csr), expected_triangles);
+  ASSERT_EQ(triangle_count(execution::par, csr), expected_triangles);
+  for (std::size_t index{0}; index < csr.vertex_count(); ++index) {
+    ASSERT_EQ(vertex_triangles.at(csr.vertex_id(index)),
+              expected_vertex_triangles[index]);
+    ASSERT_EQ(parallel_vertex_triangles[index],
+              expected_vertex_triangles[index]);
+    ASSERT_DOUBLE_EQ(parallel_coefficients[index], coefficients[index]);
+  }
+  ASSERT_DOUBLE_EQ(global_clustering_coefficient(execution::par, csr),
+                   global_clustering_coefficient(csr));
+}
+
+}  // namespace graaf::properties
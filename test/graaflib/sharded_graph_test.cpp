@@ -0,0 +1,89 @@
+#include <graaflib/graph.h>
+#include <graaflib/sharded_graph.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace graaf {
+
+TEST(ShardedGraphTest, AddVerticesAndEdges) {
+  // GIVEN
+  sharded_graph<directed_graph<int, int>> graph{{.shard_count = 4}};
+
+  // WHEN
+  const auto vertex_id_1{graph.add_vertex(10)};
+  const auto vertex_id_2{graph.add_vertex(20, 7)};
+  const auto vertex_id_3{graph.add_vertex(30)};
+  graph.add_edge(vertex_id_1, vertex_id_2, 100);
+  graph.add_edge(vertex_id_1, vertex_id_2, 200);
+
+  // THEN - Later vertices get IDs after explicit ones, duplicate edges are
+  // ignored
+  ASSERT_EQ(vertex_id_3, 8);
+  ASSERT_EQ(graph.vertex_count(), 3);
+  ASSERT_EQ(graph.edge_count(), 1);
+  ASSERT_TRUE(graph.has_edge(vertex_id_1, vertex_id_2));
+  ASSERT_FALSE(graph.has_edge(vertex_id_2, vertex_id_1));
+  ASSERT_EQ(graph.to_graph().get_edge(vertex_id_1, vertex_id_2), 100);
+
+  ASSERT_THROW((void)graph.add_vertex(40, vertex_id_2), std::invalid_argument);
+  ASSERT_THROW(graph.add_edge(vertex_id_1, 42, 300), std::invalid_argument);
+}
+
+TEST(ShardedGraphTest, ConcurrentIngestion) {
+  // GIVEN
+  constexpr std::size_t thread_count{8};
+  constexpr std::size_t vertices_per_thread{500};
+  sharded_graph<undirected_graph<int, int>> graph{};
+
+  // WHEN - Every thread adds its own vertices, then connects them to the
+  // vertices of the next thread. Every edge is inserted by both threads.
+  std::vector<std::vector<vertex_id_t>> vertex_ids(thread_count);
+  {
+    std::vector<std::jthread> producers{};
+    for (std::size_t thread{0}; thread < thread_count; ++thread) {
+      producers.emplace_back([&graph, &vertex_ids, thread]() {
+        for (std::size_t vertex{0}; vertex < vertices_per_thread; ++vertex) {
+          vertex_ids[thread].push_back(
+              graph.add_vertex(static_cast<int>(vertex)));
+        }
+      });
+    }
+  }
+  {
+    std::vector<std::jthread> producers{};
+    for (std::size_t thread{0}; thread < thread_count; ++thread) {
+      producers.emplace_back([&graph, &vertex_ids, thread]() {
+        const auto& own{vertex_ids[thread]};
+        const auto& next{vertex_ids[(thread + 1) % thread_count]};
+        const auto& previous{
+            vertex_ids[(thread + thread_count - 1) % thread_count]};
+        for (std::size_t vertex{0}; vertex < vertices_per_thread; ++vertex) {
+          graph.add_edge(own[vertex], next[vertex], 1);
+          graph.add_edge(own[vertex], previous[vertex], 1);
+        }
+      });
+    }
+  }
+
+  // THEN
+  const auto expected_edge_count{thread_count * vertices_per_thread};
+  ASSERT_EQ(graph.vertex_count(), thread_count * vertices_per_thread);
+  ASSERT_EQ(graph.edge_count(), expected_edge_count);
+
+  const auto csr{graph.freeze()};
+  ASSERT_EQ(csr.vertex_count(), graph.vertex_count());
+  ASSERT_EQ(csr.edge_count(), expected_edge_count);
+  for (std::size_t index{0}; index < csr.vertex_count(); ++index) {
+    ASSERT_EQ(csr.degree(index), 2);
+  }
+
+  const auto frozen_graph{graph.to_graph()};
+  ASSERT_EQ(frozen_graph.vertex_count(), graph.vertex_count());
+  ASSERT_EQ(frozen_graph.edge_count(), expected_edge_count);
+  ASSERT_TRUE(frozen_graph.has_edge(vertex_ids[1][3], vertex_ids[0][3]));
+}
+
+}  // namespace graaf
@@ -0,0 +1,233 @@
+import argparse
+import json
+import math
+import statistics
+import subprocess
+import sys
+from pathlib import Path
+
+"""
+This script tracks benchmark results across commits. It runs the Graaf_perf executable with
+repetitions, stores the results as JSON and compares them against a baseline, which is either
+checked in or produced locally from an earlier commit:
+
+tools/benchmark_regression.py run --executable build/perf/Graaf_perf --output baseline.json
+# ... change the library and rebuild ...
+tools/benchmark_regression.py check --executable build/perf/Graaf_perf --baseline baseline.json
+
+Arguments which are not recognized are passed on to Graaf_perf, e.g. --benchmark_filter=dijkstra.
+
+Benchmarks are compared on their throughput: the edges_per_second counter when they report it,
+the inverse of their real time otherwise. A benchmark regresses when its median throughput drops
+by more than the threshold and a two-sided Mann-Whitney U test on the repetitions finds the
+difference significant. The script exits with status 1 if any benchmark regresses.
+"""
+
+MIN_REPETITIONS = 5
+
+# Above this number of samples, the normal approximation of the U statistic is used
+EXACT_TEST_MAX_SAMPLES = 40
+
+TIME_UNIT_IN_NS = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def run_benchmarks(executable, output, repetitions, extra_args):
+    if repetitions < MIN_REPETITIONS:
+        sys.exit(f"At least {MIN_REPETITIONS} repetitions are needed for a significance test.")
+
+    command = [
+        str(executable),
+        f"--benchmark_repetitions={repetitions}",
+        # Interleaving the repetitions of different benchmarks spreads out the noise of the machine
+        "--benchmark_enable_random_interleaving=true",
+        f"--benchmark_out={output}",
+        "--benchmark_out_format=json",
+        *extra_args,
+    ]
+    print(" ".join(command), flush=True)
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+
+
+def read_throughput_samples(file):
+    """Reads the throughput of every repetition, grouped by benchmark name."""
+    with open(file) as f:
+        results = json.load(f)
+
+    samples = {}
+    for benchmark in results["benchmarks"]:
+        if benchmark.get("run_type") == "aggregate" or "error_occurred" in benchmark:
+            continue
+
+        if "edges_per_second" in benchmark:
+            throughput = benchmark["edges_per_second"]
+        else:
+            time_in_ns = benchmark["real_time"] * TIME_UNIT_IN_NS[benchmark["time_unit"]]
+            throughput = 1e9 / time_in_ns
+
+        samples.setdefault(benchmark["run_name"], []).append(throughput)
+    return samples
+
+
+def exact_u_distribution(n_lhs, n_rhs):
+    """The number of orderings of the samples which yield each value of U, without ties."""
+    # counts[j][u] for i samples of lhs and j samples of rhs, extended one lhs sample at a time.
+    # The largest of i samples of lhs exceeds all j samples of rhs, adding j to U.
+    counts = [[1] for _ in range(n_rhs + 1)]
+    for _ in range(n_lhs):
+        next_counts = [[1]]
+        for j in range(1, n_rhs + 1):
+            shifted = [0] * j + counts[j]
+            below = next_counts[j - 1]
+            size = max(len(shifted), len(below))
+            next_counts.append(
+                [
+                    (shifted[u] if u < len(shifted) else 0) + (below[u] if u < len(below) else 0)
+                    for u in range(size)
+                ]
+            )
+        counts = next_counts
+    return counts[n_rhs]
+
+
+def mann_whitney_u_test(lhs, rhs):
+    """
+    Two-sided Mann-Whitney U test, returns the p-value. Small samples without ties use the exact
+    distribution of U, otherwise the normal approximation with tie and continuity correction.
+    """
+    values = sorted([(value, 0) for value in lhs] + [(value, 1) for value in rhs])
+    n = len(values)
+
+    # Assign average ranks to ties
+    ranks = [0.0] * n
+    tie_correction = 0.0
+    i = 0
+    while i < n:
+        j = i
+        while j + 1 < n and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        tie_count = j - i + 1
+        tie_correction += tie_count**3 - tie_count
+        i = j + 1
+
+    n_lhs, n_rhs = len(lhs), len(rhs)
+    rank_sum_lhs = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum_lhs - n_lhs * (n_lhs + 1) / 2
+
+    if tie_correction == 0 and n <= EXACT_TEST_MAX_SAMPLES:
+        distribution = exact_u_distribution(n_lhs, n_rhs)
+        total = sum(distribution)
+        lower_tail = sum(distribution[: int(u) + 1]) / total
+        upper_tail = sum(distribution[int(u) :]) / total
+        return min(1.0, 2 * min(lower_tail, upper_tail))
+
+    mean = n_lhs * n_rhs / 2
+    variance = n_lhs * n_rhs / 12 * ((n + 1) - tie_correction / (n * (n - 1)))
+    if variance == 0:
+        return 1.0
+
+    z = max(abs(u - mean) - 0.5, 0) / math.sqrt(variance)
+    return math.erfc(z / math.sqrt(2))
+
+
+def format_throughput(value):
+    for threshold, suffix in ((1e9, "G"), (1e6, "M"), (1e3, "k")):
+        if value >= threshold:
+            return f"{value / threshold:.3g}{suffix}/s"
+    return f"{value:.3g}/s"
+
+
+def compare(baseline_file, contender_file, threshold, alpha):
+    """Prints a comparison of the two result files, returns the names of regressed benchmarks."""
+    baseline = read_throughput_samples(baseline_file)
+    contender = read_throughput_samples(contender_file)
+
+    rows = []
+    regressions = []
+    for name in sorted(baseline.keys() & contender.keys()):
+        baseline_median = statistics.median(baseline[name])
+        contender_median = statistics.median(contender[name])
+        change = contender_median / baseline_median - 1
+        p_value = mann_whitney_u_test(baseline[name], contender[name])
+
+        verdict = ""
+        if p_value < alpha and abs(change) > threshold:
+            verdict = "REGRESSION" if change < 0 else "improvement"
+        if verdict == "REGRESSION":
+            regressions.append(name)
+
+        rows.append(
+            (
+                name,
+                format_throughput(baseline_median),
+                format_throughput(contender_median),
+                f"{change:+.1%}",
+                f"{p_value:.4f}",
+                verdict,
+            )
+        )
+
+    header = ("Benchmark", "Baseline", "Contender", "Change", "p-value", "")
+    widths = [max(len(row[column]) for row in [header, *rows]) for column in range(len(header))]
+    for row in [header, *rows]:
+        print("  ".join(cell.ljust(width) for cell, width in zip(row, widths)).rstrip())
+
+    for name in sorted(baseline.keys() - contender.keys()):
+        print(f"Missing from contender: {name}")
+    for name in sorted(contender.keys() - baseline.keys()):
+        print(f"Missing from baseline: {name}")
+
+    if regressions:
+        print(
+            f"\n{len(regressions)} benchmark(s) lost more than {threshold:.0%} throughput "
+            f"(p < {alpha}):"
+        )
+        for name in regressions:
+            print(f"  {name}")
+    return regressions
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description="Benchmark regression harness for Graaf_perf.")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = subparsers.add_parser("run", help="Run the benchmarks and store the results.")
+    run_parser.add_argument("--output", type=Path, required=True)
+
+    compare_parser = subparsers.add_parser("compare", help="Compare two stored results.")
+    compare_parser.add_argument("baseline", type=Path)
+    compare_parser.add_argument("contender", type=Path)
+
+    check_parser = subparsers.add_parser(
+        "check", help="Run the benchmarks and compare the results against a baseline."
+    )
+    check_parser.add_argument("--baseline", type=Path, required=True)
+    check_parser.add_argument("--output", type=Path, default=Path("benchmark_results.json"))
+
+    for subparser in (run_parser, check_parser):
+        subparser.add_argument("--executable", type=Path, default=Path("build/perf/Graaf_perf"))
+        subparser.add_argument("--repetitions", type=int, default=10)
+
+    for subparser in (compare_parser, check_parser):
+        subparser.add_argument(
+            "--threshold", type=float, default=0.05, help="Tolerated relative throughput loss."
+        )
+        subparser.add_argument("--alpha", type=float, default=0.01, help="Significance level.")
+
+    return parser.parse_known_args()
+
+
+if __name__ == "__main__":
+    args, extra_args = parse_arguments()
+
+    if args.command == "compare" and extra_args:
+        sys.exit(f"Unrecognized arguments: {' '.join(extra_args)}")
+
+    if args.command in ("run", "check"):
+        run_benchmarks(args.executable, args.output, args.repetitions, extra_args)
+
+    if args.command == "compare":
+        sys.exit(1 if compare(args.baseline, args.contender, args.threshold, args.alpha) else 0)
+    if args.command == "check":
+        sys.exit(1 if compare(args.baseline, args.output, args.threshold, args.alpha) else 0)